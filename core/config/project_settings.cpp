@@ -43,6 +43,7 @@
 #include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
 #include "core/io/resource_uid.h"
@@ -784,6 +785,17 @@ Error ProjectSettings::setup(const String &p_path, const String &p_main_pack, bo
 	Compression::zstd_level = GLOBAL_GET("compression/formats/zstd/compression_level");
 	Compression::zstd_window_log_size = GLOBAL_GET("compression/formats/zstd/window_log_size");
 
+	// Only exported packs contain resources compressed with the dictionary, and the dictionary along with them.
+	const String zstd_dictionary_path = GLOBAL_GET("compression/formats/zstd/dictionary");
+	if (!zstd_dictionary_path.is_empty()) {
+		const Vector<uint8_t> zstd_dictionary = FileAccess::get_file_as_bytes(zstd_dictionary_path);
+		if (zstd_dictionary.is_empty()) {
+			ERR_PRINT(vformat("Couldn't load the zstd compression dictionary: '%s'.", zstd_dictionary_path));
+		} else {
+			FileAccessCompressed::register_dictionary(zstd_dictionary);
+		}
+	}
+
 	Compression::zlib_level = GLOBAL_GET("compression/formats/zlib/compression_level");
 
 	Compression::gzip_level = GLOBAL_GET("compression/formats/gzip/compression_level");
@@ -1631,6 +1643,7 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "compression/formats/zstd/long_distance_matching"), Compression::zstd_long_distance_matching);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zstd/compression_level", PROPERTY_HINT_RANGE, "1,22,1"), Compression::zstd_level);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zstd/window_log_size", PROPERTY_HINT_RANGE, "10,30,1"), Compression::zstd_window_log_size);
+	GLOBAL_DEF(PropertyInfo(Variant::STRING, "compression/formats/zstd/dictionary", PROPERTY_HINT_FILE, "*.zdict,*.dict"), "");
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zlib/compression_level", PROPERTY_HINT_RANGE, "-1,9,1"), Compression::zlib_level);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/gzip/compression_level", PROPERTY_HINT_RANGE, "-1,9,1"), Compression::gzip_level);
 
@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*  trace_profiler.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file trace_profiler.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "trace_profiler.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+thread_local TraceProfiler::ThreadBuffer *TraceProfiler::thread_buffer = nullptr;
+thread_local uint32_t TraceProfiler::thread_generation = 0;
+thread_local String TraceProfiler::thread_name;
+
+TraceProfiler::ThreadBuffer *TraceProfiler::_get_thread_buffer() {
+	if (likely(thread_buffer && thread_generation == generation.get())) {
+		return thread_buffer;
+	}
+
+	ThreadBuffer *buffer = memnew(ThreadBuffer);
+	buffer->thread_id = Thread::get_caller_id();
+	if (!thread_name.is_empty()) {
+		buffer->thread_name = thread_name;
+	} else {
+		buffer->thread_name = Thread::is_main_thread() ? String("Main Thread") : vformat("Thread %d", buffer->thread_id);
+	}
+	buffer->events.resize(buffer_capacity);
+
+	MutexLock lock(buffers_mutex);
+	buffers.push_back(buffer);
+	thread_buffer = buffer;
+	thread_generation = generation.get();
+	return buffer;
+}
+
+void TraceProfiler::set_enabled(bool p_enabled) {
+	enabled.set_to(p_enabled);
+}
+
+void TraceProfiler::set_buffer_capacity(uint32_t p_capacity) {
+	ERR_FAIL_COND_MSG(p_capacity == 0, "Trace buffer capacity must be greater than zero.");
+	buffer_capacity = p_capacity;
+}
+
+void TraceProfiler::begin_zone(const char *p_name) {
+	ThreadBuffer *buffer = _get_thread_buffer();
+	if (buffer->depth < MAX_ZONE_DEPTH) {
+		Event &zone = buffer->open_zones[buffer->depth];
+		zone.name = p_name;
+		zone.begin_usec = OS::get_singleton()->get_ticks_usec();
+	}
+	// Zones nested deeper than the limit are not recorded, but still counted so they close in order.
+	buffer->depth++;
+}
+
+void TraceProfiler::end_zone() {
+	if (unlikely(!thread_buffer || thread_generation != generation.get())) {
+		return; // The buffers were finalized while the zone was open, so there is nothing to close.
+	}
+	ThreadBuffer *buffer = thread_buffer;
+	if (buffer->depth == 0) {
+		return;
+	}
+	buffer->depth--;
+	if (buffer->depth >= MAX_ZONE_DEPTH) {
+		return;
+	}
+
+	Event &zone = buffer->open_zones[buffer->depth];
+	zone.end_usec = OS::get_singleton()->get_ticks_usec();
+
+	buffer->lock.lock();
+	buffer->events[buffer->written % buffer->events.size()] = zone;
+	buffer->written++;
+	buffer->lock.unlock();
+}
+
+void TraceProfiler::set_thread_name(const String &p_name) {
+	// Kept aside so threads that never record a zone don't allocate a buffer.
+	thread_name = p_name;
+	if (thread_buffer && thread_generation == generation.get()) {
+		thread_buffer->lock.lock();
+		thread_buffer->thread_name = p_name;
+		thread_buffer->lock.unlock();
+	}
+}
+
+void TraceProfiler::get_events(LocalVector<Event> &r_events, Thread::ID p_thread_id) {
+	r_events.clear();
+
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		if (p_thread_id != Thread::UNASSIGNED_ID && buffer->thread_id != p_thread_id) {
+			continue;
+		}
+
+		buffer->lock.lock();
+		const uint64_t capacity = buffer->events.size();
+		const uint64_t first = buffer->written > capacity ? buffer->written - capacity : 0;
+		for (uint64_t i = first; i < buffer->written; i++) {
+			r_events.push_back(buffer->events[i % capacity]);
+		}
+		buffer->lock.unlock();
+	}
+}
+
+void TraceProfiler::clear() {
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		buffer->lock.lock();
+		buffer->written = 0;
+		buffer->lock.unlock();
+	}
+}
+
+String TraceProfiler::get_chrome_trace() {
+	const int pid = OS::get_singleton()->get_process_id();
+	const String pid_str = itos(pid);
+
+	// Events are appended as separate strings and joined once, which is much cheaper
+	// than growing one string or building a Dictionary for large traces.
+	Vector<String> entries;
+
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		buffer->lock.lock();
+		const String tid_str = itos(buffer->thread_id);
+		entries.push_back(vformat(R"({"name":"thread_name","ph":"M","pid":%s,"tid":%s,"args":{"name":"%s"}})", pid_str, tid_str, buffer->thread_name.json_escape()));
+
+		const uint64_t capacity = buffer->events.size();
+		const uint64_t first = buffer->written > capacity ? buffer->written - capacity : 0;
+		for (uint64_t i = first; i < buffer->written; i++) {
+			const Event &event = buffer->events[i % capacity];
+			entries.push_back(String(R"({"name":")") + String(event.name).json_escape() +
+					R"(","ph":"X","ts":)" + itos(event.begin_usec) +
+					R"(,"dur":)" + itos(event.end_usec - event.begin_usec) +
+					R"(,"pid":)" + pid_str + R"(,"tid":)" + tid_str + "}");
+		}
+		buffer->lock.unlock();
+	}
+
+	return R"({"displayTimeUnit":"ms","traceEvents":[)" + String(",\n").join(entries) + "]}\n";
+}
+
+Error TraceProfiler::save_chrome_trace(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot open file '%s' to save the trace.", p_path));
+	f->store_string(get_chrome_trace());
+	return OK;
+}
+
+void TraceProfiler::finalize() {
+	enabled.clear();
+
+	MutexLock lock(buffers_mutex);
+	generation.increment();
+	for (ThreadBuffer *buffer : buffers) {
+		memdelete(buffer);
+	}
+	buffers.clear();
+}
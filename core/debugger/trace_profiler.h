@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  trace_profiler.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file trace_profiler.h
+ *
+ * @brief Scoped-zone tracing for finding stalls across threads.
+ *
+ * Zones are recorded into a fixed-size ring buffer owned by each thread, so
+ * only the most recent events are kept and recording never allocates after
+ * the first zone of a thread. Use the TRACE_ZONE() macro to instrument code;
+ * it compiles to nothing in release builds. The recorded events can be
+ * saved in the Chrome trace event format, which both chrome://tracing and
+ * Perfetto open.
+ */
+
+#include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class TraceProfiler {
+public:
+	struct Event {
+		const char *name = nullptr; ///< Must be a string with static storage, usually a literal.
+		uint64_t begin_usec = 0;
+		uint64_t end_usec = 0;
+	};
+
+	class Zone {
+		bool active = false;
+
+	public:
+		_FORCE_INLINE_ Zone(const char *p_name) {
+			if (enabled.is_set()) {
+				begin_zone(p_name);
+				active = true;
+			}
+		}
+		_FORCE_INLINE_ ~Zone() {
+			if (active) {
+				end_zone();
+			}
+		}
+	};
+
+	enum {
+		DEFAULT_BUFFER_CAPACITY = 16384,
+		MAX_ZONE_DEPTH = 64,
+	};
+
+private:
+	struct ThreadBuffer {
+		SpinLock lock; // Only contended while events are being read or cleared.
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
+		String thread_name;
+		LocalVector<Event> events; // Ring buffer, `written % capacity` is the next slot.
+		uint64_t written = 0;
+		uint32_t depth = 0;
+		Event open_zones[MAX_ZONE_DEPTH];
+	};
+
+	static inline SafeFlag enabled{ false };
+	static inline SafeNumeric<uint32_t> generation{ 0 };
+	static inline uint32_t buffer_capacity = DEFAULT_BUFFER_CAPACITY;
+	static inline BinaryMutex buffers_mutex;
+	static inline LocalVector<ThreadBuffer *> buffers;
+
+	static thread_local ThreadBuffer *thread_buffer;
+	static thread_local uint32_t thread_generation;
+	static thread_local String thread_name;
+
+	static ThreadBuffer *_get_thread_buffer();
+
+public:
+	static void set_enabled(bool p_enabled);
+	_FORCE_INLINE_ static bool is_enabled() { return enabled.is_set(); }
+
+	/// Number of events kept per thread. Only applies to threads that record their first zone afterwards.
+	static void set_buffer_capacity(uint32_t p_capacity);
+	static uint32_t get_buffer_capacity() { return buffer_capacity; }
+
+	/// Every begin_zone() must be matched by an end_zone() on the same thread, even if tracing was disabled in between.
+	static void begin_zone(const char *p_name);
+	static void end_zone();
+
+	/// Name shown for the calling thread in the exported trace.
+	static void set_thread_name(const String &p_name);
+
+	/// Copies the recorded events of every thread, oldest first. Meant for tests and tools.
+	static void get_events(LocalVector<Event> &r_events, Thread::ID p_thread_id = Thread::UNASSIGNED_ID);
+	static void clear();
+
+	static String get_chrome_trace();
+	static Error save_chrome_trace(const String &p_path);
+
+	/// Frees every buffer. No thread may be inside a zone while this runs.
+	static void finalize();
+};
+
+#ifdef DEBUG_ENABLED
+#define _TRACE_ZONE_VAR_CONCAT(m_a, m_b) m_a##m_b
+#define _TRACE_ZONE_VAR(m_line) _TRACE_ZONE_VAR_CONCAT(_trace_zone_, m_line)
+#define TRACE_ZONE(m_name) TraceProfiler::Zone _TRACE_ZONE_VAR(__LINE__)(m_name)
+#else
+#define TRACE_ZONE(m_name)
+#endif // DEBUG_ENABLED
@@ -49,11 +49,20 @@
 #include <brotli/decode.h>
 #endif
 
-// Caches for zstd.
-static BinaryMutex mutex;
-static ZSTD_DCtx *current_zstd_d_ctx = nullptr;
-static bool current_zstd_long_distance_matching;
-static int current_zstd_window_log_size;
+// Cache for zstd, one decompression context per thread so concurrent decompression doesn't serialize.
+struct ZstdDecompressionContext {
+	ZSTD_DCtx *ctx = nullptr;
+	bool long_distance_matching = false;
+	int window_log_size = 0;
+
+	~ZstdDecompressionContext() {
+		if (ctx) {
+			ZSTD_freeDCtx(ctx);
+		}
+	}
+};
+
+static thread_local ZstdDecompressionContext zstd_d_ctx;
 
 int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
 	switch (p_mode) {
@@ -99,22 +108,33 @@ int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_sr
 
 		} break;
 		case MODE_ZSTD: {
-			ZSTD_CCtx *cctx = ZSTD_createCCtx();
-			ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, zstd_level);
-			if (zstd_long_distance_matching) {
-				ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
-				ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_window_log_size);
-			}
-			const int64_t max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
-			const size_t ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
-			ZSTD_freeCCtx(cctx);
-			return (int64_t)ret;
+			return compress_zstd(p_dst, p_src, p_src_size, Vector<uint8_t>());
 		} break;
 	}
 
 	ERR_FAIL_V(-1);
 }
 
+int64_t Compression::compress_zstd(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, const Vector<uint8_t> &p_dictionary) {
+	ZSTD_CCtx *cctx = ZSTD_createCCtx();
+	ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, zstd_level);
+	if (zstd_long_distance_matching) {
+		ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
+		ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_window_log_size);
+	}
+	if (!p_dictionary.is_empty()) {
+		const size_t ret = ZSTD_CCtx_loadDictionary(cctx, p_dictionary.ptr(), p_dictionary.size());
+		if (ZSTD_isError(ret)) {
+			ZSTD_freeCCtx(cctx);
+			ERR_FAIL_V_MSG(-1, vformat("Invalid zstd dictionary: %s.", ZSTD_getErrorName(ret)));
+		}
+	}
+	const int64_t max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
+	const size_t ret = ZSTD_compress2(cctx, p_dst, max_dst_size, p_src, p_src_size);
+	ZSTD_freeCCtx(cctx);
+	return ZSTD_isError(ret) ? -1 : (int64_t)ret;
+}
+
 int64_t Compression::get_max_compressed_buffer_size(int64_t p_src_size, Mode p_mode) {
 	switch (p_mode) {
 		case MODE_BROTLI: {
@@ -206,27 +226,34 @@ int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const ui
 			return total;
 		} break;
 		case MODE_ZSTD: {
-			MutexLock lock(mutex);
+			return decompress_zstd(p_dst, p_dst_max_size, p_src, p_src_size, Vector<uint8_t>());
+		} break;
+	}
 
-			if (!current_zstd_d_ctx || current_zstd_long_distance_matching != zstd_long_distance_matching || current_zstd_window_log_size != zstd_window_log_size) {
-				if (current_zstd_d_ctx) {
-					ZSTD_freeDCtx(current_zstd_d_ctx);
-				}
+	ERR_FAIL_V(-1);
+}
 
-				current_zstd_d_ctx = ZSTD_createDCtx();
-				if (zstd_long_distance_matching) {
-					ZSTD_DCtx_setParameter(current_zstd_d_ctx, ZSTD_d_windowLogMax, zstd_window_log_size);
-				}
-				current_zstd_long_distance_matching = zstd_long_distance_matching;
-				current_zstd_window_log_size = zstd_window_log_size;
-			}
+int64_t Compression::decompress_zstd(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, const Vector<uint8_t> &p_dictionary) {
+	if (!zstd_d_ctx.ctx || zstd_d_ctx.long_distance_matching != zstd_long_distance_matching || zstd_d_ctx.window_log_size != zstd_window_log_size) {
+		if (zstd_d_ctx.ctx) {
+			ZSTD_freeDCtx(zstd_d_ctx.ctx);
+		}
 
-			size_t ret = ZSTD_decompressDCtx(current_zstd_d_ctx, p_dst, p_dst_max_size, p_src, p_src_size);
-			return (int64_t)ret;
-		} break;
+		zstd_d_ctx.ctx = ZSTD_createDCtx();
+		if (zstd_long_distance_matching) {
+			ZSTD_DCtx_setParameter(zstd_d_ctx.ctx, ZSTD_d_windowLogMax, zstd_window_log_size);
+		}
+		zstd_d_ctx.long_distance_matching = zstd_long_distance_matching;
+		zstd_d_ctx.window_log_size = zstd_window_log_size;
 	}
 
-	ERR_FAIL_V(-1);
+	size_t ret;
+	if (p_dictionary.is_empty()) {
+		ret = ZSTD_decompressDCtx(zstd_d_ctx.ctx, p_dst, p_dst_max_size, p_src, p_src_size);
+	} else {
+		ret = ZSTD_decompress_usingDict(zstd_d_ctx.ctx, p_dst, p_dst_max_size, p_src, p_src_size, p_dictionary.ptr(), p_dictionary.size());
+	}
+	return ZSTD_isError(ret) ? -1 : (int64_t)ret;
 }
 
 int Compression::decompress_dynamic(Vector<uint8_t> *p_dst_vect, int64_t p_max_dst_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
@@ -63,6 +63,12 @@ public:
 	static int64_t compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD);
 	static int64_t get_max_compressed_buffer_size(int64_t p_src_size, Mode p_mode = MODE_ZSTD);
 	static int64_t decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD);
+	/**
+	 *	Zstd with an optional shared dictionary (raw content or trained with `zstd --train`), which greatly improves the ratio of small buffers.
+	 *	Data compressed with a dictionary can only be decompressed with the same dictionary. Safe to call from several threads at once.
+	 */
+	static int64_t compress_zstd(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, const Vector<uint8_t> &p_dictionary);
+	static int64_t decompress_zstd(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, const Vector<uint8_t> &p_dictionary);
 	/**
 	 *	This will handle both Gzip and Deflate streams. It will automatically allocate the output buffer into the provided p_dst_vect Vector.
 	 *	This is required for compressed data whose final uncompressed size is unknown, as is the case for HTTP response bodies.
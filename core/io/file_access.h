@@ -43,6 +43,7 @@
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
 #include "core/string/ustring.h"
+#include "core/templates/span.h"
 #include "core/typedefs.h"
 
 /**
@@ -146,6 +147,7 @@ protected:
 
 private:
 	static inline bool backup_save = false;
+	static inline bool memory_mapping = false;
 	static inline thread_local Error last_file_open_error = OK;
 
 	AccessType _access_type = ACCESS_FILESYSTEM;
@@ -196,6 +198,13 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	/**
+	 * Returns a read-only view of the next `p_length` bytes without copying them, and advances the position past them.
+	 * Only backends that keep the file contents in memory (e.g. memory-mapped files) support this; the others, or a request
+	 * going past the end of the file, return an empty Span and leave the position untouched, so callers must fall back to `get_buffer()`.
+	 * The view stays valid until the file is closed.
+	 */
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const { return Span<uint8_t>(); }
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -268,6 +277,10 @@ public:
 	static void set_backup_save(bool p_enable) { backup_save = p_enable; }
 	static bool is_backup_save_enabled() { return backup_save; }
 
+	/// When enabled, backends that support it map files opened with `READ` into memory instead of using buffered reads.
+	static void set_memory_mapping_enabled(bool p_enable) { memory_mapping = p_enable; }
+	static bool is_memory_mapping_enabled() { return memory_mapping; }
+
 	static String get_md5(const String &p_file);
 	static String get_sha256(const String &p_file);
 	static String get_multiple_md5(const Vector<String> &p_file);
@@ -38,6 +38,9 @@
 
 #include "file_access_compressed.h"
 
+BinaryMutex FileAccessCompressed::dictionaries_mutex;
+HashMap<uint32_t, Vector<uint8_t>> FileAccessCompressed::dictionaries;
+
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
 	magic = p_magic.ascii().get_data();
 	magic = (magic + "    ").substr(0, 4);
@@ -46,9 +49,108 @@ void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_
 	block_size = p_block_size;
 }
 
+void FileAccessCompressed::set_dictionary(const Vector<uint8_t> &p_dictionary) {
+	ERR_FAIL_COND_MSG(cmode != Compression::MODE_ZSTD && !p_dictionary.is_empty(), "Compression dictionaries are only supported by zstd.");
+
+	dictionary = p_dictionary;
+	dictionary_id = p_dictionary.is_empty() ? 0 : register_dictionary(p_dictionary);
+}
+
+uint32_t FileAccessCompressed::register_dictionary(const Vector<uint8_t> &p_dictionary) {
+	ERR_FAIL_COND_V(p_dictionary.is_empty(), 0);
+
+	uint32_t id = hash_murmur3_buffer(p_dictionary.ptr(), p_dictionary.size());
+	if (id == 0) {
+		id = 1; // Zero means no dictionary.
+	}
+
+	MutexLock lock(dictionaries_mutex);
+	dictionaries[id] = p_dictionary;
+	return id;
+}
+
+Vector<uint8_t> FileAccessCompressed::get_registered_dictionary(uint32_t p_id) {
+	MutexLock lock(dictionaries_mutex);
+	const Vector<uint8_t> *dict = dictionaries.getptr(p_id);
+	return dict ? *dict : Vector<uint8_t>();
+}
+
+int64_t FileAccessCompressed::_decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size) const {
+	if (cmode == Compression::MODE_ZSTD) {
+		return Compression::decompress_zstd(p_dst, p_dst_max_size, p_src, p_src_size, dictionary);
+	}
+	return Compression::decompress(p_dst, p_dst_max_size, p_src, p_src_size, cmode);
+}
+
+void FileAccessCompressed::_read_ahead_task(void *p_userdata) {
+	ReadAheadBlock *slot = (ReadAheadBlock *)p_userdata;
+	slot->result = slot->owner->_decompress(slot->decompressed.ptrw(), slot->size, slot->compressed.ptr(), slot->compressed.size());
+}
+
+void FileAccessCompressed::_wait_read_ahead(ReadAheadBlock &p_slot) const {
+	if (p_slot.task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_slot.task);
+		p_slot.task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+void FileAccessCompressed::_queue_read_ahead(uint32_t p_block) const {
+	ReadAheadBlock &slot = read_ahead[p_block % READ_AHEAD_BLOCKS];
+	if (slot.block == p_block) {
+		return; // Already on its way.
+	}
+	_wait_read_ahead(slot);
+
+	slot.owner = this;
+	slot.block = p_block;
+	slot.size = block_size;
+	slot.compressed.resize(read_blocks[p_block].csize);
+	slot.decompressed.resize(block_size);
+	f->seek(read_blocks[p_block].offset);
+	f->get_buffer(slot.compressed.ptrw(), read_blocks[p_block].csize);
+	slot.task = WorkerThreadPool::get_singleton()->add_native_task(&FileAccessCompressed::_read_ahead_task, &slot, false, "FileAccessCompressed read-ahead");
+}
+
+bool FileAccessCompressed::_load_block(uint32_t p_block, bool p_sequential) const {
+	ReadAheadBlock &slot = read_ahead[p_block % READ_AHEAD_BLOCKS];
+	int64_t ret;
+	if (slot.block == p_block) {
+		_wait_read_ahead(slot);
+		slot.block = UINT32_MAX;
+		ret = slot.result;
+		SWAP(buffer, slot.decompressed);
+		read_ptr = buffer.ptrw();
+	} else {
+		f->seek(read_blocks[p_block].offset);
+		f->get_buffer(comp_buffer.ptrw(), read_blocks[p_block].csize);
+		ret = _decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[p_block].csize);
+	}
+	read_block_size = p_block == read_block_count - 1 ? read_total % block_size : block_size;
+
+	sequential_blocks = p_sequential ? sequential_blocks + 1 : 0;
+	if (sequential_blocks >= READ_AHEAD_MIN_SEQUENTIAL && WorkerThreadPool::get_singleton()) {
+		for (uint32_t i = 1; i <= READ_AHEAD_BLOCKS && p_block + i < read_block_count; i++) {
+			_queue_read_ahead(p_block + i);
+		}
+	}
+
+	return ret != -1;
+}
+
 Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	f = p_base;
-	cmode = (Compression::Mode)f->get_32();
+	uint32_t mode_flags = f->get_32();
+	cmode = (Compression::Mode)(mode_flags & HEADER_MODE_MASK);
+	dictionary_id = 0;
+	dictionary.clear();
+	if (mode_flags & HEADER_FLAG_DICTIONARY) {
+		dictionary_id = f->get_32();
+		dictionary = get_registered_dictionary(dictionary_id);
+		if (cmode != Compression::MODE_ZSTD || dictionary.is_empty()) {
+			f.unref();
+			ERR_FAIL_V_MSG(ERR_FILE_MISSING_DEPENDENCIES, vformat("Can't open compressed file '%s', the zstd dictionary it was compressed with (ID %08x) is not available.", p_base->get_path(), dictionary_id));
+		}
+	}
 	block_size = f->get_32();
 	if (block_size == 0) {
 		f.unref();
@@ -70,17 +172,16 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	comp_buffer.resize(max_bs);
 	buffer.resize(block_size);
 	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
 	at_end = false;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
+	sequential_blocks = 0;
 
-	const int64_t ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
+	const bool ok = _load_block(0, false);
 	read_block = 0;
 	read_pos = 0;
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+	return ok ? OK : ERR_FILE_CORRUPT;
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -129,10 +230,16 @@ void FileAccessCompressed::_close() {
 
 		CharString mgc = magic.utf8();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
+		if (dictionary_id) {
+			f->store_32(uint32_t(cmode) | HEADER_FLAG_DICTIONARY); //write compression mode 4
+			f->store_32(dictionary_id); //write dictionary ID 4
+		} else {
+			f->store_32(cmode); //write compression mode 4
+		}
 		f->store_32(block_size); //write block size 4
 		f->store_32(uint32_t(write_max)); //max amount of data written 4
 		uint32_t bc = (write_max / block_size) + 1;
+		uint64_t block_table_ofs = f->get_position();
 
 		for (uint32_t i = 0; i < bc; i++) {
 			f->store_32(0); //compressed sizes, will update later
@@ -145,14 +252,14 @@ void FileAccessCompressed::_close() {
 
 			Vector<uint8_t> cblock;
 			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			const int64_t compressed_size = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+			const int64_t compressed_size = dictionary_id ? Compression::compress_zstd(cblock.ptrw(), bp, bl, dictionary) : Compression::compress(cblock.ptrw(), bp, bl, cmode);
 			ERR_FAIL_COND_MSG(compressed_size < 0, "FileAccessCompressed: Error compressing data.");
 
 			f->store_buffer(cblock.ptr(), (uint64_t)compressed_size);
 			block_sizes.push_back(compressed_size);
 		}
 
-		f->seek(16); //ok write block sizes
+		f->seek(block_table_ofs); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
 			f->store_32(uint32_t(block_sizes[i]));
 		}
@@ -162,6 +269,12 @@ void FileAccessCompressed::_close() {
 		buffer.clear();
 
 	} else {
+		for (ReadAheadBlock &slot : read_ahead) {
+			_wait_read_ahead(slot);
+			slot.block = UINT32_MAX;
+			slot.compressed.clear();
+			slot.decompressed.clear();
+		}
 		comp_buffer.clear();
 		buffer.clear();
 		read_blocks.clear();
@@ -206,12 +319,9 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			read_eof = false;
 			uint32_t block_idx = p_position / block_size;
 			if (block_idx != read_block) {
+				const bool sequential = block_idx == read_block + 1;
 				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				ERR_FAIL_COND_MSG(!_load_block(read_block, sequential), "Compressed file is corrupt.");
 			}
 
 			read_pos = p_position % block_size;
@@ -296,10 +406,7 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		}
 
 		// Read the next block of compressed data.
-		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-		const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+		ERR_FAIL_COND_V_MSG(!_load_block(read_block, true), -1, "Compressed file is corrupt.");
 		read_pos = 0;
 	}
 
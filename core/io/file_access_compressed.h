@@ -40,6 +40,9 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 
 class FileAccessCompressed : public FileAccess {
 	GDSOFTCLASS(FileAccessCompressed, FileAccess);
@@ -59,7 +62,7 @@ class FileAccessCompressed : public FileAccess {
 	};
 
 	mutable Vector<uint8_t> comp_buffer;
-	uint8_t *read_ptr = nullptr;
+	mutable uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
@@ -71,10 +74,50 @@ class FileAccessCompressed : public FileAccess {
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	uint32_t dictionary_id = 0;
+	Vector<uint8_t> dictionary;
+
+	// Blocks decompressed on worker threads ahead of the read position, once reads turn out to be sequential.
+	struct ReadAheadBlock {
+		const FileAccessCompressed *owner = nullptr;
+		uint32_t block = UINT32_MAX;
+		uint32_t size = 0;
+		Vector<uint8_t> compressed;
+		Vector<uint8_t> decompressed;
+		int64_t result = 0;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	static constexpr uint32_t READ_AHEAD_BLOCKS = 4;
+	static constexpr uint32_t READ_AHEAD_MIN_SEQUENTIAL = 2;
+	mutable ReadAheadBlock read_ahead[READ_AHEAD_BLOCKS];
+	mutable uint32_t sequential_blocks = 0;
+
+	static BinaryMutex dictionaries_mutex;
+	static HashMap<uint32_t, Vector<uint8_t>> dictionaries;
+
+	int64_t _decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size) const;
+	bool _load_block(uint32_t p_block, bool p_sequential) const;
+	void _queue_read_ahead(uint32_t p_block) const;
+	void _wait_read_ahead(ReadAheadBlock &p_slot) const;
+	static void _read_ahead_task(void *p_userdata);
+
 	void _close();
 
 public:
+	enum {
+		HEADER_MODE_MASK = 0xFFFF,
+		HEADER_FLAG_DICTIONARY = 1 << 16, // Blocks were compressed with a zstd dictionary, whose ID follows the mode.
+	};
+
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+	// Compresses the blocks written with this zstd dictionary; it has to be registered to read them back.
+	void set_dictionary(const Vector<uint8_t> &p_dictionary);
+	const Vector<uint8_t> &get_dictionary() const { return dictionary; }
+
+	// Makes a dictionary available to the files that reference it, returns its ID.
+	static uint32_t register_dictionary(const Vector<uint8_t> &p_dictionary);
+	static Vector<uint8_t> get_registered_dictionary(uint32_t p_id);
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
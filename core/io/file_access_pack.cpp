@@ -447,6 +447,29 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+Span<uint8_t> FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), Span<uint8_t>(), "File must be opened before use.");
+
+	if (eof) {
+		return Span<uint8_t>();
+	}
+
+	// Same bounds as get_buffer(), except that a view never comes up short: a request reaching past the end
+	// is refused instead of setting eof, so the caller can still fall back to get_buffer().
+	if (p_length + pos > pf.size) {
+		return Span<uint8_t>();
+	}
+
+	// Only succeeds when the underlying pack is memory-mapped (and not encrypted).
+	Span<uint8_t> view = f->get_buffer_view(p_length);
+	if (view.is_empty()) {
+		return view;
+	}
+
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
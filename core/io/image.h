@@ -218,6 +218,7 @@ public:
 	static inline ImageMemLoadFunc _png_mem_unpacker_func = nullptr;
 	static inline ImageMemLoadFunc _jpg_mem_loader_func = nullptr;
 	static inline ImageMemLoadFunc _webp_mem_loader_func = nullptr;
+	static inline ImageMemLoadFunc _webp_mem_unpacker_func = nullptr;
 	static inline ImageMemLoadFunc _tga_mem_loader_func = nullptr;
 	static inline ImageMemLoadFunc _bmp_mem_loader_func = nullptr;
 	static inline ScalableImageMemLoadFunc _svg_scalable_mem_loader_func = nullptr;
@@ -40,6 +40,8 @@
 
 #include "core/config/engine.h"
 #include "core/object/script_language.h"
+#include "core/string/string_builder.h"
+#include "core/templates/hashfuncs.h"
 #include "core/variant/container_type_validate.h"
 
 const char *JSON::tk_name[TK_MAX] = {
@@ -55,13 +57,25 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-void JSON::_add_indent(String &r_result, const String &p_indent, int p_size) {
+void JSON::_add_indent(StringBuilder &r_result, const String &p_indent, int p_size) {
 	for (int i = 0; i < p_size; i++) {
 		r_result += p_indent;
 	}
 }
 
-void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+static _FORCE_INLINE_ bool _json_needs_escape(const String &p_string) {
+	// Same set of characters String::json_escape() replaces.
+	const char32_t *str = p_string.ptr();
+	for (int i = 0; i < p_string.length(); i++) {
+		const char32_t c = str[i];
+		if (c == '\\' || c == '"' || (c >= '\b' && c <= '\r')) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void JSON::_stringify(StringBuilder &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
 	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
 		r_result += "...";
 		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
@@ -114,7 +128,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				return;
 			}
 
-			r_result += '[';
+			r_result += "[";
 			r_result += end_statement;
 
 			p_markers.insert(a.id());
@@ -124,7 +138,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				if (first) {
 					first = false;
 				} else {
-					r_result += ',';
+					r_result += ",";
 					r_result += end_statement;
 				}
 				_add_indent(r_result, p_indent, p_cur_indent + 1);
@@ -132,7 +146,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 			}
 			r_result += end_statement;
 			_add_indent(r_result, p_indent, p_cur_indent);
-			r_result += ']';
+			r_result += "]";
 			p_markers.erase(a.id());
 			return;
 		}
@@ -143,7 +157,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				ERR_FAIL_MSG("Converting circular structure to JSON.");
 			}
 
-			r_result += '{';
+			r_result += "{";
 			r_result += end_statement;
 			p_markers.insert(d.id());
 
@@ -158,7 +172,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				if (first_key) {
 					first_key = false;
 				} else {
-					r_result += ',';
+					r_result += ",";
 					r_result += end_statement;
 				}
 				_add_indent(r_result, p_indent, p_cur_indent + 1);
@@ -169,15 +183,18 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 
 			r_result += end_statement;
 			_add_indent(r_result, p_indent, p_cur_indent);
-			r_result += '}';
+			r_result += "}";
 			p_markers.erase(d.id());
 			return;
 		}
-		default:
-			r_result += '"';
-			r_result += String(p_var).json_escape();
-			r_result += '"';
+		default: {
+			// Most strings have nothing to escape, append them as they are instead of running every replacement.
+			const String str = p_var;
+			r_result += "\"";
+			r_result += _json_needs_escape(str) ? str.json_escape() : str;
+			r_result += "\"";
 			return;
+		}
 	}
 }
 
@@ -598,11 +615,576 @@ String JSON::get_parsed_text() const {
 	return text;
 }
 
+// Parser working directly on UTF-8 bytes, producing the same results and errors as the String based one.
+// Strings are scanned 8 bytes at a time, and only decoded once their extent is known.
+struct JSON::UTF8Parser {
+	struct Token {
+		TokenType type = TK_EOF;
+		double number = 0;
+		String string;
+		const uint8_t *identifier = nullptr;
+		uint32_t identifier_length = 0;
+	};
+
+	/// Object keys repeat a lot (arrays of similar objects), the same String is shared by all copies of a key.
+	struct CachedKey {
+		const uint8_t *ptr = nullptr;
+		uint32_t length = 0;
+		String string;
+	};
+
+	static constexpr uint32_t KEY_CACHE_SIZE = 256;
+	static constexpr uint32_t KEY_CACHE_MAX_LENGTH = 64;
+	static constexpr uint64_t BYTES_01 = 0x0101010101010101ULL;
+	static constexpr uint64_t BYTES_80 = 0x8080808080808080ULL;
+
+	const uint8_t *pos = nullptr;
+	const uint8_t *end = nullptr;
+	int line = 0;
+	String err_str;
+
+	LocalVector<Variant> elements; ///< Array elements being parsed, shared by every nesting level.
+	LocalVector<char> unescaped; ///< Scratch space for strings containing escape sequences.
+	LocalVector<CachedKey> key_cache;
+
+	static _FORCE_INLINE_ uint64_t _zero_bytes(uint64_t p_word) {
+		return (p_word - BYTES_01) & ~p_word & BYTES_80;
+	}
+
+	/// Non-zero if any byte of the word ends or interrupts a plain string: NUL, '"', '\\' or a line break.
+	static _FORCE_INLINE_ uint64_t _string_stop_bytes(uint64_t p_word) {
+		return _zero_bytes(p_word) | _zero_bytes(p_word ^ (BYTES_01 * '"')) | _zero_bytes(p_word ^ (BYTES_01 * '\\')) | _zero_bytes(p_word ^ (BYTES_01 * '\n'));
+	}
+
+	_FORCE_INLINE_ int _peek(int p_offset) const {
+		return pos + p_offset < end ? pos[p_offset] : 0;
+	}
+
+	void _append_utf8(char32_t p_char) {
+		if (p_char < 0x80) {
+			unescaped.push_back(char(p_char));
+		} else if (p_char < 0x800) {
+			unescaped.push_back(char(0xc0 | (p_char >> 6)));
+			unescaped.push_back(char(0x80 | (p_char & 0x3f)));
+		} else if (p_char < 0x10000) {
+			unescaped.push_back(char(0xe0 | (p_char >> 12)));
+			unescaped.push_back(char(0x80 | ((p_char >> 6) & 0x3f)));
+			unescaped.push_back(char(0x80 | (p_char & 0x3f)));
+		} else {
+			unescaped.push_back(char(0xf0 | (p_char >> 18)));
+			unescaped.push_back(char(0x80 | ((p_char >> 12) & 0x3f)));
+			unescaped.push_back(char(0x80 | ((p_char >> 6) & 0x3f)));
+			unescaped.push_back(char(0x80 | (p_char & 0x3f)));
+		}
+	}
+
+	/// Reads the 4 hex digits following `pos`.
+	Error _parse_hex(char32_t &r_value) {
+		r_value = 0;
+		for (int j = 0; j < 4; j++) {
+			const int c = _peek(j + 1);
+			if (c == 0) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			if (!is_hex_digit(c)) {
+				err_str = "Malformed hex constant in string";
+				return ERR_PARSE_ERROR;
+			}
+			r_value <<= 4;
+			if (is_digit(c)) {
+				r_value |= c - '0';
+			} else if (c >= 'a' && c <= 'f') {
+				r_value |= c - 'a' + 10;
+			} else {
+				r_value |= c - 'A' + 10;
+			}
+		}
+		pos += 4;
+		return OK;
+	}
+
+	Error _parse_escaped_string(const uint8_t *p_start, String &r_string) {
+		unescaped.clear();
+		for (const uint8_t *c = p_start; c < pos; c++) {
+			unescaped.push_back(char(*c));
+		}
+
+		while (true) {
+			const int c = _peek(0);
+			if (c == 0) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			if (c == '"') {
+				pos++;
+				break;
+			}
+			if (c != '\\') {
+				if (c == '\n') {
+					line++;
+				}
+				unescaped.push_back(char(c));
+				pos++;
+				continue;
+			}
+
+			pos++;
+			const int next = _peek(0);
+			switch (next) {
+				case 0:
+					err_str = "Unterminated string";
+					return ERR_PARSE_ERROR;
+				case 'b':
+					unescaped.push_back('\b');
+					break;
+				case 't':
+					unescaped.push_back('\t');
+					break;
+				case 'n':
+					unescaped.push_back('\n');
+					break;
+				case 'f':
+					unescaped.push_back('\f');
+					break;
+				case 'r':
+					unescaped.push_back('\r');
+					break;
+				case '"':
+				case '\\':
+				case '/':
+					unescaped.push_back(char(next));
+					break;
+				case 'u': {
+					char32_t res;
+					Error err = _parse_hex(res);
+					if (err != OK) {
+						return err;
+					}
+					if ((res & 0xfffffc00) == 0xd800) {
+						if (_peek(1) != '\\' || _peek(2) != 'u') {
+							err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							return ERR_PARSE_ERROR;
+						}
+						pos += 2;
+						char32_t trail;
+						err = _parse_hex(trail);
+						if (err != OK) {
+							return err;
+						}
+						if ((trail & 0xfffffc00) != 0xdc00) {
+							err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							return ERR_PARSE_ERROR;
+						}
+						res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+					} else if ((res & 0xfffffc00) == 0xdc00) {
+						err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
+						return ERR_PARSE_ERROR;
+					}
+					_append_utf8(res);
+				} break;
+				default:
+					err_str = "Invalid escape sequence";
+					return ERR_PARSE_ERROR;
+			}
+			pos++;
+		}
+
+		r_string = String::utf8(unescaped.ptr(), unescaped.size());
+		return OK;
+	}
+
+	Error _parse_string(String &r_string, bool p_key) {
+		const uint8_t *start = pos;
+		uint64_t high_bits = 0;
+		while (true) {
+			while (end - pos >= 8) {
+				uint64_t word;
+				memcpy(&word, pos, 8);
+				if (_string_stop_bytes(word)) {
+					break;
+				}
+				high_bits |= word;
+				pos += 8;
+			}
+			if (pos >= end || *pos == 0) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			const uint8_t c = *pos;
+			if (c == '"') {
+				break;
+			}
+			if (c == '\\') {
+				return _parse_escaped_string(start, r_string);
+			}
+			if (c == '\n') {
+				line++;
+			}
+			high_bits |= c;
+			pos++;
+		}
+
+		const uint32_t length = pos - start;
+		pos++;
+
+		CachedKey *cached = nullptr;
+		if (p_key && length <= KEY_CACHE_MAX_LENGTH) {
+			if (key_cache.is_empty()) {
+				key_cache.resize(KEY_CACHE_SIZE);
+			}
+			cached = &key_cache[hash_djb2_buffer(start, length) & (KEY_CACHE_SIZE - 1)];
+			if (cached->ptr && cached->length == length && memcmp(cached->ptr, start, length) == 0) {
+				r_string = cached->string;
+				return OK;
+			}
+		}
+
+		if (high_bits & BYTES_80) {
+			r_string = String::utf8((const char *)start, length);
+		} else {
+			r_string = String::latin1(Span<char>((const char *)start, length));
+		}
+
+		if (cached) {
+			cached->ptr = start;
+			cached->length = length;
+			cached->string = r_string;
+		}
+		return OK;
+	}
+
+	void _parse_number(double &r_number) {
+		const uint8_t *start = pos;
+
+		// Short integers are exact in a double, no need for the general conversion.
+		const uint8_t *p = pos;
+		const bool negative = *p == '-';
+		if (negative) {
+			p++;
+		}
+		const uint8_t *digits = p;
+		uint64_t value = 0;
+		while (p < end && is_digit(*p) && p - digits < 16) {
+			value = value * 10 + (*p - '0');
+			p++;
+		}
+		const int64_t digit_count = p - digits;
+		if (digit_count > 0 && digit_count <= 15 && (p >= end || (!is_digit(*p) && *p != '.' && *p != 'e' && *p != 'E'))) {
+			r_number = negative ? -double(value) : double(value);
+			pos = p;
+			return;
+		}
+
+		// General case: same conversion as the String parser, on a copy of the characters up to the next separator.
+		const uint8_t *q = start;
+		while (q < end && *q > 32 && *q < 128 && *q != ',' && *q != ']' && *q != '}' && *q != ':' && *q != '"' && *q != '[' && *q != '{') {
+			q++;
+		}
+		const int64_t length = q - start;
+		char32_t buffer[64];
+		LocalVector<char32_t> long_buffer;
+		char32_t *chars = buffer;
+		if (length >= 64) {
+			long_buffer.resize(length + 1);
+			chars = long_buffer.ptr();
+		}
+		for (int64_t i = 0; i < length; i++) {
+			chars[i] = start[i];
+		}
+		chars[length] = 0;
+
+		const char32_t *number_end;
+		r_number = String::to_float(chars, &number_end);
+		pos = start + (number_end - chars);
+	}
+
+	Error get_token(Token &r_token, bool p_key = false) {
+		while (true) {
+			if (pos >= end) {
+				r_token.type = TK_EOF;
+				return OK;
+			}
+			const uint8_t c = *pos;
+			switch (c) {
+				case '\n':
+					line++;
+					pos++;
+					break;
+				case 0:
+					r_token.type = TK_EOF;
+					return OK;
+				case '{':
+					r_token.type = TK_CURLY_BRACKET_OPEN;
+					pos++;
+					return OK;
+				case '}':
+					r_token.type = TK_CURLY_BRACKET_CLOSE;
+					pos++;
+					return OK;
+				case '[':
+					r_token.type = TK_BRACKET_OPEN;
+					pos++;
+					return OK;
+				case ']':
+					r_token.type = TK_BRACKET_CLOSE;
+					pos++;
+					return OK;
+				case ':':
+					r_token.type = TK_COLON;
+					pos++;
+					return OK;
+				case ',':
+					r_token.type = TK_COMMA;
+					pos++;
+					return OK;
+				case '"':
+					pos++;
+					r_token.type = TK_STRING;
+					return _parse_string(r_token.string, p_key);
+				default:
+					if (c <= 32) {
+						pos++;
+						break;
+					}
+					if (c == '-' || is_digit(c)) {
+						r_token.type = TK_NUMBER;
+						_parse_number(r_token.number);
+						return OK;
+					}
+					if (is_ascii_alphabet_char(c)) {
+						r_token.type = TK_IDENTIFIER;
+						r_token.identifier = pos;
+						while (pos < end && is_ascii_alphabet_char(*pos)) {
+							pos++;
+						}
+						r_token.identifier_length = pos - r_token.identifier;
+						return OK;
+					}
+					err_str = "Unexpected character";
+					return ERR_PARSE_ERROR;
+			}
+		}
+	}
+
+	bool _identifier_is(const Token &p_token, const char *p_name, uint32_t p_length) const {
+		return p_token.identifier_length == p_length && memcmp(p_token.identifier, p_name, p_length) == 0;
+	}
+
+	Error parse_value(Variant &r_value, Token &p_token, int p_depth) {
+		if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+			err_str = "JSON structure is too deep";
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		switch (p_token.type) {
+			case TK_CURLY_BRACKET_OPEN: {
+				Dictionary d;
+				Error err = parse_object(d, p_depth + 1);
+				if (err) {
+					return err;
+				}
+				r_value = d;
+			} break;
+			case TK_BRACKET_OPEN: {
+				Array a;
+				Error err = parse_array(a, p_depth + 1);
+				if (err) {
+					return err;
+				}
+				r_value = a;
+			} break;
+			case TK_IDENTIFIER: {
+				if (_identifier_is(p_token, "true", 4)) {
+					r_value = true;
+				} else if (_identifier_is(p_token, "false", 5)) {
+					r_value = false;
+				} else if (_identifier_is(p_token, "null", 4)) {
+					r_value = Variant();
+				} else {
+					err_str = vformat("Expected 'true', 'false', or 'null', got '%s'", String::latin1(Span<char>((const char *)p_token.identifier, p_token.identifier_length)));
+					return ERR_PARSE_ERROR;
+				}
+			} break;
+			case TK_NUMBER:
+				r_value = p_token.number;
+				break;
+			case TK_STRING:
+				r_value = p_token.string;
+				break;
+			default:
+				err_str = vformat("Expected value, got '%s'", String(tk_name[p_token.type]));
+				return ERR_PARSE_ERROR;
+		}
+		return OK;
+	}
+
+	Error parse_array(Array &r_array, int p_depth) {
+		const uint32_t first = elements.size();
+		Token token;
+		bool need_comma = false;
+
+		while (pos < end) {
+			Error err = get_token(token);
+			if (err != OK) {
+				elements.resize(first);
+				return err;
+			}
+
+			if (token.type == TK_BRACKET_CLOSE) {
+				// Elements were gathered on the shared stack, so the array is allocated once at its final size.
+				const uint32_t count = elements.size() - first;
+				r_array.resize(count);
+				for (uint32_t i = 0; i < count; i++) {
+					r_array.set(i, elements[first + i]);
+				}
+				elements.resize(first);
+				return OK;
+			}
+
+			if (need_comma) {
+				if (token.type != TK_COMMA) {
+					err_str = "Expected ','";
+					elements.resize(first);
+					return ERR_PARSE_ERROR;
+				}
+				need_comma = false;
+				continue;
+			}
+
+			Variant v;
+			err = parse_value(v, token, p_depth);
+			if (err) {
+				elements.resize(first);
+				return err;
+			}
+			elements.push_back(v);
+			need_comma = true;
+		}
+
+		elements.resize(first);
+		err_str = "Expected ']'";
+		return ERR_PARSE_ERROR;
+	}
+
+	Error parse_object(Dictionary &r_object, int p_depth) {
+		Token token;
+		bool need_comma = false;
+
+		while (pos < end) {
+			Error err = get_token(token, !need_comma);
+			if (err != OK) {
+				return err;
+			}
+
+			if (token.type == TK_CURLY_BRACKET_CLOSE) {
+				return OK;
+			}
+
+			if (need_comma) {
+				if (token.type != TK_COMMA) {
+					err_str = "Expected '}' or ','";
+					return ERR_PARSE_ERROR;
+				}
+				need_comma = false;
+				continue;
+			}
+
+			if (token.type != TK_STRING) {
+				err_str = "Expected key";
+				return ERR_PARSE_ERROR;
+			}
+
+			const String key = token.string;
+			err = get_token(token);
+			if (err != OK) {
+				return err;
+			}
+			if (token.type != TK_COLON) {
+				err_str = "Expected ':'";
+				return ERR_PARSE_ERROR;
+			}
+
+			if (pos >= end) {
+				break;
+			}
+			err = get_token(token);
+			if (err != OK) {
+				return err;
+			}
+			Variant v;
+			err = parse_value(v, token, p_depth);
+			if (err) {
+				return err;
+			}
+			r_object[key] = v;
+			need_comma = true;
+		}
+
+		err_str = "Expected '}'";
+		return ERR_PARSE_ERROR;
+	}
+
+	Error parse(Variant &r_ret) {
+		if (pos >= end) {
+			err_str = "Unknown error getting token";
+			return ERR_PARSE_ERROR;
+		}
+
+		// Skip the byte order mark, as String decoding does.
+		if (end - pos >= 3 && pos[0] == 0xef && pos[1] == 0xbb && pos[2] == 0xbf) {
+			pos += 3;
+		}
+
+		Token token;
+		Error err = get_token(token);
+		if (err) {
+			return err;
+		}
+
+		err = parse_value(r_ret, token, 0);
+
+		// Check if EOF is reached
+		// or it's a type of the next token.
+		if (err == OK && pos < end) {
+			err = get_token(token);
+
+			if (err || token.type != TK_EOF) {
+				err_str = "Expected 'EOF'";
+				// Reset return value to empty `Variant`
+				r_ret = Variant();
+				return ERR_PARSE_ERROR;
+			}
+		}
+
+		return err;
+	}
+};
+
+Error JSON::parse_utf8(const uint8_t *p_utf8, int64_t p_size, bool p_keep_text) {
+	UTF8Parser parser;
+	parser.pos = p_utf8;
+	parser.end = p_utf8 + p_size;
+
+	Error err = parser.parse(data);
+	err_str = parser.err_str;
+	err_line = err == OK ? 0 : parser.line;
+	if (p_keep_text) {
+		text = String::utf8((const char *)p_utf8, p_size);
+	}
+	return err;
+}
+
+Error JSON::parse_utf8(const PackedByteArray &p_utf8, bool p_keep_text) {
+	return parse_utf8(p_utf8.ptr(), p_utf8.size(), p_keep_text);
+}
+
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	String result;
+	// Pieces are collected and copied once at the end, rather than growing the result string on every append.
+	StringBuilder result;
 	HashSet<const void *> markers;
 	_stringify(result, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
-	return result;
+	return result.as_string();
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -617,6 +1199,7 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8", "json_utf8", "keep_text"), static_cast<Error (JSON::*)(const PackedByteArray &, bool)>(&JSON::parse_utf8), DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -1580,7 +2163,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_utf8(FileAccess::get_file_as_bytes(p_path), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
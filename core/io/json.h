@@ -43,6 +43,8 @@
 #include "core/io/resource_saver.h"
 #include "core/variant/variant.h"
 
+class StringBuilder;
+
 class JSON : public Resource {
 	GDCLASS(JSON, Resource);
 
@@ -79,8 +81,10 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static void _add_indent(String &r_result, const String &p_indent, int p_size);
-	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
+	struct UTF8Parser;
+
+	static void _add_indent(StringBuilder &r_result, const String &p_indent, int p_size);
+	static void _stringify(StringBuilder &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
 	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
 	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
@@ -95,6 +99,9 @@ protected:
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	/// Same as `parse()`, reading UTF-8 text directly instead of decoding it to a String first.
+	Error parse_utf8(const uint8_t *p_utf8, int64_t p_size, bool p_keep_text = false);
+	Error parse_utf8(const PackedByteArray &p_utf8, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
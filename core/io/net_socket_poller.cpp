@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*  net_socket_poller.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file net_socket_poller.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "net_socket_poller.h"
+
+#include "core/os/os.h"
+
+NetSocketPoller *(*NetSocketPoller::_create)() = nullptr;
+
+Ref<NetSocketPoller> NetSocketPoller::create() {
+	if (_create) {
+		return Ref<NetSocketPoller>(_create());
+	}
+	return memnew(NetSocketPollerGeneric);
+}
+
+Error NetSocketPollerGeneric::add_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) {
+	ERR_FAIL_COND_V(p_socket.is_null() || !p_socket->is_open(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(sockets.has(p_socket.ptr()), ERR_ALREADY_EXISTS);
+
+	Entry &e = sockets[p_socket.ptr()];
+	e.socket = p_socket;
+	e.id = p_id;
+	e.events = p_events;
+	return OK;
+}
+
+Error NetSocketPollerGeneric::modify_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) {
+	ERR_FAIL_COND_V(p_socket.is_null(), ERR_INVALID_PARAMETER);
+	Entry *e = sockets.getptr(p_socket.ptr());
+	ERR_FAIL_NULL_V(e, ERR_DOES_NOT_EXIST);
+
+	e->id = p_id;
+	e->events = p_events;
+	return OK;
+}
+
+void NetSocketPollerGeneric::remove_socket(const Ref<NetSocket> &p_socket) {
+	ERR_FAIL_COND(p_socket.is_null());
+	sockets.erase(p_socket.ptr());
+}
+
+bool NetSocketPollerGeneric::has_socket(const Ref<NetSocket> &p_socket) const {
+	return p_socket.is_valid() && sockets.has(p_socket.ptr());
+}
+
+Error NetSocketPollerGeneric::wait(int p_timeout, LocalVector<Event> &r_events) {
+	r_events.clear();
+
+	const uint64_t until = p_timeout > 0 ? OS::get_singleton()->get_ticks_msec() + p_timeout : 0;
+	while (true) {
+		for (const KeyValue<NetSocket *, Entry> &E : sockets) {
+			const Entry &entry = E.value;
+			if (!entry.socket->is_open()) {
+				continue;
+			}
+
+			uint32_t ready = 0;
+			for (uint32_t type : { (uint32_t)EVENT_IN, (uint32_t)EVENT_OUT }) {
+				if (!(entry.events & type)) {
+					continue;
+				}
+				Error err = entry.socket->poll(type == EVENT_IN ? NetSocket::POLL_TYPE_IN : NetSocket::POLL_TYPE_OUT, 0);
+				if (err == OK) {
+					ready |= type;
+				} else if (err != ERR_BUSY) {
+					ready |= EVENT_ERROR;
+				}
+			}
+			if (ready) {
+				r_events.push_back({ entry.id, ready });
+			}
+		}
+
+		if (!r_events.is_empty() || p_timeout == 0 || sockets.is_empty()) {
+			break;
+		}
+		if (p_timeout > 0 && OS::get_singleton()->get_ticks_msec() >= until) {
+			break;
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+
+	return r_events.is_empty() ? ERR_BUSY : OK;
+}
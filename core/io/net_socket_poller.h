@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*  net_socket_poller.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file net_socket_poller.h
+ *
+ * @brief Readiness polling for many sockets at once.
+ */
+
+#include "core/io/net_socket.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+/// Waits on many NetSockets with a single call, so servers with lots of mostly idle peers
+/// only pay for the sockets that are actually ready. Platforms provide an implementation
+/// backed by their native multiplexer (e.g. epoll), otherwise each socket is polled in turn.
+class NetSocketPoller : public RefCounted {
+protected:
+	static NetSocketPoller *(*_create)();
+
+public:
+	static Ref<NetSocketPoller> create();
+
+	enum EventFlags : uint32_t {
+		EVENT_IN = 1 << 0, ///< Readable, or the remote end closed the connection.
+		EVENT_OUT = 1 << 1, ///< Writable.
+		EVENT_ERROR = 1 << 2, ///< Socket error, always reported.
+	};
+
+	struct Event {
+		uint64_t id = 0; ///< Identifier given when the socket was added.
+		uint32_t events = 0; ///< Combination of `EventFlags`.
+	};
+
+	/// Registers an open socket, watching for `p_events` (`EVENT_IN`, `EVENT_OUT` or both).
+	/// @note Remove sockets before closing them.
+	virtual Error add_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) = 0;
+	virtual Error modify_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) = 0;
+	virtual void remove_socket(const Ref<NetSocket> &p_socket) = 0;
+	virtual bool has_socket(const Ref<NetSocket> &p_socket) const = 0;
+	virtual int get_socket_count() const = 0;
+	virtual void clear() = 0;
+
+	/// Waits up to `p_timeout` milliseconds (`0` returns immediately, `-1` waits forever) for registered sockets to become ready.
+	/// `r_events` is cleared and filled with the ready sockets. Returns `ERR_BUSY` on timeout.
+	virtual Error wait(int p_timeout, LocalVector<Event> &r_events) = 0;
+
+	virtual ~NetSocketPoller() {}
+};
+
+/// Portable fallback, polling every registered socket through `NetSocket::poll()`.
+class NetSocketPollerGeneric : public NetSocketPoller {
+	struct Entry {
+		Ref<NetSocket> socket;
+		uint64_t id = 0;
+		uint32_t events = 0;
+	};
+
+	HashMap<NetSocket *, Entry> sockets;
+
+public:
+	virtual Error add_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) override;
+	virtual Error modify_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) override;
+	virtual void remove_socket(const Ref<NetSocket> &p_socket) override;
+	virtual bool has_socket(const Ref<NetSocket> &p_socket) const override;
+	virtual int get_socket_count() const override { return sockets.size(); }
+	virtual void clear() override { sockets.clear(); }
+
+	virtual Error wait(int p_timeout, LocalVector<Event> &r_events) override;
+};
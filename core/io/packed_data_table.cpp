@@ -0,0 +1,779 @@
+/**************************************************************************/
+/*  packed_data_table.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+/**
+ * @file packed_data_table.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "packed_data_table.h"
+
+#include "core/io/marshalls.h"
+#include "core/templates/hashfuncs.h"
+
+static _FORCE_INLINE_ uint32_t _hash_string_key(const uint8_t *p_bytes, uint32_t p_length) {
+	return hash_murmur3_buffer(p_bytes, p_length);
+}
+
+static void _align_8(LocalVector<uint8_t> &r_out) {
+	while (r_out.size() % 8) {
+		r_out.push_back(0);
+	}
+}
+
+void PackedDataTable::_clear() {
+	data.clear();
+	mapped_file.unref();
+	ptr = nullptr;
+	size = 0;
+	row_count = 0;
+	key_column = -1;
+	index_capacity = 0;
+	string_count = 0;
+	columns.clear();
+	column_indices.clear();
+}
+
+Error PackedDataTable::_parse() {
+	ERR_FAIL_COND_V(size < HEADER_SIZE, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V_MSG(decode_uint32(ptr) != MAGIC, ERR_FILE_UNRECOGNIZED, "Data is not a PackedDataTable.");
+	ERR_FAIL_COND_V_MSG(decode_uint32(ptr + 4) > VERSION, ERR_FILE_UNRECOGNIZED, "PackedDataTable was created by a newer version of the engine.");
+
+	row_count = decode_uint32(ptr + 8);
+	const uint32_t column_count = decode_uint32(ptr + 12);
+	const uint32_t key = decode_uint32(ptr + 16);
+	index_capacity = decode_uint32(ptr + 20);
+	string_count = decode_uint32(ptr + 24);
+	string_offsets_offset = decode_uint64(ptr + 32);
+	string_data_offset = decode_uint64(ptr + 40);
+	index_offset = decode_uint64(ptr + 48);
+	variant_data_offset = decode_uint64(ptr + 56);
+
+	// Everything accessed by queries is validated here once, queries only check offsets read from cells.
+	ERR_FAIL_COND_V(uint64_t(column_count) * COLUMN_SIZE > size - HEADER_SIZE, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(string_offsets_offset > size || (uint64_t(string_count) + 1) * 4 > size - string_offsets_offset, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(string_data_offset > size || variant_data_offset > size, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(decode_uint32(ptr + string_offsets_offset + uint64_t(string_count) * 4) > size - string_data_offset, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(index_capacity & (index_capacity - 1), ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(index_offset > size || uint64_t(index_capacity) * 8 > size - index_offset, ERR_FILE_CORRUPT);
+
+	columns.resize(column_count);
+	for (uint32_t i = 0; i < column_count; i++) {
+		const uint8_t *desc = ptr + HEADER_SIZE + i * COLUMN_SIZE;
+		Column &column = columns[i];
+		const uint32_t type = decode_uint32(desc + 4);
+		ERR_FAIL_COND_V(type >= COLUMN_TYPE_MAX, ERR_FILE_CORRUPT);
+		column.type = ColumnType(type);
+		column.data_offset = decode_uint64(desc + 8);
+		column.bitmap_offset = decode_uint64(desc + 16);
+
+		static const uint32_t cell_sizes[COLUMN_TYPE_MAX] = { 8, 8, 1, 4, 4 };
+		ERR_FAIL_COND_V(column.data_offset > size || uint64_t(row_count) * cell_sizes[type] > size - column.data_offset, ERR_FILE_CORRUPT);
+		ERR_FAIL_COND_V(column.bitmap_offset && (column.bitmap_offset > size || (uint64_t(row_count) + 7) / 8 > size - column.bitmap_offset), ERR_FILE_CORRUPT);
+
+		const uint32_t name_index = decode_uint32(desc);
+		ERR_FAIL_COND_V(name_index >= string_count, ERR_FILE_CORRUPT);
+		column.name = _get_string(name_index);
+		column_indices.insert(column.name, i);
+	}
+
+	if (key != NO_VALUE) {
+		ERR_FAIL_COND_V(key >= column_count || index_capacity == 0, ERR_FILE_CORRUPT);
+		ERR_FAIL_COND_V(columns[key].type != COLUMN_TYPE_INT && columns[key].type != COLUMN_TYPE_FLOAT && columns[key].type != COLUMN_TYPE_STRING, ERR_FILE_CORRUPT);
+		key_column = key;
+	}
+	return OK;
+}
+
+bool PackedDataTable::_get_string_bytes(uint32_t p_index, const uint8_t *&r_bytes, uint32_t &r_length) const {
+	if (p_index >= string_count) {
+		return false;
+	}
+	const uint32_t begin = decode_uint32(ptr + string_offsets_offset + p_index * 4);
+	const uint32_t end = decode_uint32(ptr + string_offsets_offset + p_index * 4 + 4);
+	ERR_FAIL_COND_V(begin > end || end > size - string_data_offset, false);
+	r_bytes = ptr + string_data_offset + begin;
+	r_length = end - begin;
+	return true;
+}
+
+String PackedDataTable::_get_string(uint32_t p_index) const {
+	const uint8_t *bytes;
+	uint32_t length;
+	if (!_get_string_bytes(p_index, bytes, length)) {
+		return String();
+	}
+	return String::utf8((const char *)bytes, length);
+}
+
+int PackedDataTable::_find_string(const CharString &p_utf8) const {
+	for (uint32_t i = 0; i < string_count; i++) {
+		const uint8_t *bytes;
+		uint32_t length;
+		if (_get_string_bytes(i, bytes, length) && length == uint32_t(p_utf8.length()) && memcmp(bytes, p_utf8.get_data(), length) == 0) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+bool PackedDataTable::_has_value(const Column &p_column, uint32_t p_row) const {
+	switch (p_column.type) {
+		case COLUMN_TYPE_STRING:
+		case COLUMN_TYPE_VARIANT:
+			return decode_uint32(ptr + p_column.data_offset + p_row * 4) != NO_VALUE;
+		default:
+			return !p_column.bitmap_offset || (ptr[p_column.bitmap_offset + p_row / 8] & (1 << (p_row % 8)));
+	}
+}
+
+Variant PackedDataTable::_get_cell(const Column &p_column, uint32_t p_row) const {
+	if (!_has_value(p_column, p_row)) {
+		return Variant();
+	}
+	switch (p_column.type) {
+		case COLUMN_TYPE_INT:
+			return int64_t(decode_uint64(ptr + p_column.data_offset + p_row * 8));
+		case COLUMN_TYPE_FLOAT:
+			return decode_double(ptr + p_column.data_offset + p_row * 8);
+		case COLUMN_TYPE_BOOL:
+			return ptr[p_column.data_offset + p_row] != 0;
+		case COLUMN_TYPE_STRING:
+			return _get_string(decode_uint32(ptr + p_column.data_offset + p_row * 4));
+		case COLUMN_TYPE_VARIANT: {
+			const uint64_t offset = variant_data_offset + decode_uint32(ptr + p_column.data_offset + p_row * 4);
+			ERR_FAIL_COND_V(offset >= size, Variant());
+			Variant value;
+			Error err = decode_variant(value, ptr + offset, int(MIN(size - offset, uint64_t(INT_MAX))), nullptr, false);
+			ERR_FAIL_COND_V_MSG(err != OK, Variant(), "Error when trying to decode Variant.");
+			return value;
+		}
+		default:
+			return Variant();
+	}
+}
+
+Error PackedDataTable::pack(const Variant &p_rows, const StringName &p_key_column) {
+	LocalVector<Dictionary> rows;
+	LocalVector<Variant> keys;
+	const bool keyed_rows = p_rows.get_type() == Variant::DICTIONARY;
+	if (p_rows.get_type() == Variant::ARRAY) {
+		const Array array = p_rows;
+		rows.reserve(array.size());
+		for (const Variant &row : array) {
+			ERR_FAIL_COND_V_MSG(row.get_type() != Variant::DICTIONARY, ERR_INVALID_DATA, "PackedDataTable rows must be Dictionaries.");
+			rows.push_back(row);
+		}
+	} else if (keyed_rows) {
+		// A Dictionary of rows is stored with its keys as an additional column.
+		ERR_FAIL_COND_V_MSG(p_key_column == StringName(), ERR_INVALID_PARAMETER, "A key column name is required to pack a Dictionary of rows.");
+		const Dictionary dict = p_rows;
+		rows.reserve(dict.size());
+		keys.reserve(dict.size());
+		for (const KeyValue<Variant, Variant> &kv : dict) {
+			ERR_FAIL_COND_V_MSG(kv.value.get_type() != Variant::DICTIONARY, ERR_INVALID_DATA, "PackedDataTable rows must be Dictionaries.");
+			keys.push_back(kv.key);
+			rows.push_back(kv.value);
+		}
+	} else {
+		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "PackedDataTable can pack only an Array or a Dictionary of rows.");
+	}
+
+	struct ColumnInfo {
+		StringName name;
+		Variant::Type type = Variant::NIL;
+		bool mixed = false;
+		uint32_t present = 0;
+		ColumnType column_type = COLUMN_TYPE_VARIANT;
+	};
+	LocalVector<ColumnInfo> infos;
+	HashMap<StringName, uint32_t> info_indices;
+
+	auto add_value = [&](ColumnInfo &r_info, const Variant &p_value) {
+		if (p_value.get_type() == Variant::NIL) {
+			return;
+		}
+		if (r_info.type == Variant::NIL) {
+			r_info.type = p_value.get_type();
+		} else if (r_info.type != p_value.get_type()) {
+			r_info.mixed = true;
+		}
+		r_info.present++;
+	};
+
+	if (keyed_rows) {
+		infos.push_back(ColumnInfo());
+		infos[0].name = p_key_column;
+		info_indices.insert(p_key_column, 0);
+		for (const Variant &key : keys) {
+			add_value(infos[0], key);
+		}
+	}
+
+	// Columns are discovered in the order they first appear in.
+	for (const Dictionary &row : rows) {
+		for (const KeyValue<Variant, Variant> &kv : row) {
+			ERR_FAIL_COND_V_MSG(kv.key.get_type() != Variant::STRING && kv.key.get_type() != Variant::STRING_NAME, ERR_INVALID_DATA, "PackedDataTable column names must be Strings.");
+			const StringName column_name = kv.key;
+			const uint32_t *index = info_indices.getptr(column_name);
+			if (keyed_rows && index && *index == 0) {
+				continue; // Overridden by the Dictionary key.
+			}
+			if (!index) {
+				info_indices.insert(column_name, infos.size());
+				infos.push_back(ColumnInfo());
+				infos[infos.size() - 1].name = column_name;
+				index = info_indices.getptr(column_name);
+			}
+			add_value(infos[*index], kv.value);
+		}
+	}
+
+	for (ColumnInfo &info : infos) {
+		if (info.mixed) {
+			continue;
+		}
+		switch (info.type) {
+			case Variant::INT:
+				info.column_type = COLUMN_TYPE_INT;
+				break;
+			case Variant::FLOAT:
+				info.column_type = COLUMN_TYPE_FLOAT;
+				break;
+			case Variant::BOOL:
+				info.column_type = COLUMN_TYPE_BOOL;
+				break;
+			case Variant::STRING:
+				info.column_type = COLUMN_TYPE_STRING;
+				break;
+			default:
+				break;
+		}
+	}
+
+	int key = -1;
+	if (p_key_column != StringName()) {
+		const uint32_t *index = info_indices.getptr(p_key_column);
+		ERR_FAIL_NULL_V_MSG(index, ERR_INVALID_PARAMETER, vformat("Key column \"%s\" is not present in the rows.", p_key_column));
+		const ColumnInfo &info = infos[*index];
+		ERR_FAIL_COND_V_MSG(info.column_type != COLUMN_TYPE_INT && info.column_type != COLUMN_TYPE_FLOAT && info.column_type != COLUMN_TYPE_STRING, ERR_INVALID_DATA, "Key column values must all be ints, all floats or all Strings.");
+		ERR_FAIL_COND_V_MSG(info.present != rows.size(), ERR_INVALID_DATA, "Every row must have a key.");
+		key = *index;
+	}
+
+	auto get_cell = [&](uint32_t p_row, uint32_t p_column) -> Variant {
+		if (p_column == 0 && keyed_rows) {
+			return keys[p_row];
+		}
+		return rows[p_row].get(infos[p_column].name, Variant());
+	};
+
+	HashMap<String, uint32_t> string_ids;
+	LocalVector<CharString> strings;
+	auto intern = [&](const String &p_string) -> uint32_t {
+		const uint32_t *id = string_ids.getptr(p_string);
+		if (id) {
+			return *id;
+		}
+		string_ids.insert(p_string, strings.size());
+		strings.push_back(p_string.utf8());
+		return strings.size() - 1;
+	};
+
+	LocalVector<uint8_t> out;
+	LocalVector<uint8_t> variant_data;
+	out.resize(HEADER_SIZE + infos.size() * COLUMN_SIZE);
+	memset(out.ptr(), 0, out.size());
+
+	for (uint32_t c = 0; c < infos.size(); c++) {
+		const ColumnInfo &info = infos[c];
+		const uint32_t row_total = rows.size();
+		_align_8(out);
+		const uint64_t data_offset = out.size();
+		uint64_t bitmap_offset = 0;
+
+		uint8_t *desc = out.ptr() + HEADER_SIZE + c * COLUMN_SIZE;
+		encode_uint32(intern(info.name), desc);
+		encode_uint32(info.column_type, desc + 4);
+
+		switch (info.column_type) {
+			case COLUMN_TYPE_INT:
+			case COLUMN_TYPE_FLOAT: {
+				out.resize(data_offset + row_total * 8);
+				for (uint32_t r = 0; r < row_total; r++) {
+					const Variant value = get_cell(r, c);
+					if (info.column_type == COLUMN_TYPE_INT) {
+						encode_uint64(value.get_type() == Variant::INT ? uint64_t(int64_t(value)) : 0, out.ptr() + data_offset + r * 8);
+					} else {
+						encode_double(value.get_type() == Variant::FLOAT ? double(value) : 0.0, out.ptr() + data_offset + r * 8);
+					}
+				}
+			} break;
+			case COLUMN_TYPE_BOOL: {
+				out.resize(data_offset + row_total);
+				for (uint32_t r = 0; r < row_total; r++) {
+					out[data_offset + r] = get_cell(r, c).operator bool() ? 1 : 0;
+				}
+			} break;
+			case COLUMN_TYPE_STRING:
+			case COLUMN_TYPE_VARIANT: {
+				out.resize(data_offset + row_total * 4);
+				for (uint32_t r = 0; r < row_total; r++) {
+					const Variant value = get_cell(r, c);
+					uint32_t cell = NO_VALUE;
+					if (value.get_type() == Variant::NIL) {
+						// Missing value.
+					} else if (info.column_type == COLUMN_TYPE_STRING) {
+						cell = intern(value);
+					} else {
+						ERR_FAIL_COND_V_MSG(variant_data.size() >= NO_VALUE, ERR_OUT_OF_MEMORY, "PackedDataTable variant data is too large.");
+						cell = variant_data.size();
+						int len;
+						Error err = encode_variant(value, nullptr, len, false);
+						ERR_FAIL_COND_V(err != OK, err);
+						variant_data.resize(cell + len);
+						encode_variant(value, variant_data.ptr() + cell, len, false);
+					}
+					encode_uint32(cell, out.ptr() + data_offset + r * 4);
+				}
+			} break;
+			default:
+				break;
+		}
+
+		if (info.column_type != COLUMN_TYPE_STRING && info.column_type != COLUMN_TYPE_VARIANT && info.present < row_total) {
+			bitmap_offset = out.size();
+			out.resize(bitmap_offset + (row_total + 7) / 8);
+			memset(out.ptr() + bitmap_offset, 0, (row_total + 7) / 8);
+			for (uint32_t r = 0; r < row_total; r++) {
+				if (get_cell(r, c).get_type() != Variant::NIL) {
+					out[bitmap_offset + r / 8] |= 1 << (r % 8);
+				}
+			}
+		}
+
+		desc = out.ptr() + HEADER_SIZE + c * COLUMN_SIZE;
+		encode_uint64(data_offset, desc + 8);
+		encode_uint64(bitmap_offset, desc + 16);
+	}
+
+	_align_8(out);
+	const uint64_t strings_offset = out.size();
+	out.resize(strings_offset + (strings.size() + 1) * 4);
+	uint32_t string_position = 0;
+	for (uint32_t i = 0; i < strings.size(); i++) {
+		encode_uint32(string_position, out.ptr() + strings_offset + i * 4);
+		string_position += strings[i].length();
+	}
+	encode_uint32(string_position, out.ptr() + strings_offset + strings.size() * 4);
+	const uint64_t string_data = out.size();
+	for (const CharString &str : strings) {
+		const uint32_t position = out.size();
+		out.resize(position + str.length());
+		memcpy(out.ptr() + position, str.get_data(), str.length());
+	}
+
+	_align_8(out);
+	const uint64_t index = out.size();
+	uint32_t capacity = 0;
+	if (key >= 0) {
+		// Half full at most, so probe sequences stay short.
+		capacity = next_power_of_2(MAX(uint32_t(rows.size()) * 2, 2u));
+		out.resize(index + uint64_t(capacity) * 8);
+		memset(out.ptr() + index, 0, uint64_t(capacity) * 8);
+		for (uint32_t r = 0; r < rows.size(); r++) {
+			const Variant value = get_cell(r, key);
+			uint32_t hash;
+			switch (infos[key].column_type) {
+				case COLUMN_TYPE_INT:
+					hash = hash_murmur3_one_64(int64_t(value));
+					break;
+				case COLUMN_TYPE_FLOAT:
+					hash = hash_murmur3_one_double(value);
+					break;
+				default: {
+					const CharString &str = strings[*string_ids.getptr(value)];
+					hash = _hash_string_key((const uint8_t *)str.get_data(), str.length());
+				} break;
+			}
+			uint32_t slot = hash & (capacity - 1);
+			while (decode_uint32(out.ptr() + index + slot * 8 + 4) != 0) {
+				const uint32_t other = decode_uint32(out.ptr() + index + slot * 8 + 4) - 1;
+				ERR_FAIL_COND_V_MSG(decode_uint32(out.ptr() + index + slot * 8) == hash && get_cell(other, key) == value, ERR_INVALID_DATA, vformat("Duplicate key \"%s\" in rows.", value));
+				slot = (slot + 1) & (capacity - 1);
+			}
+			encode_uint32(hash, out.ptr() + index + slot * 8);
+			encode_uint32(r + 1, out.ptr() + index + slot * 8 + 4);
+		}
+	}
+
+	const uint64_t variants = out.size();
+	out.resize(variants + variant_data.size());
+	if (variant_data.size()) {
+		memcpy(out.ptr() + variants, variant_data.ptr(), variant_data.size());
+	}
+
+	encode_uint32(MAGIC, out.ptr());
+	encode_uint32(VERSION, out.ptr() + 4);
+	encode_uint32(rows.size(), out.ptr() + 8);
+	encode_uint32(infos.size(), out.ptr() + 12);
+	encode_uint32(key >= 0 ? uint32_t(key) : NO_VALUE, out.ptr() + 16);
+	encode_uint32(capacity, out.ptr() + 20);
+	encode_uint32(strings.size(), out.ptr() + 24);
+	encode_uint64(strings_offset, out.ptr() + 32);
+	encode_uint64(string_data, out.ptr() + 40);
+	encode_uint64(index, out.ptr() + 48);
+	encode_uint64(variants, out.ptr() + 56);
+
+	Vector<uint8_t> packed;
+	packed.resize(out.size());
+	memcpy(packed.ptrw(), out.ptr(), out.size());
+	_set_data(packed);
+	return OK;
+}
+
+Ref<PackedDataTable> PackedDataTable::open(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), Ref<PackedDataTable>(), vformat("Can't open PackedDataTable file at path: '%s'.", p_path));
+
+	Ref<PackedDataTable> table;
+	table.instantiate();
+	const uint64_t length = f->get_length();
+	const Span<uint8_t> view = f->get_buffer_view(length);
+	if (length > 0 && view.size() == length) {
+		// Queries read the mapping directly, only the pages actually used get loaded.
+		table->mapped_file = f;
+		table->ptr = view.ptr();
+		table->size = length;
+	} else {
+		table->data = f->get_buffer(length);
+		table->ptr = table->data.ptr();
+		table->size = table->data.size();
+	}
+
+	err = table->_parse();
+	if (err != OK) {
+		ERR_PRINT(vformat("Failed to open PackedDataTable file at path: '%s'.", p_path));
+		return Ref<PackedDataTable>();
+	}
+	return table;
+}
+
+Error PackedDataTable::save_to_file(const String &p_path) const {
+	ERR_FAIL_COND_V_MSG(!ptr, ERR_UNCONFIGURED, "PackedDataTable is empty, pack some rows first.");
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Can't open PackedDataTable file for writing at path: '%s'.", p_path));
+	f->store_buffer(ptr, size);
+	return f->get_error();
+}
+
+void PackedDataTable::_set_data(const Vector<uint8_t> &p_data) {
+	_clear();
+	data = p_data;
+	ptr = data.ptr();
+	size = data.size();
+	if (size == 0) {
+		return;
+	}
+	if (_parse() != OK) {
+		_clear();
+		ERR_FAIL_MSG("Invalid PackedDataTable data.");
+	}
+}
+
+Vector<uint8_t> PackedDataTable::_get_data() const {
+	if (mapped_file.is_null()) {
+		return data;
+	}
+	Vector<uint8_t> copy;
+	copy.resize(size);
+	memcpy(copy.ptrw(), ptr, size);
+	return copy;
+}
+
+StringName PackedDataTable::get_column_name(int p_column) const {
+	ERR_FAIL_INDEX_V(p_column, int(columns.size()), StringName());
+	return columns[p_column].name;
+}
+
+PackedDataTable::ColumnType PackedDataTable::get_column_type(int p_column) const {
+	ERR_FAIL_INDEX_V(p_column, int(columns.size()), COLUMN_TYPE_VARIANT);
+	return columns[p_column].type;
+}
+
+int PackedDataTable::get_column_index(const StringName &p_name) const {
+	const int *index = column_indices.getptr(p_name);
+	return index ? *index : -1;
+}
+
+StringName PackedDataTable::get_key_column() const {
+	return key_column >= 0 ? columns[key_column].name : StringName();
+}
+
+int PackedDataTable::find_row(const Variant &p_key) const {
+	ERR_FAIL_COND_V_MSG(key_column < 0, -1, "PackedDataTable has no key column.");
+	const Column &column = columns[key_column];
+
+	int64_t int_key = 0;
+	double float_key = 0;
+	CharString string_key;
+	uint32_t hash;
+	switch (column.type) {
+		case COLUMN_TYPE_INT: {
+			if (p_key.get_type() == Variant::INT) {
+				int_key = p_key;
+			} else if (p_key.get_type() == Variant::FLOAT && double(p_key) == Math::floor(double(p_key))) {
+				int_key = int64_t(double(p_key));
+			} else {
+				return -1;
+			}
+			hash = hash_murmur3_one_64(int_key);
+		} break;
+		case COLUMN_TYPE_FLOAT: {
+			if (p_key.get_type() != Variant::INT && p_key.get_type() != Variant::FLOAT) {
+				return -1;
+			}
+			float_key = p_key;
+			hash = hash_murmur3_one_double(float_key);
+		} break;
+		default: {
+			if (p_key.get_type() != Variant::STRING && p_key.get_type() != Variant::STRING_NAME) {
+				return -1;
+			}
+			string_key = String(p_key).utf8();
+			hash = _hash_string_key((const uint8_t *)string_key.get_data(), string_key.length());
+		} break;
+	}
+
+	const uint8_t *index = ptr + index_offset;
+	const uint32_t mask = index_capacity - 1;
+	uint32_t slot = hash & mask;
+	for (uint32_t probe = 0; probe < index_capacity; probe++) {
+		const uint32_t entry = decode_uint32(index + slot * 8 + 4);
+		if (entry == 0 || entry > row_count) {
+			return -1;
+		}
+		if (decode_uint32(index + slot * 8) == hash) {
+			const uint32_t row = entry - 1;
+			switch (column.type) {
+				case COLUMN_TYPE_INT: {
+					if (int64_t(decode_uint64(ptr + column.data_offset + row * 8)) == int_key) {
+						return row;
+					}
+				} break;
+				case COLUMN_TYPE_FLOAT: {
+					if (decode_double(ptr + column.data_offset + row * 8) == float_key) {
+						return row;
+					}
+				} break;
+				default: {
+					const uint8_t *bytes;
+					uint32_t length;
+					if (_get_string_bytes(decode_uint32(ptr + column.data_offset + row * 4), bytes, length) && length == uint32_t(string_key.length()) && memcmp(bytes, string_key.get_data(), length) == 0) {
+						return row;
+					}
+				} break;
+			}
+		}
+		slot = (slot + 1) & mask;
+	}
+	return -1;
+}
+
+PackedInt32Array PackedDataTable::find_rows(const StringName &p_column, const Variant &p_value) const {
+	PackedInt32Array result;
+	const int column_index = get_column_index(p_column);
+	ERR_FAIL_COND_V_MSG(column_index < 0, result, vformat("PackedDataTable has no column \"%s\".", p_column));
+	const Column &column = columns[column_index];
+
+	if (p_value.get_type() == Variant::NIL) {
+		for (uint32_t r = 0; r < row_count; r++) {
+			if (!_has_value(column, r)) {
+				result.push_back(r);
+			}
+		}
+		return result;
+	}
+
+	// Typed columns are compared in place, without creating a Variant per row.
+	switch (column.type) {
+		case COLUMN_TYPE_INT: {
+			if (p_value.get_type() != Variant::INT && p_value.get_type() != Variant::FLOAT) {
+				return result;
+			}
+			if (p_value.get_type() == Variant::INT) {
+				// Compared as integers, so values beyond 2^53 don't match their neighbors.
+				const int64_t value = p_value;
+				for (uint32_t r = 0; r < row_count; r++) {
+					if (_has_value(column, r) && int64_t(decode_uint64(ptr + column.data_offset + r * 8)) == value) {
+						result.push_back(r);
+					}
+				}
+				break;
+			}
+			const double value = p_value;
+			for (uint32_t r = 0; r < row_count; r++) {
+				if (_has_value(column, r) && double(int64_t(decode_uint64(ptr + column.data_offset + r * 8))) == value) {
+					result.push_back(r);
+				}
+			}
+		} break;
+		case COLUMN_TYPE_FLOAT: {
+			if (p_value.get_type() != Variant::INT && p_value.get_type() != Variant::FLOAT) {
+				return result;
+			}
+			const double value = p_value;
+			for (uint32_t r = 0; r < row_count; r++) {
+				if (_has_value(column, r) && decode_double(ptr + column.data_offset + r * 8) == value) {
+					result.push_back(r);
+				}
+			}
+		} break;
+		case COLUMN_TYPE_BOOL: {
+			if (p_value.get_type() != Variant::BOOL) {
+				return result;
+			}
+			const uint8_t value = p_value.operator bool() ? 1 : 0;
+			for (uint32_t r = 0; r < row_count; r++) {
+				if (_has_value(column, r) && ptr[column.data_offset + r] == value) {
+					result.push_back(r);
+				}
+			}
+		} break;
+		case COLUMN_TYPE_STRING: {
+			if (p_value.get_type() != Variant::STRING && p_value.get_type() != Variant::STRING_NAME) {
+				return result;
+			}
+			// Strings are stored once, so matching cells all reference the same entry of the string table.
+			const int string_index = _find_string(String(p_value).utf8());
+			if (string_index < 0) {
+				return result;
+			}
+			for (uint32_t r = 0; r < row_count; r++) {
+				if (decode_uint32(ptr + column.data_offset + r * 4) == uint32_t(string_index)) {
+					result.push_back(r);
+				}
+			}
+		} break;
+		default: {
+			for (uint32_t r = 0; r < row_count; r++) {
+				if (_get_cell(column, r) == p_value) {
+					result.push_back(r);
+				}
+			}
+		} break;
+	}
+	return result;
+}
+
+Variant PackedDataTable::get_value(int p_row, const StringName &p_column) const {
+	ERR_FAIL_INDEX_V(p_row, int(row_count), Variant());
+	const int column_index = get_column_index(p_column);
+	if (column_index < 0) {
+		return Variant();
+	}
+	return _get_cell(columns[column_index], p_row);
+}
+
+Variant PackedDataTable::get_value_at(int p_row, int p_column) const {
+	ERR_FAIL_INDEX_V(p_row, int(row_count), Variant());
+	ERR_FAIL_INDEX_V(p_column, int(columns.size()), Variant());
+	return _get_cell(columns[p_column], p_row);
+}
+
+Variant PackedDataTable::lookup(const Variant &p_key, const StringName &p_column) const {
+	const int row = find_row(p_key);
+	if (row < 0) {
+		return Variant();
+	}
+	return get_value(row, p_column);
+}
+
+Dictionary PackedDataTable::get_row(int p_row) const {
+	Dictionary row;
+	ERR_FAIL_INDEX_V(p_row, int(row_count), row);
+	for (const Column &column : columns) {
+		if (_has_value(column, p_row)) {
+			row[String(column.name)] = _get_cell(column, p_row);
+		}
+	}
+	return row;
+}
+
+Variant PackedDataTable::getvar(const Variant &p_key, bool *r_valid) const {
+	if (key_column >= 0) {
+		const int row = find_row(p_key);
+		if (row >= 0) {
+			if (r_valid) {
+				*r_valid = true;
+			}
+			return get_row(row);
+		}
+	}
+	return Object::getvar(p_key, r_valid);
+}
+
+void PackedDataTable::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("_set_data", "data"), &PackedDataTable::_set_data);
+	ClassDB::bind_method(D_METHOD("_get_data"), &PackedDataTable::_get_data);
+	ClassDB::bind_method(D_METHOD("pack", "rows", "key_column"), &PackedDataTable::pack, DEFVAL(StringName()));
+	ClassDB::bind_static_method("PackedDataTable", D_METHOD("open", "path"), &PackedDataTable::open);
+	ClassDB::bind_method(D_METHOD("save_to_file", "path"), &PackedDataTable::save_to_file);
+
+	ClassDB::bind_method(D_METHOD("get_row_count"), &PackedDataTable::get_row_count);
+	ClassDB::bind_method(D_METHOD("get_column_count"), &PackedDataTable::get_column_count);
+	ClassDB::bind_method(D_METHOD("get_column_name", "column"), &PackedDataTable::get_column_name);
+	ClassDB::bind_method(D_METHOD("get_column_type", "column"), &PackedDataTable::get_column_type);
+	ClassDB::bind_method(D_METHOD("get_column_index", "name"), &PackedDataTable::get_column_index);
+	ClassDB::bind_method(D_METHOD("get_key_column"), &PackedDataTable::get_key_column);
+
+	ClassDB::bind_method(D_METHOD("find_row", "key"), &PackedDataTable::find_row);
+	ClassDB::bind_method(D_METHOD("find_rows", "column", "value"), &PackedDataTable::find_rows);
+	ClassDB::bind_method(D_METHOD("get_value", "row", "column"), &PackedDataTable::get_value);
+	ClassDB::bind_method(D_METHOD("get_value_at", "row", "column"), &PackedDataTable::get_value_at);
+	ClassDB::bind_method(D_METHOD("lookup", "key", "column"), &PackedDataTable::lookup);
+	ClassDB::bind_method(D_METHOD("get_row", "row"), &PackedDataTable::get_row);
+
+	BIND_METHOD_ERR_RETURN_DOC("pack", ERR_INVALID_DATA, ERR_INVALID_PARAMETER);
+
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "__data__", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_INTERNAL), "_set_data", "_get_data");
+
+	BIND_ENUM_CONSTANT(COLUMN_TYPE_INT);
+	BIND_ENUM_CONSTANT(COLUMN_TYPE_FLOAT);
+	BIND_ENUM_CONSTANT(COLUMN_TYPE_BOOL);
+	BIND_ENUM_CONSTANT(COLUMN_TYPE_STRING);
+	BIND_ENUM_CONSTANT(COLUMN_TYPE_VARIANT);
+}
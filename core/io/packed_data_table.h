@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  packed_data_table.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+/**
+ * @file packed_data_table.h
+ *
+ * Read-only table of records stored as flat typed columns, which can be queried directly from a memory-mapped file.
+ */
+
+#include "core/io/file_access.h"
+#include "core/io/resource.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+class PackedDataTable : public Resource {
+	GDCLASS(PackedDataTable, Resource);
+
+public:
+	enum ColumnType {
+		COLUMN_TYPE_INT,
+		COLUMN_TYPE_FLOAT,
+		COLUMN_TYPE_BOOL,
+		COLUMN_TYPE_STRING,
+		COLUMN_TYPE_VARIANT,
+		COLUMN_TYPE_MAX,
+	};
+
+private:
+	/*
+	 * Layout, all values little endian and sections aligned to 8 bytes:
+	 * - Header (HEADER_SIZE bytes), then one descriptor per column (COLUMN_SIZE bytes).
+	 * - Column data: int64, double, uint8 or uint32 string/variant offset per row, followed for nullable
+	 *   int, float and bool columns by a bitmap of the rows having a value.
+	 * - String table: uint32 offsets (string count + 1), then the UTF-8 bytes.
+	 * - Key index: open addressing table of (uint32 hash, uint32 row + 1) pairs, 0 meaning an empty slot.
+	 * - `encode_variant()` data of the variant column cells.
+	 */
+	static constexpr uint32_t MAGIC = 0x54504452; // "RDPT"
+	static constexpr uint32_t VERSION = 1;
+	static constexpr uint32_t HEADER_SIZE = 64;
+	static constexpr uint32_t COLUMN_SIZE = 24;
+	static constexpr uint32_t NO_VALUE = 0xFFFFFFFF;
+
+	struct Column {
+		StringName name;
+		ColumnType type = COLUMN_TYPE_VARIANT;
+		uint64_t data_offset = 0;
+		uint64_t bitmap_offset = 0; ///< 0 when every row has a value.
+	};
+
+	Vector<uint8_t> data; ///< Owned bytes, unless the table is mapped from a file.
+	Ref<FileAccess> mapped_file; ///< Keeps the mapping alive.
+	const uint8_t *ptr = nullptr;
+	uint64_t size = 0;
+
+	uint32_t row_count = 0;
+	int key_column = -1;
+	uint32_t index_capacity = 0;
+	uint32_t string_count = 0;
+	uint64_t string_offsets_offset = 0;
+	uint64_t string_data_offset = 0;
+	uint64_t index_offset = 0;
+	uint64_t variant_data_offset = 0;
+
+	LocalVector<Column> columns;
+	HashMap<StringName, int> column_indices;
+
+	void _clear();
+	Error _parse();
+
+	bool _get_string_bytes(uint32_t p_index, const uint8_t *&r_bytes, uint32_t &r_length) const;
+	String _get_string(uint32_t p_index) const;
+	int _find_string(const CharString &p_utf8) const;
+	bool _has_value(const Column &p_column, uint32_t p_row) const;
+	Variant _get_cell(const Column &p_column, uint32_t p_row) const;
+
+protected:
+	void _set_data(const Vector<uint8_t> &p_data);
+	Vector<uint8_t> _get_data() const;
+	static void _bind_methods();
+
+public:
+	Error pack(const Variant &p_rows, const StringName &p_key_column = StringName());
+
+	/// Opens a file written by `save_to_file()`. Its contents are used in place when the file is memory-mapped.
+	static Ref<PackedDataTable> open(const String &p_path);
+	Error save_to_file(const String &p_path) const;
+
+	int get_row_count() const { return row_count; }
+	int get_column_count() const { return columns.size(); }
+	StringName get_column_name(int p_column) const;
+	ColumnType get_column_type(int p_column) const;
+	int get_column_index(const StringName &p_name) const;
+	StringName get_key_column() const;
+
+	int find_row(const Variant &p_key) const;
+	PackedInt32Array find_rows(const StringName &p_column, const Variant &p_value) const;
+	Variant get_value(int p_row, const StringName &p_column) const;
+	Variant get_value_at(int p_row, int p_column) const;
+	Variant lookup(const Variant &p_key, const StringName &p_column) const;
+	Dictionary get_row(int p_row) const;
+
+	virtual Variant getvar(const Variant &p_key, bool *r_valid = nullptr) const override;
+
+	PackedDataTable() {}
+};
+
+VARIANT_ENUM_CAST(PackedDataTable::ColumnType);
@@ -41,8 +41,10 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/property_utils.h"
 #include "scene/resources/packed_scene.h"
@@ -165,14 +167,10 @@ StringName ResourceLoaderBinary::_get_string() {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
-		}
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
-		return String::utf8(&str_buf[0], len);
+		return _get_utf8_string(len);
 	}
 
 	return string_map[id];
@@ -416,11 +414,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					}
 
 					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					const Ref<Resource> *cached = parallel ? parallel->loader->internal_index_cache.getptr(path) : internal_index_cache.getptr(path);
+					if (!cached) {
 						WARN_PRINT(vformat("Couldn't load resource (no cache): %s.", path));
 						r_v = Variant();
 					} else {
-						r_v = internal_index_cache[path];
+						r_v = *cached;
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
@@ -429,6 +428,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					String exttype = get_unicode_string();
 					String path = get_unicode_string();
 
+					if (parallel) {
+						// Loading it would re-enter ResourceLoader from a worker, let the loading thread decode this one.
+						needs_loading_thread = true;
+						break;
+					}
+
 					if (!path.contains("://") && path.is_relative_path()) {
 						// path is relative to file being loaded, so convert to a resource path
 						path = ProjectSettings::get_singleton()->localize_path(res_path.get_base_dir().path_join(path));
@@ -454,22 +459,18 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
-						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
-						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
-							Error err;
-							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
-							if (res.is_null()) {
-								if (!ResourceLoader::is_cleaning_tasks()) {
-									if (!ResourceLoader::get_abort_on_missing_resources()) {
-										ResourceLoader::notify_dependency_error(local_path, external_resources[erindex].path, external_resources[erindex].type);
-									} else {
-										error = ERR_FILE_MISSING_DEPENDENCIES;
-										ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", external_resources[erindex].path));
-									}
-								}
-							} else {
-								r_v = res;
+						// Detached decoders complete dependencies through the owning loader, so each one is waited for once.
+						ResourceLoaderBinary *owner = parallel ? parallel->loader : this;
+						Ref<Resource> res;
+						Error err = owner->_complete_external_resource(erindex, res);
+						if (err) {
+							if (!parallel) {
+								error = err;
 							}
+							return err;
+						}
+						if (res.is_valid()) {
+							r_v = res;
 						}
 					}
 				} break;
@@ -686,135 +687,441 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
+Error ResourceLoaderBinary::_instance_resource(int p_index, SubResource &r_sub_resource, bool p_defer_cache) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				r_sub_resource.skip = true;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	f->seek(offset);
 
-		if (!main) {
-			path = internal_resources[i].path;
+	String t = get_unicode_string();
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-				internal_resources.write[i].path = path; // Update path.
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					r_sub_resource.missing_resource = memnew(MissingResource);
+					r_sub_resource.missing_resource->set_original_class(t);
+					r_sub_resource.missing_resource->set_recording_properties(true);
+					obj = r_sub_resource.missing_resource;
+				} else {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
 				}
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
+			}
+
+			res = Ref<Resource>(r);
+		}
+	}
+
+	if (r) {
+		// The path is set before the properties, as some resources resolve relative paths through it while loading.
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !p_defer_cache) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
+				r_sub_resource.cache_deferred = cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE;
 			}
 		}
+		r->set_scene_unique_id(id);
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		f->seek(offset);
+	r_sub_resource.resource = res;
+	r_sub_resource.path = path;
+	r_sub_resource.properties_offset = f->get_position();
+	return OK;
+}
 
-		String t = get_unicode_string();
+void ResourceLoaderBinary::_set_resource_property(SubResource &p_sub_resource, const StringName &p_name, Variant &p_value, Dictionary &r_missing_resource_properties) {
+	const Ref<Resource> &res = p_sub_resource.resource;
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	bool set_valid = true;
+	if (p_value.get_type() == Variant::OBJECT && p_sub_resource.missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+		// If the property being set is a missing resource (and the parent is not),
+		// then setting it will most likely not work.
+		// Instead, save it as metadata.
 
-		MissingResource *missing_resource = nullptr;
+		Ref<MissingResource> mr = p_value;
+		if (mr.is_valid()) {
+			r_missing_resource_properties[p_name] = mr;
+			set_valid = false;
+		}
+	}
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+	if (p_value.get_type() == Variant::ARRAY) {
+		Array set_array = p_value;
+		bool is_get_valid = false;
+		Variant get_value = res->get(p_name, &is_get_valid);
+		if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+			Array get_array = get_value;
+			if (!set_array.is_same_typed(get_array)) {
+				p_value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+			}
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
+	}
+
+	if (p_value.get_type() == Variant::DICTIONARY) {
+		Dictionary set_dict = p_value;
+		bool is_get_valid = false;
+		Variant get_value = res->get(p_name, &is_get_valid);
+		if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+			Dictionary get_dict = get_value;
+			if (!set_dict.is_same_typed(get_dict)) {
+				p_value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+						get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
 			}
+		}
+	}
 
-			if (res.is_null()) {
-				//did not replace
+	if (set_valid) {
+		res->set(p_name, p_value);
+	}
+}
 
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
+void ResourceLoaderBinary::_finish_resource(int p_index, SubResource &p_sub_resource, const Dictionary &p_missing_resource_properties) {
+	const Ref<Resource> &res = p_sub_resource.resource;
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
-				}
+	if (p_sub_resource.cache_deferred) {
+		// Only the path was set so far, so other loads could not find the resource in the cache while it was incomplete.
+		res->set_path_cache(String());
+		res->set_path(p_sub_resource.path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE);
+	}
+
+	if (p_sub_resource.missing_resource) {
+		p_sub_resource.missing_resource->set_recording_properties(false);
+	}
+
+	if (!p_missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, p_missing_resource_properties);
+	}
+
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
+
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+
+	resource_cache.push_back(res);
+
+	if (p_index == internal_resources.size() - 1) {
+		f.unref();
+		resource = res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+	}
+}
+
+Error ResourceLoaderBinary::_decode_properties(SubResource &r_sub_resource) {
+	f->seek(r_sub_resource.properties_offset);
+
+	int pc = f->get_32();
+	r_sub_resource.properties.reserve(pc);
+
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
+
+		if (name == StringName()) {
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
+
+		Variant value;
+		Error err = parse_variant(value);
+		if (err) {
+			return err;
+		}
+
+		r_sub_resource.properties.push_back(Pair<StringName, Variant>(name, value));
+	}
+
+	return OK;
+}
+
+Error ResourceLoaderBinary::_complete_external_resource(int p_index, Ref<Resource> &r_resource) {
+	ExtResource *er = nullptr;
+	{
+		MutexLock lock(external_mutex);
+		er = &external_resources.write[p_index];
+		if (er->resolved) {
+			r_resource = er->resource;
+			return er->resolve_error;
+		}
+	}
+
+	// Waiting is done without the lock, so decoders needing other dependencies can go on meanwhile.
+	// Several of them may complete the same token, which is allowed and gives the same result.
+	Ref<Resource> res;
+	Error resolve_error = OK;
+	if (er->load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
+		Error err;
+		res = ResourceLoader::_load_complete(*er->load_token.ptr(), &err);
+		if (res.is_null() && !ResourceLoader::is_cleaning_tasks() && ResourceLoader::get_abort_on_missing_resources()) {
+			resolve_error = ERR_FILE_MISSING_DEPENDENCIES;
+		}
+	}
+
+	bool first = false;
+	{
+		MutexLock lock(external_mutex);
+		if (!er->resolved) {
+			er->resource = res;
+			er->resolve_error = resolve_error;
+			er->resolved = true;
+			first = true;
+		}
+		r_resource = er->resource;
+		resolve_error = er->resolve_error;
+	}
+
+	// Only reported once, even if several sub-resources use the dependency.
+	if (first && res.is_null() && er->load_token.is_valid() && !ResourceLoader::is_cleaning_tasks()) {
+		ERR_FAIL_COND_V_MSG(resolve_error != OK, resolve_error, vformat("Can't load dependency: '%s'.", er->path));
+		ResourceLoader::notify_dependency_error(local_path, er->path, er->type);
+	}
+
+	return resolve_error;
+}
+
+void ResourceLoaderBinary::_decode_next_sub_resources(ParallelDecode *p_parallel) {
+	while (true) {
+		uint32_t index = p_parallel->next_index.postincrement();
+		if (index >= p_parallel->sub_resources->size()) {
+			break;
+		}
 
-				res = Ref<Resource>(r);
+		SubResource &sr = (*p_parallel->sub_resources)[index];
+		if (sr.skip) {
+			continue;
+		}
+		sr.decode_error = _decode_properties(sr);
+		if (needs_loading_thread) {
+			needs_loading_thread = false;
+			if (sr.decode_error == OK) {
+				sr.decode_error = ERR_UNAVAILABLE;
 			}
 		}
+	}
+}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
-				}
+void ResourceLoaderBinary::_decode_sub_resources(void *p_userdata) {
+	ParallelDecode *pd = (ParallelDecode *)p_userdata;
+	const ResourceLoaderBinary *owner = pd->loader;
+
+	Ref<FileAccess> fa;
+	if (pd->data) {
+		Ref<FileAccessMemory> fam;
+		fam.instantiate();
+		fam->open_custom(pd->data, pd->length);
+		fa = fam;
+	} else {
+		// Seeking a shared handle is not thread-safe, so each decoder reads the file through its own.
+		fa = FileAccess::open(pd->file_path, FileAccess::READ);
+		if (fa.is_null()) {
+			return; // The loading thread decodes whatever this one would have.
+		}
+		uint8_t header[4];
+		fa->get_buffer(header, 4);
+		if (header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C') {
+			Ref<FileAccessCompressed> fac;
+			fac.instantiate();
+			if (fac->open_after_magic(fa) != OK) {
+				return;
+			}
+			fa = fac;
+		}
+	}
+	fa->set_big_endian(owner->f->is_big_endian());
+	fa->real_is_double = owner->f->real_is_double;
+
+	ResourceLoaderBinary decoder;
+	decoder.parallel = pd;
+	decoder.f = fa;
+	decoder.local_path = owner->local_path;
+	decoder.res_path = owner->res_path;
+	decoder.ver_format = owner->ver_format;
+	decoder.using_named_scene_ids = owner->using_named_scene_ids;
+	decoder.string_map = owner->string_map;
+	decoder.internal_resources = owner->internal_resources;
+
+	decoder._decode_next_sub_resources(pd);
+}
+
+Error ResourceLoaderBinary::_load_parallel() {
+	// Every sub-resource is instantiated up front, so the decoders can resolve internal references
+	// to objects that exist already; properties are then set in file order, as in the sequential path.
+	// External dependencies are waited for by the first decoder that needs them.
+	LocalVector<SubResource> sub_resources;
+	sub_resources.resize(internal_resources.size());
+
+	for (int i = 0; i < internal_resources.size(); i++) {
+		Error err = _instance_resource(i, sub_resources[i], true);
+		if (err) {
+			return err;
+		}
+	}
+
+	ParallelDecode pd;
+	pd.loader = this;
+	pd.file_path = source_path;
+	pd.sub_resources = &sub_resources;
+
+	f->seek(0);
+	const uint64_t length = f->get_length();
+	const Span<uint8_t> view = f->get_buffer_view(length);
+	if (!view.is_empty()) {
+		pd.data = view.ptr();
+		pd.length = length;
+	}
+
+	// The loading thread decodes too, so this never waits on helpers that cannot be scheduled.
+	int helper_count = MIN(WorkerThreadPool::get_singleton()->get_thread_count(), (int)sub_resources.size() / PARALLEL_DECODE_MIN_RESOURCES);
+	if (!pd.data && pd.file_path.is_empty()) {
+		helper_count = 0;
+	}
+	LocalVector<WorkerThreadPool::TaskID> helpers;
+	helpers.reserve(helper_count);
+	for (int i = 0; i < helper_count; i++) {
+		helpers.push_back(WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoaderBinary::_decode_sub_resources, &pd, false, "ResourceLoaderBinary::_decode_sub_resources"));
+	}
+	_decode_next_sub_resources(&pd);
+	for (WorkerThreadPool::TaskID helper : helpers) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(helper);
+	}
+
+	for (uint32_t i = 0; i < sub_resources.size(); i++) {
+		SubResource &sr = sub_resources[i];
+		if (sr.skip) {
+			continue;
+		}
+
+		if (sr.decode_error == ERR_UNAVAILABLE) {
+			// Uses the old external resource encoding, which can only be loaded from this thread.
+			sr.properties.clear();
+			sr.decode_error = _decode_properties(sr);
+		}
+		if (sr.decode_error) {
+			error = sr.decode_error;
+			return error;
+		}
+
+		Dictionary missing_resource_properties;
+		for (Pair<StringName, Variant> &property : sr.properties) {
+			_set_resource_property(sr, property.first, property.second, missing_resource_properties);
+		}
+		sr.properties.clear();
+
+		_finish_resource(i, sr, missing_resource_properties);
+	}
+
+	return error;
+}
+
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
+
+		if (remaps.has(path)) {
+			path = remaps[path];
+		}
+
+		if (!path.contains("://") && path.is_relative_path()) {
+			// path is relative to file being loaded, so convert to a resource path
+			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		}
+
+		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+		if (external_resources[i].load_token.is_null()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
 			}
-			r->set_scene_unique_id(id);
 		}
+	}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+	if (use_sub_threads && internal_resources.size() >= PARALLEL_DECODE_MIN_RESOURCES) {
+		return _load_parallel();
+	}
+
+	for (int i = 0; i < internal_resources.size(); i++) {
+		SubResource sr;
+		Error err = _instance_resource(i, sr);
+		if (err) {
+			return err;
+		}
+		if (sr.skip) {
+			continue;
 		}
 
 		int pc = f->get_32();
@@ -838,72 +1145,11 @@ Error ResourceLoaderBinary::load() {
 				return error;
 			}
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
-
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
-
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
-
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
-			}
-
-			if (set_valid) {
-				res->set(name, value);
-			}
-		}
-
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
-		}
-
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-		}
-
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
-
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+			_set_resource_property(sr, name, value, missing_resource_properties);
 		}
 
-		resource_cache.push_back(res);
-
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
+		_finish_resource(i, sr, missing_resource_properties);
+		if (i == internal_resources.size() - 1) {
 			return OK;
 		}
 	}
@@ -931,14 +1177,24 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
-	if (len == 0) {
+	if (len <= 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
-	return String::utf8(&str_buf[0], len);
+	return _get_utf8_string(len);
+}
+
+String ResourceLoaderBinary::_get_utf8_string(uint32_t p_len) {
+	// Decode straight out of the file when it is memory-mapped, skipping the staging copy.
+	Span<uint8_t> view = f->get_buffer_view(p_len);
+	if (!view.is_empty()) {
+		return String::utf8((const char *)view.ptr(), p_len);
+	}
+
+	if ((int)p_len > str_buf.size()) {
+		str_buf.resize(p_len);
+	}
+	f->get_buffer((uint8_t *)&str_buf[0], p_len);
+	return String::utf8(&str_buf[0], p_len);
 }
 
 void ResourceLoaderBinary::get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes) {
@@ -1245,6 +1501,7 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 			break;
 	}
 	loader.use_sub_threads = p_use_sub_threads;
+	loader.source_path = p_path;
 	loader.progress = r_progress;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
@@ -1331,6 +1588,7 @@ Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, cons
 		Ref<FileAccessCompressed> facw;
 		facw.instantiate();
 		facw->configure("RSCC");
+		facw->set_dictionary(fac->get_dictionary()); // Keep the dictionary the file was compressed with, if any.
 		err = facw->open_internal(p_path + ".depren", FileAccess::WRITE);
 		ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, vformat("Cannot create file '%s.depren'.", p_path));
 
@@ -2431,6 +2689,7 @@ Error ResourceFormatSaverBinaryInstance::set_uid(const String &p_path, ResourceU
 		Ref<FileAccessCompressed> facw;
 		facw.instantiate();
 		facw->configure("RSCC");
+		facw->set_dictionary(fac->get_dictionary()); // Keep the dictionary the file was compressed with, if any.
 		err = facw->open_internal(p_path + ".uidren", FileAccess::WRITE);
 		ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, vformat("Cannot create file '%s.uidren'.", p_path));
 
@@ -41,6 +41,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -51,6 +55,7 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	String source_path; // File being loaded, so parallel decoders can open their own handle.
 
 	uint64_t importmd_ofs = 0;
 
@@ -68,6 +73,10 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		// Filled in by _complete_external_resource() the first time the dependency is used.
+		Ref<Resource> resource;
+		Error resolve_error = OK;
+		bool resolved = false;
 	};
 
 	bool using_named_scene_ids = false;
@@ -85,7 +94,41 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	// External dependencies can be completed from several decoders at once while loading in parallel.
+	BinaryMutex external_mutex;
+
+	struct ParallelDecode;
+
+	// Set on the detached decoders used by _load_parallel(), which share the owning loader's index cache
+	// read-only and complete external dependencies through it.
+	ParallelDecode *parallel = nullptr;
+	bool needs_loading_thread = false;
+
+	struct SubResource {
+		Ref<Resource> resource;
+		String path;
+		bool cache_deferred = false; // Registered in the cache once the properties are set, so it never exposes a half-loaded resource.
+		MissingResource *missing_resource = nullptr;
+		bool skip = false;
+		uint64_t properties_offset = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error decode_error = OK;
+	};
+
+	struct ParallelDecode {
+		ResourceLoaderBinary *loader = nullptr;
+		// Mapped view of the whole file, if available. Otherwise each decoder opens the file on its own.
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+		String file_path;
+		LocalVector<SubResource> *sub_resources = nullptr;
+		SafeNumeric<uint32_t> next_index;
+	};
+
+	static constexpr int PARALLEL_DECODE_MIN_RESOURCES = 4;
+
 	String get_unicode_string();
+	String _get_utf8_string(uint32_t p_len);
 	void _advance_padding(uint32_t p_len);
 
 	HashMap<String, String> remaps;
@@ -98,6 +141,15 @@ class ResourceLoaderBinary {
 
 	Error parse_variant(Variant &r_v);
 
+	Error _instance_resource(int p_index, SubResource &r_sub_resource, bool p_defer_cache = false);
+	void _set_resource_property(SubResource &p_sub_resource, const StringName &p_name, Variant &p_value, Dictionary &r_missing_resource_properties);
+	void _finish_resource(int p_index, SubResource &p_sub_resource, const Dictionary &p_missing_resource_properties);
+	Error _decode_properties(SubResource &r_sub_resource);
+	Error _complete_external_resource(int p_index, Ref<Resource> &r_resource);
+	Error _load_parallel();
+	void _decode_next_sub_resources(ParallelDecode *p_parallel);
+	static void _decode_sub_resources(void *p_userdata);
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
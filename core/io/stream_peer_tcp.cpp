@@ -39,6 +39,7 @@
 #include "stream_peer_tcp.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/net_socket_poller.h"
 
 Error StreamPeerTCP::poll() {
 	if (status == STATUS_CONNECTED) {
@@ -85,6 +86,23 @@ Error StreamPeerTCP::poll() {
 	return ERR_CONNECTION_ERROR;
 }
 
+Error StreamPeerTCP::poll_events(uint32_t p_events) {
+	if (status != STATUS_CONNECTED) {
+		return poll();
+	}
+
+	if (p_events & NetSocketPoller::EVENT_ERROR) {
+		disconnect_from_host();
+		status = STATUS_ERROR;
+		return FAILED;
+	}
+	if ((p_events & NetSocketPoller::EVENT_IN) && _sock->get_available_bytes() == 0) {
+		// FIN received
+		disconnect_from_host();
+	}
+	return OK;
+}
+
 void StreamPeerTCP::accept_socket(Ref<NetSocket> p_sock, IPAddress p_host, uint16_t p_port) {
 	_sock = p_sock;
 	_sock->set_blocking_enabled(false);
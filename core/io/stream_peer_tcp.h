@@ -84,6 +84,9 @@ public:
 
 	/// Poll socket updating its state.
 	Error poll();
+	/// Update the connection state from readiness events already collected by a NetSocketPoller, without polling the socket again.
+	Error poll_events(uint32_t p_events);
+	Ref<NetSocket> get_socket() const { return _sock; }
 
 	/// Wait or check for writable, readable.
 	Error wait(NetSocket::PollType p_type, int p_timeout = 0);
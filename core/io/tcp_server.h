@@ -60,6 +60,7 @@ public:
 	bool is_listening() const;
 	bool is_connection_available() const;
 	Ref<StreamPeerTCP> take_connection();
+	Ref<NetSocket> get_socket() const { return _sock; }
 
 	void stop(); ///< Stop listening
 
@@ -0,0 +1,705 @@
+/**************************************************************************/
+/*  variant_snapshot.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+/**
+ * @file variant_snapshot.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "variant_snapshot.h"
+
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/object/script_language.h"
+
+// Writer.
+
+void VariantSnapshotWriter::_put_varint(uint64_t p_value) {
+	while (p_value >= 0x80) {
+		buffer.push_back(uint8_t(p_value | 0x80));
+		p_value >>= 7;
+	}
+	buffer.push_back(uint8_t(p_value));
+}
+
+void VariantSnapshotWriter::_put_bytes(const uint8_t *p_data, uint32_t p_size) {
+	const uint32_t size = buffer.size();
+	buffer.resize(size + p_size);
+	memcpy(buffer.ptr() + size, p_data, p_size);
+}
+
+uint32_t VariantSnapshotWriter::_intern_string(const String &p_string) {
+	const uint32_t *id = string_ids.getptr(p_string);
+	if (id) {
+		return *id;
+	}
+	const uint32_t new_id = strings.size();
+	strings.push_back(p_string);
+	string_ids.insert(p_string, new_id);
+	return new_id;
+}
+
+Error VariantSnapshotWriter::_intern_container_type(const ContainerType &p_type, uint32_t &r_index) {
+	r_index = 0;
+	if (p_type.builtin_type == Variant::NIL) {
+		return OK;
+	}
+
+	// Builtin type, class name and script path (both as string index + 1). Same rules as `encode_variant()`.
+	LocalVector<uint32_t> entry = { uint32_t(p_type.builtin_type), 0, 0 };
+	if (p_type.script.is_valid()) {
+		if (full_objects) {
+			const String path = p_type.script->get_path();
+			ERR_FAIL_COND_V_MSG(path.is_empty() || !path.begins_with("res://"), ERR_UNAVAILABLE, "Failed to encode a path to a custom script for a container type.");
+			entry[2] = _intern_string(path) + 1;
+		} else {
+			entry[1] = _intern_string(String(EncodedObjectAsID::get_class_static())) + 1;
+		}
+	} else if (p_type.class_name != StringName()) {
+		entry[1] = _intern_string(full_objects ? String(p_type.class_name) : String(EncodedObjectAsID::get_class_static())) + 1;
+	}
+
+	const uint32_t *id = container_type_ids.getptr(entry);
+	if (id) {
+		r_index = *id;
+		return OK;
+	}
+	r_index = container_types.size() + 1;
+	container_type_ids.insert(entry, r_index);
+	container_types.push_back(entry);
+	return OK;
+}
+
+Error VariantSnapshotWriter::_write_value(const Variant &p_value, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	switch (p_value.get_type()) {
+		case Variant::NIL: {
+			_put_u8(VariantSnapshot::TAG_NIL);
+		} break;
+		case Variant::BOOL: {
+			_put_u8(p_value.operator bool() ? VariantSnapshot::TAG_TRUE : VariantSnapshot::TAG_FALSE);
+		} break;
+		case Variant::INT: {
+			const int64_t value = p_value;
+			_put_u8(VariantSnapshot::TAG_INT);
+			_put_varint((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+		} break;
+		case Variant::FLOAT: {
+			const double value = p_value;
+			const float single = float(value);
+			uint8_t bytes[8];
+			if (double(single) == value) {
+				_put_u8(VariantSnapshot::TAG_FLOAT32);
+				_put_bytes(bytes, encode_float(single, bytes));
+			} else {
+				_put_u8(VariantSnapshot::TAG_FLOAT64);
+				_put_bytes(bytes, encode_double(value, bytes));
+			}
+		} break;
+		case Variant::STRING: {
+			const String str = p_value;
+			if (str.length() <= int(STRING_REF_MAX_LENGTH)) {
+				_put_u8(VariantSnapshot::TAG_STRING_REF);
+				_put_varint(_intern_string(str));
+			} else {
+				const CharString utf8 = str.utf8();
+				_put_u8(VariantSnapshot::TAG_STRING);
+				_put_varint(utf8.length());
+				_put_bytes((const uint8_t *)utf8.get_data(), utf8.length());
+			}
+		} break;
+		case Variant::STRING_NAME: {
+			_put_u8(VariantSnapshot::TAG_STRING_NAME);
+			_put_varint(_intern_string(p_value));
+		} break;
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			uint32_t type;
+			Error err = _intern_container_type(array.get_element_type(), type);
+			if (err != OK) {
+				return err;
+			}
+			_put_u8(VariantSnapshot::TAG_ARRAY);
+			_put_varint(type);
+			_put_varint(array.size());
+			for (const Variant &element : array) {
+				err = _write_value(element, p_depth + 1);
+				if (err != OK) {
+					return err;
+				}
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary dict = p_value;
+			uint32_t key_type;
+			uint32_t value_type;
+			Error err = _intern_container_type(dict.get_key_type(), key_type);
+			if (err != OK) {
+				return err;
+			}
+			err = _intern_container_type(dict.get_value_type(), value_type);
+			if (err != OK) {
+				return err;
+			}
+
+			// Dictionaries keyed by strings, as most records are, only reference their key set.
+			bool use_schema = uint32_t(dict.size()) <= SCHEMA_MAX_KEYS;
+			if (use_schema) {
+				schema_scratch.clear();
+				schema_scratch.push_back(key_type);
+				schema_scratch.push_back(value_type);
+				for (const KeyValue<Variant, Variant> &kv : dict) {
+					const Variant::Type type = kv.key.get_type();
+					if (type != Variant::STRING && type != Variant::STRING_NAME) {
+						use_schema = false;
+						break;
+					}
+					schema_scratch.push_back((_intern_string(kv.key) << 1) | (type == Variant::STRING_NAME ? 1 : 0));
+				}
+			}
+
+			if (use_schema) {
+				const uint32_t *id = schema_ids.getptr(schema_scratch);
+				uint32_t schema;
+				if (id) {
+					schema = *id;
+				} else {
+					schema = schemas.size();
+					schema_ids.insert(schema_scratch, schema);
+					schemas.push_back(schema_scratch);
+				}
+				_put_u8(VariantSnapshot::TAG_DICTIONARY_SCHEMA);
+				_put_varint(schema);
+				for (const KeyValue<Variant, Variant> &kv : dict) {
+					err = _write_value(kv.value, p_depth + 1);
+					if (err != OK) {
+						return err;
+					}
+				}
+			} else {
+				_put_u8(VariantSnapshot::TAG_DICTIONARY);
+				_put_varint(key_type);
+				_put_varint(value_type);
+				_put_varint(dict.size());
+				for (const KeyValue<Variant, Variant> &kv : dict) {
+					err = _write_value(kv.key, p_depth + 1);
+					if (err != OK) {
+						return err;
+					}
+					err = _write_value(kv.value, p_depth + 1);
+					if (err != OK) {
+						return err;
+					}
+				}
+			}
+		} break;
+		default: {
+			// Math types, packed arrays and objects are already compact in the regular encoding.
+			int len;
+			Error err = encode_variant(p_value, nullptr, len, full_objects, p_depth);
+			if (err != OK) {
+				return err;
+			}
+			_put_u8(VariantSnapshot::TAG_VARIANT);
+			_put_varint(len);
+			const uint32_t size = buffer.size();
+			buffer.resize(size + len);
+			err = encode_variant(p_value, buffer.ptr() + size, len, full_objects, p_depth);
+			if (err != OK) {
+				return err;
+			}
+		} break;
+	}
+	return OK;
+}
+
+Error VariantSnapshotWriter::_flush() {
+	if (buffer.is_empty()) {
+		return OK;
+	}
+	if (!file->store_buffer(buffer.ptr(), buffer.size())) {
+		error = ERR_FILE_CANT_WRITE;
+		return error;
+	}
+	written += buffer.size();
+	buffer.clear();
+	return OK;
+}
+
+Error VariantSnapshotWriter::open(const String &p_path, bool p_full_objects) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Can't open snapshot file for writing at path: '%s'.", p_path));
+	return open_file(f, p_full_objects);
+}
+
+Error VariantSnapshotWriter::open_file(const Ref<FileAccess> &p_file, bool p_full_objects) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(file.is_valid(), ERR_ALREADY_IN_USE, "A snapshot is already being written, close it first.");
+
+	file = p_file;
+	base_offset = file->get_position();
+	written = 0;
+	full_objects = p_full_objects;
+	error = OK;
+
+	uint8_t header[VariantSnapshot::HEADER_SIZE];
+	encode_uint32(VariantSnapshot::MAGIC, header);
+	encode_uint32(VariantSnapshot::VERSION, header + 4);
+	encode_uint64(0, header + 8); // Table offset, filled in by close().
+	if (!file->store_buffer(header, VariantSnapshot::HEADER_SIZE)) {
+		file.unref();
+		return ERR_FILE_CANT_WRITE;
+	}
+	return OK;
+}
+
+Error VariantSnapshotWriter::write(const Variant &p_value) {
+	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_UNCONFIGURED, "No snapshot is open for writing.");
+	ERR_FAIL_COND_V(error != OK, error);
+
+	// Values that fail to encode are dropped as a whole, the snapshot stays usable.
+	const uint32_t start = buffer.size();
+	entry_offsets.push_back(written + start);
+	Error err = _write_value(p_value, 0);
+	if (err != OK) {
+		buffer.resize(start);
+		entry_offsets.resize(entry_offsets.size() - 1);
+		return err;
+	}
+
+	if (buffer.size() >= FLUSH_SIZE) {
+		return _flush();
+	}
+	return OK;
+}
+
+Error VariantSnapshotWriter::close() {
+	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_UNCONFIGURED, "No snapshot is open for writing.");
+
+	Error err = error;
+	if (err == OK) {
+		err = _flush();
+	}
+	if (err == OK) {
+		const uint64_t table_offset = VariantSnapshot::HEADER_SIZE + written;
+
+		_put_varint(strings.size());
+		for (const String &str : strings) {
+			const CharString utf8 = str.utf8();
+			_put_varint(utf8.length());
+			_put_bytes((const uint8_t *)utf8.get_data(), utf8.length());
+		}
+		_put_varint(container_types.size());
+		for (const LocalVector<uint32_t> &type : container_types) {
+			for (uint32_t value : type) {
+				_put_varint(value);
+			}
+		}
+		_put_varint(schemas.size());
+		for (const LocalVector<uint32_t> &schema : schemas) {
+			_put_varint(schema[0]);
+			_put_varint(schema[1]);
+			_put_varint(schema.size() - 2);
+			for (uint32_t i = 2; i < schema.size(); i++) {
+				_put_varint(schema[i]);
+			}
+		}
+		_put_varint(entry_offsets.size());
+		uint64_t previous = 0;
+		for (uint64_t offset : entry_offsets) {
+			_put_varint(offset - previous);
+			previous = offset;
+		}
+		err = _flush();
+
+		if (err == OK) {
+			uint8_t offset_bytes[8];
+			encode_uint64(table_offset, offset_bytes);
+			file->seek(base_offset + 8);
+			file->store_buffer(offset_bytes, 8);
+			file->seek(base_offset + VariantSnapshot::HEADER_SIZE + written);
+			file->flush();
+			err = file->get_error();
+		}
+	}
+
+	file.unref();
+	buffer.clear();
+	entry_offsets.clear();
+	string_ids.clear();
+	strings.clear();
+	container_type_ids.clear();
+	container_types.clear();
+	schema_ids.clear();
+	schemas.clear();
+	return err;
+}
+
+void VariantSnapshotWriter::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path", "full_objects"), &VariantSnapshotWriter::open, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("write", "value"), &VariantSnapshotWriter::write);
+	ClassDB::bind_method(D_METHOD("close"), &VariantSnapshotWriter::close);
+	ClassDB::bind_method(D_METHOD("get_entry_count"), &VariantSnapshotWriter::get_entry_count);
+}
+
+VariantSnapshotWriter::~VariantSnapshotWriter() {
+	if (file.is_valid()) {
+		close();
+	}
+}
+
+// Reader.
+
+uint8_t VariantSnapshotReader::Cursor::get_u8() {
+	if (pos >= end) {
+		failed = true;
+		return 0;
+	}
+	return *(pos++);
+}
+
+uint64_t VariantSnapshotReader::Cursor::get_varint() {
+	uint64_t value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		const uint8_t byte = get_u8();
+		value |= uint64_t(byte & 0x7f) << shift;
+		if (!(byte & 0x80)) {
+			return value;
+		}
+	}
+	failed = true;
+	return 0;
+}
+
+const uint8_t *VariantSnapshotReader::Cursor::get_bytes(uint64_t p_size) {
+	if (p_size > uint64_t(end - pos)) {
+		failed = true;
+		return nullptr;
+	}
+	const uint8_t *bytes = pos;
+	pos += p_size;
+	return bytes;
+}
+
+Error VariantSnapshotReader::_read_tables(Cursor &p_cursor) {
+	// Every table entry takes at least one byte, which bounds the counts of a corrupted file.
+	uint64_t count = p_cursor.get_varint();
+	ERR_FAIL_COND_V(p_cursor.failed || count > uint64_t(p_cursor.end - p_cursor.pos), ERR_FILE_CORRUPT);
+	strings.resize(count);
+	string_names.resize(count);
+	for (String &str : strings) {
+		const uint64_t len = p_cursor.get_varint();
+		const uint8_t *bytes = p_cursor.get_bytes(len);
+		ERR_FAIL_COND_V(p_cursor.failed || len > INT32_MAX, ERR_FILE_CORRUPT);
+		ERR_FAIL_COND_V(str.append_utf8((const char *)bytes, len) != OK, ERR_FILE_CORRUPT);
+	}
+
+	count = p_cursor.get_varint();
+	ERR_FAIL_COND_V(p_cursor.failed || count > uint64_t(p_cursor.end - p_cursor.pos), ERR_FILE_CORRUPT);
+	container_types.resize(count + 1);
+	for (uint32_t i = 1; i < container_types.size(); i++) {
+		ContainerType &type = container_types[i];
+		const uint64_t builtin = p_cursor.get_varint();
+		const uint64_t class_name = p_cursor.get_varint();
+		const uint64_t script_path = p_cursor.get_varint();
+		ERR_FAIL_COND_V(p_cursor.failed || builtin == Variant::NIL || builtin >= Variant::VARIANT_MAX || class_name > strings.size() || script_path > strings.size(), ERR_FILE_CORRUPT);
+
+		type.builtin_type = Variant::Type(builtin);
+		if (type.builtin_type == Variant::OBJECT && !allow_objects) {
+			type.class_name = EncodedObjectAsID::get_class_static();
+		} else if (script_path) {
+			const String &path = strings[script_path - 1];
+			ERR_FAIL_COND_V_MSG(!path.begins_with("res://") || !ResourceLoader::exists(path, "Script"), ERR_INVALID_DATA, vformat("Invalid script path \"%s\".", path));
+			type.script = ResourceLoader::load(path, "Script");
+			ERR_FAIL_COND_V_MSG(type.script.is_null(), ERR_INVALID_DATA, vformat("Can't load script at path \"%s\".", path));
+			type.class_name = type.script->get_instance_base_type();
+		} else if (class_name) {
+			type.class_name = strings[class_name - 1];
+		}
+	}
+
+	count = p_cursor.get_varint();
+	ERR_FAIL_COND_V(p_cursor.failed || count > uint64_t(p_cursor.end - p_cursor.pos), ERR_FILE_CORRUPT);
+	schemas.resize(count);
+	for (Schema &schema : schemas) {
+		schema.key_type = p_cursor.get_varint();
+		schema.value_type = p_cursor.get_varint();
+		const uint64_t key_count = p_cursor.get_varint();
+		ERR_FAIL_COND_V(p_cursor.failed || schema.key_type >= container_types.size() || schema.value_type >= container_types.size() || key_count > uint64_t(p_cursor.end - p_cursor.pos), ERR_FILE_CORRUPT);
+		schema.keys.resize(key_count);
+		for (Variant &key : schema.keys) {
+			const uint64_t value = p_cursor.get_varint();
+			ERR_FAIL_COND_V(p_cursor.failed || (value >> 1) >= strings.size(), ERR_FILE_CORRUPT);
+			if (value & 1) {
+				key = _get_string_name(value >> 1);
+			} else {
+				key = strings[value >> 1];
+			}
+		}
+	}
+
+	count = p_cursor.get_varint();
+	ERR_FAIL_COND_V(p_cursor.failed || count > uint64_t(p_cursor.end - p_cursor.pos), ERR_FILE_CORRUPT);
+	entry_offsets.resize(count);
+	uint64_t offset = 0;
+	for (uint64_t &entry_offset : entry_offsets) {
+		offset += p_cursor.get_varint();
+		entry_offset = offset;
+	}
+	ERR_FAIL_COND_V(p_cursor.failed || offset > table_offset - VariantSnapshot::HEADER_SIZE, ERR_FILE_CORRUPT);
+	return OK;
+}
+
+const StringName &VariantSnapshotReader::_get_string_name(uint32_t p_index) {
+	StringName &name = string_names[p_index];
+	if (name.is_empty() && !strings[p_index].is_empty()) {
+		name = strings[p_index];
+	}
+	return name;
+}
+
+Error VariantSnapshotReader::_read_value(Cursor &p_cursor, Variant &r_value, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+
+	const uint8_t tag = p_cursor.get_u8();
+	ERR_FAIL_COND_V(p_cursor.failed || tag >= VariantSnapshot::TAG_MAX, ERR_FILE_CORRUPT);
+
+	switch (tag) {
+		case VariantSnapshot::TAG_NIL: {
+			r_value = Variant();
+		} break;
+		case VariantSnapshot::TAG_FALSE: {
+			r_value = false;
+		} break;
+		case VariantSnapshot::TAG_TRUE: {
+			r_value = true;
+		} break;
+		case VariantSnapshot::TAG_INT: {
+			const uint64_t value = p_cursor.get_varint();
+			r_value = int64_t((value >> 1) ^ (~(value & 1) + 1));
+		} break;
+		case VariantSnapshot::TAG_FLOAT32: {
+			const uint8_t *bytes = p_cursor.get_bytes(4);
+			ERR_FAIL_COND_V(p_cursor.failed, ERR_FILE_CORRUPT);
+			r_value = double(decode_float(bytes));
+		} break;
+		case VariantSnapshot::TAG_FLOAT64: {
+			const uint8_t *bytes = p_cursor.get_bytes(8);
+			ERR_FAIL_COND_V(p_cursor.failed, ERR_FILE_CORRUPT);
+			r_value = decode_double(bytes);
+		} break;
+		case VariantSnapshot::TAG_STRING: {
+			const uint64_t len = p_cursor.get_varint();
+			const uint8_t *bytes = p_cursor.get_bytes(len);
+			ERR_FAIL_COND_V(p_cursor.failed || len > INT32_MAX, ERR_FILE_CORRUPT);
+			String str;
+			ERR_FAIL_COND_V(str.append_utf8((const char *)bytes, len) != OK, ERR_FILE_CORRUPT);
+			r_value = str;
+		} break;
+		case VariantSnapshot::TAG_STRING_REF: {
+			const uint64_t index = p_cursor.get_varint();
+			ERR_FAIL_COND_V(p_cursor.failed || index >= strings.size(), ERR_FILE_CORRUPT);
+			r_value = strings[index];
+		} break;
+		case VariantSnapshot::TAG_STRING_NAME: {
+			const uint64_t index = p_cursor.get_varint();
+			ERR_FAIL_COND_V(p_cursor.failed || index >= strings.size(), ERR_FILE_CORRUPT);
+			r_value = _get_string_name(index);
+		} break;
+		case VariantSnapshot::TAG_ARRAY: {
+			const uint64_t type = p_cursor.get_varint();
+			const uint64_t size = p_cursor.get_varint();
+			ERR_FAIL_COND_V(p_cursor.failed || type >= container_types.size() || size > uint64_t(p_cursor.end - p_cursor.pos), ERR_FILE_CORRUPT);
+
+			Array array;
+			if (type) {
+				array.set_typed(container_types[type]);
+			}
+			array.resize(size);
+			for (uint64_t i = 0; i < size; i++) {
+				Variant element;
+				Error err = _read_value(p_cursor, element, p_depth + 1);
+				if (err != OK) {
+					return err;
+				}
+				array.set(i, element);
+			}
+			r_value = array;
+		} break;
+		case VariantSnapshot::TAG_DICTIONARY: {
+			const uint64_t key_type = p_cursor.get_varint();
+			const uint64_t value_type = p_cursor.get_varint();
+			const uint64_t size = p_cursor.get_varint();
+			ERR_FAIL_COND_V(p_cursor.failed || key_type >= container_types.size() || value_type >= container_types.size() || size > uint64_t(p_cursor.end - p_cursor.pos), ERR_FILE_CORRUPT);
+
+			Dictionary dict;
+			if (key_type || value_type) {
+				dict.set_typed(container_types[key_type], container_types[value_type]);
+			}
+			for (uint64_t i = 0; i < size; i++) {
+				Variant key;
+				Variant value;
+				Error err = _read_value(p_cursor, key, p_depth + 1);
+				if (err != OK) {
+					return err;
+				}
+				err = _read_value(p_cursor, value, p_depth + 1);
+				if (err != OK) {
+					return err;
+				}
+				dict.set(key, value);
+			}
+			r_value = dict;
+		} break;
+		case VariantSnapshot::TAG_DICTIONARY_SCHEMA: {
+			const uint64_t index = p_cursor.get_varint();
+			ERR_FAIL_COND_V(p_cursor.failed || index >= schemas.size(), ERR_FILE_CORRUPT);
+			const Schema &schema = schemas[index];
+
+			Dictionary dict;
+			if (schema.key_type || schema.value_type) {
+				dict.set_typed(container_types[schema.key_type], container_types[schema.value_type]);
+			}
+			for (const Variant &key : schema.keys) {
+				Variant value;
+				Error err = _read_value(p_cursor, value, p_depth + 1);
+				if (err != OK) {
+					return err;
+				}
+				dict.set(key, value);
+			}
+			r_value = dict;
+		} break;
+		case VariantSnapshot::TAG_VARIANT: {
+			const uint64_t len = p_cursor.get_varint();
+			const uint8_t *bytes = p_cursor.get_bytes(len);
+			ERR_FAIL_COND_V(p_cursor.failed || len > INT32_MAX, ERR_FILE_CORRUPT);
+			return decode_variant(r_value, bytes, len, nullptr, allow_objects, p_depth);
+		} break;
+	}
+	return OK;
+}
+
+Error VariantSnapshotReader::open(const String &p_path, bool p_allow_objects) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Can't open snapshot file for reading at path: '%s'.", p_path));
+	return open_file(f, p_allow_objects);
+}
+
+Error VariantSnapshotReader::open_file(const Ref<FileAccess> &p_file, bool p_allow_objects) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	close();
+
+	base_offset = p_file->get_position();
+	allow_objects = p_allow_objects;
+
+	uint8_t header[VariantSnapshot::HEADER_SIZE];
+	ERR_FAIL_COND_V(p_file->get_buffer(header, VariantSnapshot::HEADER_SIZE) != VariantSnapshot::HEADER_SIZE, ERR_FILE_UNRECOGNIZED);
+	ERR_FAIL_COND_V(decode_uint32(header) != VariantSnapshot::MAGIC, ERR_FILE_UNRECOGNIZED);
+	ERR_FAIL_COND_V_MSG(decode_uint32(header + 4) > VariantSnapshot::VERSION, ERR_FILE_UNRECOGNIZED, "Snapshot was written by a newer version of the engine.");
+	table_offset = decode_uint64(header + 8);
+	ERR_FAIL_COND_V_MSG(table_offset == 0, ERR_FILE_CORRUPT, "Snapshot was not closed after writing.");
+
+	const uint64_t length = p_file->get_length();
+	ERR_FAIL_COND_V(table_offset < VariantSnapshot::HEADER_SIZE || base_offset + table_offset > length, ERR_FILE_CORRUPT);
+
+	p_file->seek(base_offset + table_offset);
+	LocalVector<uint8_t> tables;
+	tables.resize(length - base_offset - table_offset);
+	ERR_FAIL_COND_V(p_file->get_buffer(tables.ptr(), tables.size()) != tables.size(), ERR_FILE_CORRUPT);
+
+	Cursor cursor;
+	cursor.pos = tables.ptr();
+	cursor.end = tables.ptr() + tables.size();
+	Error err = _read_tables(cursor);
+	if (err != OK) {
+		close();
+		return err;
+	}
+
+	file = p_file;
+	return OK;
+}
+
+void VariantSnapshotReader::close() {
+	file.unref();
+	strings.clear();
+	string_names.clear();
+	container_types.clear();
+	schemas.clear();
+	entry_offsets.clear();
+	entry_buffer.clear();
+}
+
+Error VariantSnapshotReader::get_entry_checked(int p_index, Variant &r_value) {
+	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_UNCONFIGURED, "No snapshot is open for reading.");
+	ERR_FAIL_INDEX_V(p_index, int(entry_offsets.size()), ERR_INVALID_PARAMETER);
+
+	const uint64_t begin = entry_offsets[p_index];
+	const uint64_t end = uint32_t(p_index + 1) < entry_offsets.size() ? entry_offsets[p_index + 1] : table_offset - VariantSnapshot::HEADER_SIZE;
+	ERR_FAIL_COND_V(end < begin, ERR_FILE_CORRUPT);
+	const uint64_t size = end - begin;
+
+	// Only this entry is read, without copying it when the file is mapped in memory.
+	file->seek(base_offset + VariantSnapshot::HEADER_SIZE + begin);
+	Cursor cursor;
+	const Span<uint8_t> view = file->get_buffer_view(size);
+	if (size > 0 && view.size() == size) {
+		cursor.pos = view.ptr();
+	} else {
+		entry_buffer.resize(size);
+		ERR_FAIL_COND_V(file->get_buffer(entry_buffer.ptr(), size) != size, ERR_FILE_CORRUPT);
+		cursor.pos = entry_buffer.ptr();
+	}
+	cursor.end = cursor.pos + size;
+
+	return _read_value(cursor, r_value, 0);
+}
+
+Variant VariantSnapshotReader::get_entry(int p_index) {
+	Variant value;
+	Error err = get_entry_checked(p_index, value);
+	ERR_FAIL_COND_V_MSG(err != OK, Variant(), vformat("Failed to decode snapshot entry %d.", p_index));
+	return value;
+}
+
+void VariantSnapshotReader::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path", "allow_objects"), &VariantSnapshotReader::open, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("close"), &VariantSnapshotReader::close);
+	ClassDB::bind_method(D_METHOD("get_entry_count"), &VariantSnapshotReader::get_entry_count);
+	ClassDB::bind_method(D_METHOD("get_entry", "index"), &VariantSnapshotReader::get_entry);
+}
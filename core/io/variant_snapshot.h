@@ -0,0 +1,181 @@
+/**************************************************************************/
+/*  variant_snapshot.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+/**
+ * @file variant_snapshot.h
+ *
+ * Compact binary format for saving large amounts of Variant data, such as the state of every entity of a game world.
+ * Unlike `encode_variant()`, strings used as dictionary keys, StringNames, dictionary key sets ("schemas") and typed
+ * container types are stored once in a table at the end of the snapshot, and referenced by index from the values.
+ * Values are streamed to the file as they are written, and read back one entry at a time.
+ */
+
+#include "core/io/file_access.h"
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/container_type_validate.h"
+
+class VariantSnapshot {
+public:
+	static constexpr uint32_t MAGIC = 0x4e534452; // "RDSN"
+	static constexpr uint32_t VERSION = 1;
+	static constexpr uint32_t HEADER_SIZE = 16; ///< Magic, version and table offset.
+
+	enum Tag : uint8_t {
+		TAG_NIL,
+		TAG_FALSE,
+		TAG_TRUE,
+		TAG_INT, ///< Zigzag varint.
+		TAG_FLOAT32, ///< Float values which are exactly representable in single precision.
+		TAG_FLOAT64,
+		TAG_STRING, ///< Varint length and UTF-8 bytes.
+		TAG_STRING_REF, ///< Varint index in the string table.
+		TAG_STRING_NAME, ///< Varint index in the string table.
+		TAG_ARRAY, ///< Varint container type, varint size, values.
+		TAG_DICTIONARY, ///< Varint key container type, varint value container type, varint size, key and value pairs.
+		TAG_DICTIONARY_SCHEMA, ///< Varint index in the schema table, values in the order of the schema keys.
+		TAG_VARIANT, ///< Varint length and `encode_variant()` data, for every other type.
+		TAG_MAX,
+	};
+};
+
+class VariantSnapshotWriter : public RefCounted {
+	GDCLASS(VariantSnapshotWriter, RefCounted);
+
+	static constexpr uint32_t FLUSH_SIZE = 65536;
+	static constexpr uint32_t SCHEMA_MAX_KEYS = 64; ///< Larger dictionaries are usually maps, their key set is not worth sharing.
+	static constexpr uint32_t STRING_REF_MAX_LENGTH = 64; ///< Longer string values are written in place.
+
+	struct SchemaHasher {
+		static _FORCE_INLINE_ uint32_t hash(const LocalVector<uint32_t> &p_schema) { return hash_murmur3_buffer(p_schema.ptr(), p_schema.size() * sizeof(uint32_t)); }
+	};
+	struct SchemaComparator {
+		static bool compare(const LocalVector<uint32_t> &p_lhs, const LocalVector<uint32_t> &p_rhs) { return p_lhs.size() == p_rhs.size() && memcmp(p_lhs.ptr(), p_rhs.ptr(), p_lhs.size() * sizeof(uint32_t)) == 0; }
+	};
+
+	Ref<FileAccess> file;
+	uint64_t base_offset = 0;
+	uint64_t written = 0; ///< Bytes written to the file after the header, not counting the pending buffer.
+	bool full_objects = false;
+	Error error = OK;
+
+	LocalVector<uint8_t> buffer;
+	LocalVector<uint64_t> entry_offsets;
+
+	HashMap<String, uint32_t> string_ids;
+	LocalVector<String> strings;
+	/// Container types and schemas are stored as their encoded table entries, index 0 of the types is the untyped container.
+	HashMap<LocalVector<uint32_t>, uint32_t, SchemaHasher, SchemaComparator> container_type_ids;
+	LocalVector<LocalVector<uint32_t>> container_types;
+	HashMap<LocalVector<uint32_t>, uint32_t, SchemaHasher, SchemaComparator> schema_ids;
+	LocalVector<LocalVector<uint32_t>> schemas;
+	LocalVector<uint32_t> schema_scratch;
+
+	void _put_u8(uint8_t p_value) { buffer.push_back(p_value); }
+	void _put_varint(uint64_t p_value);
+	void _put_bytes(const uint8_t *p_data, uint32_t p_size);
+	uint32_t _intern_string(const String &p_string);
+	Error _intern_container_type(const ContainerType &p_type, uint32_t &r_index);
+	Error _write_value(const Variant &p_value, int p_depth);
+	Error _flush();
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path, bool p_full_objects = false);
+	/// Starts a snapshot at the current position of an already open file.
+	Error open_file(const Ref<FileAccess> &p_file, bool p_full_objects = false);
+	/// Appends a value as a new entry, which can be read back on its own with `VariantSnapshotReader::get_entry()`.
+	Error write(const Variant &p_value);
+	/// Writes the tables and finishes the snapshot, which is unreadable until this is done.
+	Error close();
+
+	int get_entry_count() const { return entry_offsets.size(); }
+	int get_string_count() const { return strings.size(); }
+	int get_schema_count() const { return schemas.size(); }
+
+	~VariantSnapshotWriter();
+};
+
+class VariantSnapshotReader : public RefCounted {
+	GDCLASS(VariantSnapshotReader, RefCounted);
+
+	struct Schema {
+		uint32_t key_type = 0;
+		uint32_t value_type = 0;
+		LocalVector<Variant> keys;
+	};
+
+	struct Cursor {
+		const uint8_t *pos = nullptr;
+		const uint8_t *end = nullptr;
+		bool failed = false;
+
+		uint8_t get_u8();
+		uint64_t get_varint();
+		const uint8_t *get_bytes(uint64_t p_size);
+	};
+
+	Ref<FileAccess> file;
+	uint64_t base_offset = 0;
+	uint64_t table_offset = 0;
+	bool allow_objects = false;
+
+	LocalVector<String> strings;
+	LocalVector<StringName> string_names; ///< Created on first use.
+	LocalVector<ContainerType> container_types;
+	LocalVector<Schema> schemas;
+	LocalVector<uint64_t> entry_offsets;
+	LocalVector<uint8_t> entry_buffer;
+
+	Error _read_tables(Cursor &p_cursor);
+	const StringName &_get_string_name(uint32_t p_index);
+	Error _read_value(Cursor &p_cursor, Variant &r_value, int p_depth);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path, bool p_allow_objects = false);
+	/// Reads the tables of a snapshot starting at the current position of the file. Entries are only decoded when requested.
+	Error open_file(const Ref<FileAccess> &p_file, bool p_allow_objects = false);
+	void close();
+
+	int get_entry_count() const { return entry_offsets.size(); }
+	Error get_entry_checked(int p_index, Variant &r_value);
+	Variant get_entry(int p_index);
+};
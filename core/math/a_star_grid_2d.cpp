@@ -136,6 +136,7 @@ void AStarGrid2D::update() {
 
 	points.clear();
 	solid_mask.clear();
+	flow_fields.clear();
 
 	const int32_t end_x = region.get_end().x;
 	const int32_t end_y = region.get_end().y;
@@ -207,6 +208,7 @@ void AStarGrid2D::set_max_traversals(int64_t p_max_traversals) {
 void AStarGrid2D::set_diagonal_mode(DiagonalMode p_diagonal_mode) {
 	ERR_FAIL_INDEX((int)p_diagonal_mode, (int)DIAGONAL_MODE_MAX);
 	diagonal_mode = p_diagonal_mode;
+	flow_fields.clear();
 }
 
 AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
@@ -216,6 +218,7 @@ AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
 void AStarGrid2D::set_default_compute_heuristic(Heuristic p_heuristic) {
 	ERR_FAIL_INDEX((int)p_heuristic, (int)HEURISTIC_MAX);
 	default_compute_heuristic = p_heuristic;
+	flow_fields.clear();
 }
 
 AStarGrid2D::Heuristic AStarGrid2D::get_default_compute_heuristic() const {
@@ -235,6 +238,7 @@ void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
 	_set_solid_unchecked(p_id, p_solid);
+	flow_fields.clear();
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -248,6 +252,7 @@ void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_s
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set point's weight scale. Point %s out of bounds %s.", p_id, region));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 	_get_point_unchecked(p_id)->weight_scale = p_weight_scale;
+	flow_fields.clear();
 }
 
 real_t AStarGrid2D::get_point_weight_scale(const Vector2i &p_id) const {
@@ -268,6 +273,7 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 			_set_solid_unchecked(x, y, p_solid);
 		}
 	}
+	flow_fields.clear();
 }
 
 void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weight_scale) {
@@ -283,6 +289,7 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 			_get_point_unchecked(x, y)->weight_scale = p_weight_scale;
 		}
 	}
+	flow_fields.clear();
 }
 
 AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
@@ -602,6 +609,64 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 	return found_route;
 }
 
+void AStarGrid2D::_build_flow_field(const Vector2i &p_to_id, LocalVector<int32_t> &r_flow_field) {
+	const uint32_t point_count = region.size.x * region.size.y;
+	r_flow_field.resize(point_count);
+	for (int32_t &next_index : r_flow_field) {
+		next_index = -1;
+	}
+
+	if (_get_solid_unchecked(p_to_id)) {
+		return;
+	}
+
+	// Dijkstra search backward from the goal. Neighbors are symmetric in every diagonal mode, so expanding
+	// the neighbors of a point finds all points that can move into it.
+	LocalVector<real_t> costs;
+	costs.resize(point_count);
+	for (real_t &cost : costs) {
+		cost = Math::INF;
+	}
+
+	LocalVector<FlowEntry> open_list;
+	SortArray<FlowEntry, SortFlowEntries> sorter;
+	LocalVector<Point *> nbors;
+
+	const int32_t to_index = (p_to_id.y - region.position.y) * region.size.x + p_to_id.x - region.position.x;
+	costs[to_index] = 0;
+	r_flow_field[to_index] = to_index;
+	open_list.push_back({ 0, to_index });
+
+	while (!open_list.is_empty()) {
+		const FlowEntry entry = open_list[0];
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+
+		if (entry.cost > costs[entry.index]) {
+			continue; // Outdated entry, the point was reached with a lower cost in the meantime.
+		}
+
+		Point *p = _get_point_unchecked(entry.index % region.size.x + region.position.x, entry.index / region.size.x + region.position.y);
+
+		nbors.clear();
+		_get_nbors(p, nbors);
+
+		for (Point *e : nbors) {
+			const int32_t e_index = (e->id.y - region.position.y) * region.size.x + e->id.x - region.position.x;
+			// Moving from the neighbor into the point is weighted by the point, like in _solve().
+			const real_t cost = entry.cost + _compute_cost(e->id, p->id) * p->weight_scale;
+			if (cost >= costs[e_index]) {
+				continue;
+			}
+
+			costs[e_index] = cost;
+			r_flow_field[e_index] = entry.index;
+			open_list.push_back({ cost, e_index });
+			sorter.push_heap(0, open_list.size() - 1, 0, open_list[open_list.size() - 1], open_list.ptr());
+		}
+	}
+}
+
 real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -620,6 +685,7 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 
 void AStarGrid2D::clear() {
 	points.clear();
+	flow_fields.clear();
 	region = Rect2i();
 }
 
@@ -760,6 +826,37 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	return path;
 }
 
+Vector2i AStarGrid2D::get_flow_direction(const Vector2i &p_from_id, const Vector2i &p_to_id) {
+	ERR_FAIL_COND_V_MSG(dirty, Vector2i(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), Vector2i(), vformat("Can't get flow direction. Point %s out of bounds %s.", p_from_id, region));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), Vector2i(), vformat("Can't get flow direction. Point %s out of bounds %s.", p_to_id, region));
+
+	if (p_from_id == p_to_id) {
+		return Vector2i();
+	}
+
+	LocalVector<int32_t> *flow_field = flow_fields.getptr(p_to_id);
+	if (!flow_field) {
+		if (flow_fields.size() >= MAX_FLOW_FIELDS) {
+			flow_fields.remove(flow_fields.begin());
+		}
+		flow_field = &flow_fields.insert(p_to_id, LocalVector<int32_t>())->value;
+		_build_flow_field(p_to_id, *flow_field);
+	}
+
+	const int32_t next_index = (*flow_field)[(p_from_id.y - region.position.y) * region.size.x + p_from_id.x - region.position.x];
+	if (next_index < 0) {
+		return Vector2i();
+	}
+
+	const Vector2i next_id(next_index % region.size.x + region.position.x, next_index / region.size.x + region.position.y);
+	return next_id - p_from_id;
+}
+
+void AStarGrid2D::clear_flow_fields() {
+	flow_fields.clear();
+}
+
 void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_region", "region"), &AStarGrid2D::set_region);
 	ClassDB::bind_method(D_METHOD("get_region"), &AStarGrid2D::get_region);
@@ -797,6 +894,8 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_data_in_region", "region"), &AStarGrid2D::get_point_data_in_region);
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_flow_direction", "from_id", "to_id"), &AStarGrid2D::get_flow_direction);
+	ClassDB::bind_method(D_METHOD("clear_flow_fields"), &AStarGrid2D::clear_flow_fields);
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
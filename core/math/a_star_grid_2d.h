@@ -40,6 +40,7 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 
 class AStarGrid2D : public RefCounted {
@@ -124,6 +125,22 @@ private:
 
 	uint64_t pass = 1;
 
+	struct FlowEntry {
+		real_t cost = 0;
+		int32_t index = -1;
+	};
+
+	struct SortFlowEntries {
+		_FORCE_INLINE_ bool operator()(const FlowEntry &A, const FlowEntry &B) const { ///< Returns true when the entry A is worse than entry B.
+			return A.cost > B.cost;
+		}
+	};
+
+	static constexpr uint32_t MAX_FLOW_FIELDS = 16;
+
+	/// Flow fields by goal point. For each point in the region, stores the index of the next point toward the goal, or -1 if the goal is not reachable.
+	HashMap<Vector2i, LocalVector<int32_t>> flow_fields;
+
 private: // Internal routines.
 	_FORCE_INLINE_ size_t _to_mask_index(int32_t p_x, int32_t p_y) const {
 		return ((p_y - region.position.y + 1) * (region.size.x + 2)) + p_x - region.position.x + 1;
@@ -167,6 +184,7 @@ private: // Internal routines.
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
 	Point *_jump(Point *p_from, Point *p_to);
 	bool _solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
+	void _build_flow_field(const Vector2i &p_to_id, LocalVector<int32_t> &r_flow_field);
 	Point *_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive = false);
 
 protected:
@@ -236,6 +254,9 @@ public:
 	TypedArray<Dictionary> get_point_data_in_region(const Rect2i &p_region) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
+
+	Vector2i get_flow_direction(const Vector2i &p_from, const Vector2i &p_to);
+	void clear_flow_fields();
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
@@ -38,6 +38,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/os/safe_binary_mutex.h"
@@ -56,11 +57,46 @@ void WorkerThreadPool::Task::free_template_userdata() {
 
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
+bool WorkerThreadPool::LocalTaskQueue::push(Task *p_task) {
+	const uint32_t t = tail.load(std::memory_order_relaxed);
+	if (t - head.load(std::memory_order_acquire) >= CAPACITY) {
+		return false;
+	}
+	slots[t % CAPACITY].store(p_task, std::memory_order_relaxed);
+	tail.store(t + 1, std::memory_order_release);
+	return true;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::LocalTaskQueue::pop() {
+	uint32_t h = head.load(std::memory_order_acquire);
+	while (true) {
+		if (h == tail.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+		// The slot may be overwritten by a push after other consumers advanced the head,
+		// but in that case the exchange below fails and the value is discarded.
+		Task *task = slots[h % CAPACITY].load(std::memory_order_relaxed);
+		if (head.compare_exchange_weak(h, h + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+			return task;
+		}
+	}
+}
+
 #ifdef THREADS_ENABLED
 thread_local WorkerThreadPool::UnlockableLocks WorkerThreadPool::unlockable_locks[MAX_UNLOCKABLE_LOCKS];
 #endif
 
-void WorkerThreadPool::_process_task(Task *p_task) {
+void WorkerThreadPool::_start_task(Task *p_task, ThreadData &r_thread_data) {
+	p_task->pool_thread_index = r_thread_data.index;
+	r_thread_data.current_task = p_task;
+	r_thread_data.has_pump_task = p_task->is_pump_task;
+	if (p_task->pending_notify_yield_over) {
+		r_thread_data.yield_is_over = true;
+	}
+}
+
+void WorkerThreadPool::_process_task(Task *p_task, bool p_started, Task **r_next_task) {
+	TRACE_ZONE("WorkerThreadPool::task");
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
 	ThreadData &curr_thread = threads[pool_thread_index];
@@ -80,15 +116,12 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// about to be run uses scripting, guarantees are held.
 		ScriptServer::thread_enter();
 
-		task_mutex.lock();
-		p_task->pool_thread_index = pool_thread_index;
-		prev_task = curr_thread.current_task;
-		curr_thread.current_task = p_task;
-		curr_thread.has_pump_task = p_task->is_pump_task;
-		if (p_task->pending_notify_yield_over) {
-			curr_thread.yield_is_over = true;
+		if (!p_started) {
+			_lock_task_mutex(pool_thread_index);
+			prev_task = curr_thread.current_task;
+			_start_task(p_task, curr_thread);
+			task_mutex.unlock();
 		}
-		task_mutex.unlock();
 	}
 #endif
 
@@ -133,15 +166,13 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
 
+		_lock_task_mutex(p_task->pool_thread_index);
 		if (finished_users == max_users) {
 			// Get rid of the group, because nobody else is using it.
-			MutexLock task_lock(task_mutex);
 			group_allocator.free(p_task->group);
 		}
 
 		// For groups, tasks get rid of themselves.
-
-		task_mutex.lock();
 		task_allocator.free(p_task);
 	} else {
 		if (p_task->native_func) {
@@ -153,7 +184,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.call();
 		}
 
-		task_mutex.lock();
+		_lock_task_mutex(p_task->pool_thread_index);
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
 		if (p_task->waiting_user) {
@@ -181,6 +212,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			}
 		}
 
+		if (r_next_task) {
+			// Start the next local task while the mutex is held anyway, so that the worker loop
+			// only locks the mutex once per task.
+			*r_next_task = _pop_local_task(&curr_thread);
+			if (*r_next_task) {
+				_start_task(*r_next_task, curr_thread);
+			}
+		}
+
 		task_mutex.unlock();
 	}
 
@@ -192,10 +232,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 	Thread::set_name(vformat("WorkerThread %d", thread_data->index));
+#ifdef DEBUG_ENABLED
+	TraceProfiler::set_thread_name(vformat("WorkerThread %d", thread_data->index));
+#endif
 
+	Task *task_to_process = nullptr;
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// While there's work in the local queues, the next task is started when the previous one completes,
+		// so the mutex is only locked once per task.
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -208,22 +253,33 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
-					continue;
+				// Local queues first, so tasks posted earlier in the local queues
+				// are not overtaken by later ones in the shared queue.
+				task_to_process = thread_data->pool->_pop_local_task(thread_data);
+				if (task_to_process) {
+					break;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				if (thread_data->pool->task_queue.first()) {
+					// Got a task to process! Remove it from the queue, then break into the task handling section.
+					task_to_process = thread_data->pool->task_queue.first()->self();
+					thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+					thread_data->pool->shared_pops++;
+					break;
+				}
+
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->cond_var.wait(lock);
 			}
+
+			thread_data->pool->_start_task(task_to_process, *thread_data);
 		}
 
 		DEV_ASSERT(task_to_process);
-		thread_data->pool->_process_task(task_to_process);
+		Task *next_task = nullptr;
+		thread_data->pool->_process_task(task_to_process, true, &next_task);
+		task_to_process = next_task;
 	}
 }
 
@@ -247,11 +303,20 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 	uint32_t to_promote = 0;
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+	bool idle_threads_left = true;
 
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			// High priority native and template tasks can be run by any thread without further bookkeeping,
+			// so they go to the local queues, where workers can take them without locking.
+			bool queued_locally = false;
+			if (p_high_priority && !p_pump_task && !p_tasks[i]->callable.is_valid()) {
+				queued_locally = _push_local_task(p_tasks[i], caller_pool_thread, idle_threads_left);
+			}
+			if (!queued_locally) {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -323,6 +388,70 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 	}
 }
 
+bool WorkerThreadPool::_push_local_task(Task *p_task, ThreadData *p_caller_pool_thread, bool &r_idle_threads_left) {
+	// Prefer the queues of threads not running any task, so work doesn't wait behind a long-running task
+	// until someone steals it.
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 0; i < thread_count && r_idle_threads_left; i++) {
+		ThreadData &th = threads[local_queue_index];
+		local_queue_index = (local_queue_index + 1) % thread_count;
+		if (!th.current_task && th.local_queue.push(p_task)) {
+			return true;
+		}
+	}
+	r_idle_threads_left = false;
+
+	// All threads are busy. A pool thread posting work is likely to wait for it next, so it will pick it up again,
+	// unless someone else steals it first. Other threads fall back to the shared queue.
+	if (p_caller_pool_thread) {
+		return p_caller_pool_thread->local_queue.push(p_task);
+	}
+	return false;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_local_task(ThreadData *p_thread_data) {
+	Task *task = p_thread_data->local_queue.pop();
+	if (task) {
+		p_thread_data->local_pops.increment();
+		return task;
+	}
+
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		task = threads[(p_thread_data->index + i) % thread_count].local_queue.pop();
+		if (task) {
+			p_thread_data->steals.increment();
+			return task;
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_local_tasks() const {
+	for (const ThreadData &th : threads) {
+		if (!th.local_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void WorkerThreadPool::_count_mutex_contention(int p_pool_thread_index) {
+	if (p_pool_thread_index >= 0) {
+		threads[p_pool_thread_index].mutex_contentions.increment();
+	} else {
+		user_mutex_contentions.increment();
+	}
+}
+
+void WorkerThreadPool::_lock_task_mutex(int p_pool_thread_index) {
+	if (likely(task_mutex.try_lock())) {
+		return;
+	}
+	_count_mutex_contention(p_pool_thread_index);
+	task_mutex.lock();
+}
+
 bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
@@ -493,6 +622,7 @@ void WorkerThreadPool::_unlock_unlockable_mutexes() {
 }
 
 void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, Task *p_task) {
+	TRACE_ZONE("WorkerThreadPool::wait");
 	while (true) {
 		Task *task_to_process = nullptr;
 		bool relock_unlockables = false;
@@ -523,7 +653,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_local_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -541,13 +671,16 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
+			task_to_process = _pop_local_task(p_caller_pool_thread);
+
+			if (!task_to_process && p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				if ((p_task == ThreadData::YIELDING || p_caller_pool_thread->has_pump_task == true) && task_to_process->is_pump_task) {
 					task_to_process = nullptr;
 					_notify_threads(p_caller_pool_thread, 1, 0);
 				} else {
 					task_queue.remove(task_queue.first());
+					shared_pops++;
 				}
 			}
 
@@ -595,7 +728,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_local_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -814,6 +947,32 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
+WorkerThreadPool::ContentionStats WorkerThreadPool::get_contention_stats() const {
+	ContentionStats stats;
+	for (const ThreadData &th : threads) {
+		stats.local_pops += th.local_pops.get();
+		stats.steals += th.steals.get();
+		stats.mutex_contentions += th.mutex_contentions.get();
+	}
+	stats.mutex_contentions += user_mutex_contentions.get();
+
+	MutexLock task_lock(task_mutex);
+	stats.shared_pops = shared_pops;
+	return stats;
+}
+
+void WorkerThreadPool::reset_contention_stats() {
+	for (ThreadData &th : threads) {
+		th.local_pops.set(0);
+		th.steals.set(0);
+		th.mutex_contentions.set(0);
+	}
+	user_mutex_contentions.set(0);
+
+	MutexLock task_lock(task_mutex);
+	shared_pops = 0;
+}
+
 void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
 	ERR_FAIL_COND(threads.size() > 0);
 
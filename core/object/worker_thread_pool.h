@@ -105,6 +105,21 @@ private:
 				task_elem(this) {}
 	};
 
+	/// Bounded ring of tasks owned by a worker thread. Pushes are serialized by `task_mutex`,
+	/// while the owner and any other (stealing) thread take tasks from the front without locking.
+	struct LocalTaskQueue {
+		static const uint32_t CAPACITY = 256;
+
+		std::atomic<Task *> slots[CAPACITY] = {};
+		std::atomic<uint32_t> head = 0;
+		std::atomic<uint32_t> tail = 0;
+
+		/// Must be called with `task_mutex` held. Returns false if the queue is full.
+		bool push(Task *p_task);
+		Task *pop();
+		_FORCE_INLINE_ bool is_empty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+	};
+
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
 
@@ -130,6 +145,12 @@ private:
 		Task *awaited_task = nullptr; ///< Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		LocalTaskQueue local_queue;
+
+		// Contention counters, only incremented by this thread.
+		SafeNumeric<uint64_t> local_pops;
+		SafeNumeric<uint64_t> steals;
+		SafeNumeric<uint64_t> mutex_contentions;
 
 		ThreadData() :
 				signaled(false),
@@ -175,6 +196,10 @@ private:
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; ///< For rotating across threads, no help distributing load.
+	uint32_t local_queue_index = 0; ///< For rotating across local queues when posting.
+
+	uint64_t shared_pops = 0; ///< Protected by `task_mutex`.
+	SafeNumeric<uint64_t> user_mutex_contentions; ///< Contention seen by threads not in the pool.
 
 	uint64_t last_task = 1;
 	int pump_task_count = 0;
@@ -183,7 +208,11 @@ private:
 
 	static void _thread_function(void *p_user);
 
-	void _process_task(Task *task);
+	/// Must be called with `task_mutex` held, by the thread that is about to process the task.
+	void _start_task(Task *p_task, ThreadData &r_thread_data);
+	/// Unless `p_started`, locks `task_mutex` to start the task first. When `r_next_task` is given, the next local task
+	/// is popped and started under the same lock that completes this one.
+	void _process_task(Task *p_task, bool p_started = false, Task **r_next_task = nullptr);
 
 	/// Fall back to processing on the calling thread if there are no worker threads.
 	/// Separated into its own variable to make it easier to extend this logic
@@ -199,6 +228,16 @@ private:
 
 	bool _try_promote_low_priority_task();
 
+	/// Must be called with `task_mutex` held. Returns false if the task has to go to the shared queue.
+	bool _push_local_task(Task *p_task, ThreadData *p_caller_pool_thread, bool &r_idle_threads_left);
+	/// Takes a task from the local queue of the given thread, or steals one from another thread.
+	Task *_pop_local_task(ThreadData *p_thread_data);
+	bool _has_local_tasks() const;
+
+	/// Locks `task_mutex`, recording whether it had to wait for another thread.
+	void _lock_task_mutex(int p_pool_thread_index);
+	void _count_mutex_contention(int p_pool_thread_index);
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -285,6 +324,15 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	struct ContentionStats {
+		uint64_t local_pops = 0; ///< Tasks taken by a worker from its own local queue.
+		uint64_t steals = 0; ///< Tasks taken by a worker from another worker's local queue.
+		uint64_t shared_pops = 0; ///< Tasks taken from the shared, mutex-protected queues.
+		uint64_t mutex_contentions = 0; ///< Times the task mutex was found held by another thread.
+	};
+	ContentionStats get_contention_stats() const;
+	void reset_contention_stats();
+
 	_FORCE_INLINE_ int get_thread_count() const {
 #ifdef THREADS_ENABLED
 		return threads.size();
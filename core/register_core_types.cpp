@@ -45,6 +45,7 @@
 #include "core/crypto/crypto.h"
 #include "core/crypto/hashing_context.h"
 #include "core/debugger/engine_profiler.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/extension/gdextension.h"
 #include "core/extension/gdextension_manager.h"
 #include "core/input/input.h"
@@ -61,6 +62,7 @@
 #include "core/io/json.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
+#include "core/io/packed_data_table.h"
 #include "core/io/packet_peer.h"
 #include "core/io/packet_peer_dtls.h"
 #include "core/io/packet_peer_udp.h"
@@ -73,6 +75,7 @@
 #include "core/io/tcp_server.h"
 #include "core/io/translation_loader_po.h"
 #include "core/io/udp_server.h"
+#include "core/io/variant_snapshot.h"
 #include "core/io/xml_parser.h"
 #include "core/math/a_star.h"
 #include "core/math/a_star_grid_2d.h"
@@ -278,6 +281,8 @@ void register_core_types() {
 
 	GDREGISTER_CLASS(XMLParser);
 	GDREGISTER_CLASS(JSON);
+	GDREGISTER_CLASS(VariantSnapshotWriter);
+	GDREGISTER_CLASS(VariantSnapshotReader);
 
 	GDREGISTER_CLASS(ConfigFile);
 
@@ -288,6 +293,7 @@ void register_core_types() {
 	GDREGISTER_CLASS(AStarGrid2D);
 	GDREGISTER_CLASS(EncodedObjectAsID);
 	GDREGISTER_CLASS(RandomNumberGenerator);
+	GDREGISTER_CLASS(PackedDataTable);
 #ifndef DISABLE_DEPRECATED
 	GDREGISTER_CLASS(PackedDataContainer);
 	GDREGISTER_ABSTRACT_CLASS(PackedDataContainerRef);
@@ -425,6 +431,8 @@ void unregister_core_types() {
 	// Destroy singletons in reverse order to ensure dependencies are not broken.
 
 	memdelete(worker_thread_pool);
+	// All pool threads are gone, so no zone can be recorded past this point.
+	TraceProfiler::finalize();
 
 	memdelete(_engine_debugger);
 	memdelete(_marshalls);
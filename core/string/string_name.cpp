@@ -47,9 +47,79 @@ struct StringName::Table {
 	constexpr static uint32_t TABLE_LEN = 1 << TABLE_BITS;
 	constexpr static uint32_t TABLE_MASK = TABLE_LEN - 1;
 
+	// Buckets are split into shards, each with its own lock and allocator, so threads
+	// interning different names rarely have to wait for each other.
+	constexpr static uint32_t SHARD_BITS = 6;
+	constexpr static uint32_t SHARD_LEN = 1 << SHARD_BITS;
+	constexpr static uint32_t SHARD_MASK = SHARD_LEN - 1;
+
+	struct Shard {
+		BinaryMutex mutex;
+		PagedAllocator<_Data, false, 256> allocator;
+	};
+
 	static inline _Data *table[TABLE_LEN];
-	static inline BinaryMutex mutex;
-	static inline PagedAllocator<_Data> allocator;
+	static inline Shard shards[SHARD_LEN];
+
+	// Since the shard is taken from the lowest bits of the hash, all names in a bucket share the same shard.
+	_FORCE_INLINE_ static Shard &get_shard(uint32_t p_hash) { return shards[p_hash & SHARD_MASK]; }
+};
+
+struct StringName::ThreadCache {
+	constexpr static uint32_t CACHE_BITS = 8;
+	constexpr static uint32_t CACHE_LEN = 1 << CACHE_BITS;
+	constexpr static uint32_t CACHE_MASK = CACHE_LEN - 1;
+
+	// Recently interned C strings, indexed by hash. Each entry holds a reference, so a hit
+	// only needs to compare the name and add a reference, without locking the table.
+	_Data *entries[CACHE_LEN] = {};
+
+	// Every thread's cache is registered, so cleanup() can drop them all before the table is freed.
+	ThreadCache *prev = nullptr;
+	ThreadCache *next = nullptr;
+
+	static inline BinaryMutex registry_mutex;
+	static inline ThreadCache *registry = nullptr;
+
+	static ThreadCache &get() {
+		static thread_local ThreadCache cache;
+		return cache;
+	}
+
+	// Releases the references held by the entries. Must be called with the registry locked.
+	void release() {
+		for (uint32_t i = 0; i < CACHE_LEN; i++) {
+			if (entries[i]) {
+				StringName(entries[i]).unref();
+				entries[i] = nullptr;
+			}
+		}
+	}
+
+	ThreadCache() {
+		MutexLock lock(registry_mutex);
+		next = registry;
+		if (registry) {
+			registry->prev = this;
+		}
+		registry = this;
+	}
+
+	~ThreadCache() {
+		MutexLock lock(registry_mutex);
+		if (prev) {
+			prev->next = next;
+		} else {
+			registry = next;
+		}
+		if (next) {
+			next->prev = prev;
+		}
+		// After cleanup() the entries were already forgotten, since the table no longer exists.
+		if (configured) {
+			release();
+		}
+	}
 };
 
 void StringName::setup() {
@@ -61,7 +131,14 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(Table::mutex);
+	{
+		// Threads that are still alive keep their cache, so drop the references held by every
+		// registered cache now. Their destructors then have nothing left to release.
+		MutexLock lock(ThreadCache::registry_mutex);
+		for (ThreadCache *cache = ThreadCache::registry; cache; cache = cache->next) {
+			cache->release();
+		}
+	}
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -105,7 +182,7 @@ void StringName::cleanup() {
 			}
 
 			Table::table[i] = Table::table[i]->next;
-			Table::allocator.free(d);
+			Table::get_shard(d->hash).allocator.free(d);
 		}
 	}
 	if (lost_strings) {
@@ -118,7 +195,8 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(Table::mutex);
+		Table::Shard &shard = Table::get_shard(_data->hash);
+		MutexLock lock(shard.mutex);
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			ERR_PRINT("BUG: Unreferenced static string to 0: " + _data->name);
@@ -133,7 +211,7 @@ void StringName::unref() {
 		if (_data->next) {
 			_data->next->prev = _data->prev;
 		}
-		Table::allocator.free(_data);
+		shard.allocator.free(_data);
 	}
 
 	_data = nullptr;
@@ -219,9 +297,43 @@ StringName::StringName(const char *p_name, bool p_static) {
 	}
 
 	const uint32_t hash = String::hash(p_name);
+
+#ifdef DEBUG_ENABLED
+	const bool use_cache = !debug_stringname;
+#else
+	const bool use_cache = true;
+#endif
+	if (!use_cache) {
+		_intern(p_name, hash, p_static);
+		return;
+	}
+
+	_Data *&cached = ThreadCache::get().entries[hash & ThreadCache::CACHE_MASK];
+	if (cached && cached->hash == hash && cached->name == p_name) {
+		// The cache holds a reference, so this can't fail.
+		cached->refcount.ref();
+		_data = cached;
+		if (p_static) {
+			_data->static_count.increment();
+		}
+		return;
+	}
+
+	_intern(p_name, hash, p_static);
+
+	if (_data && _data->refcount.ref()) {
+		// Keep a reference for the cache, releasing the name it replaces.
+		StringName(cached).unref();
+		cached = _data;
+	}
+}
+
+void StringName::_intern(const char *p_name, uint32_t p_hash, bool p_static) {
+	const uint32_t hash = p_hash;
 	const uint32_t idx = hash & Table::TABLE_MASK;
 
-	MutexLock lock(Table::mutex);
+	Table::Shard &shard = Table::get_shard(hash);
+	MutexLock lock(shard.mutex);
 	_data = Table::table[idx];
 
 	while (_data) {
@@ -245,7 +357,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return;
 	}
 
-	_data = Table::allocator.alloc();
+	_data = shard.allocator.alloc();
 	_data->name = p_name;
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
@@ -278,7 +390,8 @@ StringName::StringName(const String &p_name, bool p_static) {
 	const uint32_t hash = p_name.hash();
 	const uint32_t idx = hash & Table::TABLE_MASK;
 
-	MutexLock lock(Table::mutex);
+	Table::Shard &shard = Table::get_shard(hash);
+	MutexLock lock(shard.mutex);
 	_data = Table::table[idx];
 
 	while (_data) {
@@ -301,7 +414,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	_data = Table::allocator.alloc();
+	_data = shard.allocator.alloc();
 	_data->name = p_name;
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
@@ -47,6 +47,7 @@ class Main;
 
 class [[nodiscard]] StringName {
 	struct Table;
+	struct ThreadCache;
 
 	struct _Data {
 		SafeRefCount refcount;
@@ -65,6 +66,7 @@ class [[nodiscard]] StringName {
 	_Data *_data = nullptr;
 
 	void unref();
+	void _intern(const char *p_name, uint32_t p_hash, bool p_static);
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
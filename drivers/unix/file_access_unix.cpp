@@ -44,6 +44,7 @@
 #include "core/string/print_string.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -189,6 +190,10 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 	if (fd != -1) {
 		int opts = fcntl(fd, F_GETFD);
 		fcntl(fd, F_SETFD, opts | FD_CLOEXEC);
+
+		if (p_mode_flags == READ && is_memory_mapping_enabled()) {
+			_map(fd);
+		}
 	}
 
 	last_error = OK;
@@ -196,11 +201,45 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 	return OK;
 }
 
+void FileAccessUnix::_map(int p_fd) {
+	// Small files are cheaper to read than to map and unmap.
+	constexpr uint64_t MIN_MAPPED_SIZE = 64 * 1024;
+
+	struct stat st = {};
+	if (fstat(p_fd, &st) != 0 || !S_ISREG(st.st_mode) || (uint64_t)st.st_size < MIN_MAPPED_SIZE || (uint64_t)st.st_size > SIZE_MAX) {
+		return;
+	}
+
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, p_fd, 0);
+	if (data == MAP_FAILED) {
+		// Not fatal, reads fall back to the buffered stream.
+		return;
+	}
+
+	mapped_data = (const uint8_t *)data;
+	mapped_length = st.st_size;
+	mapped_pos = 0;
+	mapped_eof = false;
+}
+
+void FileAccessUnix::_unmap() {
+	if (!mapped_data) {
+		return;
+	}
+
+	munmap((void *)mapped_data, mapped_length);
+	mapped_data = nullptr;
+	mapped_length = 0;
+	mapped_pos = 0;
+	mapped_eof = false;
+}
+
 void FileAccessUnix::_close() {
 	if (!f) {
 		return;
 	}
 
+	_unmap();
 	fclose(f);
 	f = nullptr;
 
@@ -255,6 +294,13 @@ String FileAccessUnix::get_real_path() const {
 void FileAccessUnix::seek(uint64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
+	if (mapped_data) {
+		mapped_pos = p_position;
+		mapped_eof = false;
+		last_error = OK;
+		return;
+	}
+
 	if (fseeko(f, p_position, SEEK_SET)) {
 		check_errors();
 	}
@@ -263,6 +309,11 @@ void FileAccessUnix::seek(uint64_t p_position) {
 void FileAccessUnix::seek_end(int64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
+	if (mapped_data) {
+		seek(mapped_length + p_position);
+		return;
+	}
+
 	if (fseeko(f, p_position, SEEK_END)) {
 		check_errors();
 	}
@@ -271,6 +322,10 @@ void FileAccessUnix::seek_end(int64_t p_position) {
 uint64_t FileAccessUnix::get_position() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
+	if (mapped_data) {
+		return mapped_pos;
+	}
+
 	int64_t pos = ftello(f);
 	if (pos < 0) {
 		check_errors();
@@ -282,6 +337,10 @@ uint64_t FileAccessUnix::get_position() const {
 uint64_t FileAccessUnix::get_length() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
+	if (mapped_data) {
+		return mapped_length;
+	}
+
 	int64_t pos = ftello(f);
 	ERR_FAIL_COND_V(pos < 0, 0);
 	ERR_FAIL_COND_V(fseeko(f, 0, SEEK_END), 0);
@@ -293,6 +352,9 @@ uint64_t FileAccessUnix::get_length() const {
 }
 
 bool FileAccessUnix::eof_reached() const {
+	if (mapped_data) {
+		return mapped_eof;
+	}
 	return feof(f);
 }
 
@@ -300,12 +362,39 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_NULL_V_MSG(f, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
+	if (mapped_data) {
+		uint64_t available = mapped_pos < mapped_length ? mapped_length - mapped_pos : 0;
+		uint64_t read = MIN(p_length, available);
+		memcpy(p_dst, mapped_data + mapped_pos, read);
+		mapped_pos += read;
+
+		// Mirror stdio, which only flags EOF once a read comes up short.
+		mapped_eof = read < p_length;
+		last_error = mapped_eof ? ERR_FILE_EOF : OK;
+		return read;
+	}
+
 	uint64_t read = fread(p_dst, 1, p_length, f);
 	check_errors();
 
 	return read;
 }
 
+Span<uint8_t> FileAccessUnix::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, Span<uint8_t>(), "File must be opened before use.");
+
+	if (!mapped_data || mapped_pos > mapped_length || p_length > mapped_length - mapped_pos) {
+		return Span<uint8_t>();
+	}
+
+	Span<uint8_t> view(mapped_data + mapped_pos, p_length);
+	mapped_pos += p_length;
+	// Like a full read through get_buffer(), which does not flag EOF either.
+	mapped_eof = false;
+	last_error = OK;
+	return view;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
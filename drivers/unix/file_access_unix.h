@@ -55,6 +55,14 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	// Read-only memory mapping of the whole file, see `FileAccess::set_memory_mapping_enabled()`.
+	const uint8_t *mapped_data = nullptr;
+	uint64_t mapped_length = 0;
+	mutable uint64_t mapped_pos = 0;
+	mutable bool mapped_eof = false;
+
+	void _map(int p_fd);
+	void _unmap();
 	void _close();
 
 #if defined(TOOLS_ENABLED)
@@ -79,6 +87,7 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
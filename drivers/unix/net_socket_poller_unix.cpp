@@ -0,0 +1,279 @@
+/**************************************************************************/
+/*  net_socket_poller_unix.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file net_socket_poller_unix.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#if defined(UNIX_ENABLED) && !defined(UNIX_SOCKET_UNAVAILABLE)
+
+#include "net_socket_poller_unix.h"
+
+#include "drivers/unix/net_socket_unix.h"
+
+#include <unistd.h>
+#include <cerrno>
+
+NetSocketPoller *NetSocketPollerUnix::_create_func() {
+	return memnew(NetSocketPollerUnix);
+}
+
+void NetSocketPollerUnix::make_default() {
+	_create = _create_func;
+}
+
+int NetSocketPollerUnix::_get_fd(const Ref<NetSocket> &p_socket) {
+	// Every socket on this platform is created by NetSocketUnix::make_default().
+	return static_cast<const NetSocketUnix *>(p_socket.ptr())->_sock;
+}
+
+Error NetSocketPollerUnix::_register(int p_fd, uint32_t p_events, bool p_modify) {
+#ifdef NET_SOCKET_POLLER_EPOLL
+	struct epoll_event ev = {};
+	if (p_events & EVENT_IN) {
+		ev.events |= EPOLLIN | EPOLLRDHUP;
+	}
+	if (p_events & EVENT_OUT) {
+		ev.events |= EPOLLOUT;
+	}
+	ev.data.fd = p_fd;
+
+	int ret = epoll_ctl(epoll_fd, p_modify ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, p_fd, &ev);
+	if (ret != 0 && !p_modify && errno == EEXIST) {
+		ret = epoll_ctl(epoll_fd, EPOLL_CTL_MOD, p_fd, &ev);
+	} else if (ret != 0 && p_modify && errno == ENOENT) {
+		ret = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, p_fd, &ev);
+	}
+	ERR_FAIL_COND_V_MSG(ret != 0, FAILED, "Unable to register socket for polling.");
+#else
+	poll_fds_dirty = true;
+#endif
+	return OK;
+}
+
+void NetSocketPollerUnix::_unregister(int p_fd) {
+#ifdef NET_SOCKET_POLLER_EPOLL
+	epoll_ctl(epoll_fd, EPOLL_CTL_DEL, p_fd, nullptr);
+#else
+	poll_fds_dirty = true;
+#endif
+}
+
+Error NetSocketPollerUnix::add_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) {
+	ERR_FAIL_COND_V(p_socket.is_null() || !p_socket->is_open(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(sockets.has(p_socket.ptr()), ERR_ALREADY_EXISTS);
+
+	const int fd = _get_fd(p_socket);
+
+	// A socket closed without being removed leaves a stale entry behind, and its descriptor may since have been reused.
+	NetSocket **stale = fd_map.getptr(fd);
+	if (stale) {
+		sockets.erase(*stale);
+		fd_map.erase(fd);
+	}
+
+	Error err = _register(fd, p_events, false);
+	if (err != OK) {
+		return err;
+	}
+
+	Entry &e = sockets[p_socket.ptr()];
+	e.socket = p_socket;
+	e.fd = fd;
+	e.id = p_id;
+	e.events = p_events;
+	fd_map[fd] = p_socket.ptr();
+	return OK;
+}
+
+Error NetSocketPollerUnix::modify_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) {
+	ERR_FAIL_COND_V(p_socket.is_null() || !p_socket->is_open(), ERR_INVALID_PARAMETER);
+	Entry *e = sockets.getptr(p_socket.ptr());
+	ERR_FAIL_NULL_V(e, ERR_DOES_NOT_EXIST);
+
+	if (_get_fd(p_socket) != e->fd) {
+		// Reopened since it was added.
+		remove_socket(p_socket);
+		return add_socket(p_socket, p_id, p_events);
+	}
+
+	if (e->events != p_events) {
+		Error err = _register(e->fd, p_events, true);
+		if (err != OK) {
+			return err;
+		}
+		e->events = p_events;
+	}
+	e->id = p_id;
+	return OK;
+}
+
+void NetSocketPollerUnix::remove_socket(const Ref<NetSocket> &p_socket) {
+	ERR_FAIL_COND(p_socket.is_null());
+	Entry *e = sockets.getptr(p_socket.ptr());
+	if (!e) {
+		return;
+	}
+
+	NetSocket **owner = fd_map.getptr(e->fd);
+	if (owner && *owner == p_socket.ptr()) {
+		fd_map.erase(e->fd);
+		// Closed descriptors are dropped by the kernel on their own, and might already belong to another socket.
+		if (p_socket->is_open() && _get_fd(p_socket) == e->fd) {
+			_unregister(e->fd);
+		}
+	}
+	sockets.erase(p_socket.ptr());
+#ifndef NET_SOCKET_POLLER_EPOLL
+	poll_fds_dirty = true;
+#endif
+}
+
+bool NetSocketPollerUnix::has_socket(const Ref<NetSocket> &p_socket) const {
+	return p_socket.is_valid() && sockets.has(p_socket.ptr());
+}
+
+void NetSocketPollerUnix::clear() {
+	sockets.clear();
+	fd_map.clear();
+#ifdef NET_SOCKET_POLLER_EPOLL
+	// Cheaper than unregistering every descriptor.
+	::close(epoll_fd);
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	ERR_FAIL_COND_MSG(epoll_fd < 0, "Unable to create epoll instance.");
+#else
+	poll_fds.clear();
+	poll_fds_dirty = true;
+#endif
+}
+
+Error NetSocketPollerUnix::wait(int p_timeout, LocalVector<Event> &r_events) {
+	r_events.clear();
+	if (sockets.is_empty()) {
+		return ERR_BUSY;
+	}
+
+#ifdef NET_SOCKET_POLLER_EPOLL
+	ERR_FAIL_COND_V(epoll_fd < 0, ERR_UNCONFIGURED);
+
+	if (epoll_events.size() < sockets.size()) {
+		epoll_events.resize(sockets.size());
+	}
+
+	int ret;
+	do {
+		ret = epoll_wait(epoll_fd, epoll_events.ptr(), epoll_events.size(), p_timeout);
+	} while (ret < 0 && errno == EINTR);
+	ERR_FAIL_COND_V_MSG(ret < 0, FAILED, "Error when polling sockets.");
+
+	for (int i = 0; i < ret; i++) {
+		const struct epoll_event &ev = epoll_events[i];
+		NetSocket **socket = fd_map.getptr(ev.data.fd);
+		if (!socket) {
+			continue;
+		}
+
+		uint32_t ready = 0;
+		if (ev.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) {
+			ready |= EVENT_IN; // Hang-ups surface as a zero-length read.
+		}
+		if (ev.events & EPOLLOUT) {
+			ready |= EVENT_OUT;
+		}
+		if (ev.events & EPOLLERR) {
+			ready |= EVENT_ERROR;
+		}
+		r_events.push_back({ sockets[*socket].id, ready });
+	}
+#else
+	if (poll_fds_dirty) {
+		poll_fds.clear();
+		for (const KeyValue<NetSocket *, Entry> &E : sockets) {
+			struct pollfd pfd = {};
+			pfd.fd = E.value.fd;
+			pfd.events = ((E.value.events & EVENT_IN) ? POLLIN : 0) | ((E.value.events & EVENT_OUT) ? POLLOUT : 0);
+			poll_fds.push_back(pfd);
+		}
+		poll_fds_dirty = false;
+	}
+
+	int ret;
+	do {
+		ret = ::poll(poll_fds.ptr(), poll_fds.size(), p_timeout);
+	} while (ret < 0 && errno == EINTR);
+	ERR_FAIL_COND_V_MSG(ret < 0, FAILED, "Error when polling sockets.");
+
+	for (uint32_t i = 0; i < poll_fds.size() && (int)r_events.size() < ret; i++) {
+		const struct pollfd &pfd = poll_fds[i];
+		if (!pfd.revents) {
+			continue;
+		}
+		NetSocket **socket = fd_map.getptr(pfd.fd);
+		if (!socket) {
+			continue;
+		}
+
+		uint32_t ready = 0;
+		if (pfd.revents & (POLLIN | POLLHUP)) {
+			ready |= EVENT_IN; // Hang-ups surface as a zero-length read.
+		}
+		if (pfd.revents & POLLOUT) {
+			ready |= EVENT_OUT;
+		}
+		if (pfd.revents & (POLLERR | POLLNVAL)) {
+			ready |= EVENT_ERROR;
+		}
+		r_events.push_back({ sockets[*socket].id, ready });
+	}
+#endif
+
+	return r_events.is_empty() ? ERR_BUSY : OK;
+}
+
+NetSocketPollerUnix::NetSocketPollerUnix() {
+#ifdef NET_SOCKET_POLLER_EPOLL
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	ERR_FAIL_COND_MSG(epoll_fd < 0, "Unable to create epoll instance.");
+#endif
+}
+
+NetSocketPollerUnix::~NetSocketPollerUnix() {
+#ifdef NET_SOCKET_POLLER_EPOLL
+	if (epoll_fd >= 0) {
+		::close(epoll_fd);
+	}
+#endif
+}
+
+#endif // UNIX_ENABLED && !UNIX_SOCKET_UNAVAILABLE
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  net_socket_poller_unix.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file net_socket_poller_unix.h
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#if defined(UNIX_ENABLED) && !defined(UNIX_SOCKET_UNAVAILABLE)
+
+#include "core/io/net_socket_poller.h"
+
+#if defined(__linux__) && !defined(WEB_ENABLED)
+#define NET_SOCKET_POLLER_EPOLL
+#include <sys/epoll.h>
+#else
+#include <poll.h>
+#endif
+
+class NetSocketPollerUnix : public NetSocketPoller {
+	struct Entry {
+		Ref<NetSocket> socket;
+		int fd = -1;
+		uint64_t id = 0;
+		uint32_t events = 0;
+	};
+
+	HashMap<NetSocket *, Entry> sockets;
+	HashMap<int, NetSocket *> fd_map;
+
+#ifdef NET_SOCKET_POLLER_EPOLL
+	int epoll_fd = -1;
+	LocalVector<struct epoll_event> epoll_events;
+#else
+	LocalVector<struct pollfd> poll_fds; // Rebuilt when the socket set changes.
+	bool poll_fds_dirty = true;
+#endif
+
+	static int _get_fd(const Ref<NetSocket> &p_socket);
+	Error _register(int p_fd, uint32_t p_events, bool p_modify);
+	void _unregister(int p_fd);
+
+protected:
+	static NetSocketPoller *_create_func();
+
+public:
+	static void make_default();
+
+	virtual Error add_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) override;
+	virtual Error modify_socket(const Ref<NetSocket> &p_socket, uint64_t p_id, uint32_t p_events) override;
+	virtual void remove_socket(const Ref<NetSocket> &p_socket) override;
+	virtual bool has_socket(const Ref<NetSocket> &p_socket) const override;
+	virtual int get_socket_count() const override { return sockets.size(); }
+	virtual void clear() override;
+
+	virtual Error wait(int p_timeout, LocalVector<Event> &r_events) override;
+
+	NetSocketPollerUnix();
+	~NetSocketPollerUnix() override;
+};
+
+#endif // UNIX_ENABLED && !UNIX_SOCKET_UNAVAILABLE
@@ -45,6 +45,8 @@
 #include <sys/socket.h>
 
 class NetSocketUnix : public NetSocket {
+	friend class NetSocketPollerUnix;
+
 private:
 	int _sock = -1;
 	IP::Type _ip_type = IP::TYPE_NONE;
@@ -46,6 +46,7 @@
 #include "drivers/unix/dir_access_unix.h"
 #include "drivers/unix/file_access_unix.h"
 #include "drivers/unix/file_access_unix_pipe.h"
+#include "drivers/unix/net_socket_poller_unix.h"
 #include "drivers/unix/net_socket_unix.h"
 #include "drivers/unix/thread_posix.h"
 #include "servers/rendering_server.h"
@@ -188,6 +189,7 @@ void OS_Unix::initialize_core() {
 
 #ifndef UNIX_SOCKET_UNAVAILABLE
 	NetSocketUnix::make_default();
+	NetSocketPollerUnix::make_default();
 	IPUnix::make_default();
 #endif
 	process_map = memnew((HashMap<ProcessID, ProcessInfo>));
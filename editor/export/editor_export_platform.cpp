@@ -43,6 +43,7 @@
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
 #include "core/extension/gdextension.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/io/image_loader.h"
@@ -82,6 +83,28 @@ public:
 			save_func(p_save_func), tracking_saves(p_track_saves) {}
 };
 
+// Compresses an uncompressed binary resource the way ResourceSaver::FLAG_COMPRESS would, but with a zstd dictionary.
+static Vector<uint8_t> _compress_with_dictionary(const Vector<uint8_t> &p_data, const Vector<uint8_t> &p_dictionary) {
+	if (p_data.size() < 4 || memcmp(p_data.ptr(), "RSRC", 4) != 0) {
+		return p_data; // Not a binary resource, or compressed already.
+	}
+
+	// FileAccessCompressed can only write to a file.
+	const String temp_path = EditorPaths::get_singleton()->get_temp_dir().path_join("export_compressed_resource.tmp");
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	fac->configure("RSCC");
+	fac->set_dictionary(p_dictionary);
+	ERR_FAIL_COND_V(fac->open_internal(temp_path, FileAccess::WRITE) != OK, p_data);
+	// Compressed resources don't repeat the magic, FileAccessCompressed writes its own.
+	fac->store_buffer(p_data.ptr() + 4, p_data.size() - 4);
+	fac->close();
+
+	const Vector<uint8_t> compressed = FileAccess::get_file_as_bytes(temp_path);
+	DirAccess::remove_absolute(temp_path);
+	return compressed.is_empty() ? p_data : compressed;
+}
+
 static int _get_pad(int p_alignment, int p_n) {
 	int rest = p_n % p_alignment;
 	int pad = 0;
@@ -1047,6 +1070,12 @@ Vector<String> EditorExportPlatform::get_forced_export_files(const Ref<EditorExp
 		files.push_back(extension_list_config_file);
 	}
 
+	// Needed to load the binary resources compressed with it on export.
+	String zstd_dictionary = get_project_setting(p_preset, "compression/formats/zstd/dictionary");
+	if (!zstd_dictionary.is_empty() && FileAccess::exists(zstd_dictionary)) {
+		files.push_back(zstd_dictionary);
+	}
+
 	return files;
 }
 
@@ -1297,6 +1326,16 @@ Error EditorExportPlatform::export_project_files(const Ref<EditorExportPreset> &
 
 	bool convert_text_to_binary = get_project_setting(p_preset, "editor/export/convert_text_resources_to_binary");
 
+	// Binary resources only use the project's zstd dictionary in exports, which always include it.
+	Vector<uint8_t> zstd_dictionary;
+	const String zstd_dictionary_path = get_project_setting(p_preset, "compression/formats/zstd/dictionary");
+	if (!zstd_dictionary_path.is_empty()) {
+		zstd_dictionary = FileAccess::get_file_as_bytes(zstd_dictionary_path);
+		if (zstd_dictionary.is_empty()) {
+			add_message(EXPORT_MESSAGE_WARNING, TTR("Export"), vformat(TTR("Couldn't load the zstd compression dictionary \"%s\", binary resources will be exported uncompressed."), zstd_dictionary_path));
+		}
+	}
+
 	if (convert_text_to_binary || !customize_resources_plugins.is_empty() || !customize_scenes_plugins.is_empty()) {
 		// See if we have something to open
 		Ref<FileAccess> f = FileAccess::open(export_base_path.path_join("file_cache"), FileAccess::READ);
@@ -1533,6 +1572,9 @@ Error EditorExportPlatform::export_project_files(const Ref<EditorExportPreset> &
 			}
 
 			Vector<uint8_t> array = FileAccess::get_file_as_bytes(export_path);
+			if (!zstd_dictionary.is_empty()) {
+				array = _compress_with_dictionary(array, zstd_dictionary);
+			}
 			err = save_proxy.save_file(p_udata, export_path, array, idx, total, enc_in_filters, enc_ex_filters, key, seed);
 			if (err != OK) {
 				return err;
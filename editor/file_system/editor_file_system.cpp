@@ -56,6 +56,7 @@
 #include "scene/resources/packed_scene.h"
 
 EditorFileSystem *EditorFileSystem::singleton = nullptr;
+bool EditorFileSystem::scan_only = false;
 int EditorFileSystem::nb_files_total = 0;
 EditorFileSystem::ScannedDirectory *EditorFileSystem::first_scan_root_dir = nullptr;
 
@@ -253,7 +254,9 @@ void EditorFileSystem::_load_first_scan_root_dir() {
 	first_scan_root_dir = memnew(ScannedDirectory);
 	first_scan_root_dir->full_path = "res://";
 
+	OS::get_singleton()->benchmark_begin_measure("EditorFileSystem", "Scan Directories");
 	nb_files_total = _scan_new_dir(first_scan_root_dir, d);
+	OS::get_singleton()->benchmark_end_measure("EditorFileSystem", "Scan Directories");
 }
 
 void EditorFileSystem::scan_for_uid() {
@@ -499,7 +502,8 @@ void EditorFileSystem::_scan_filesystem() {
 
 	EditorProgressBG scan_progress("efs", "ScanFS", 1000);
 	ScanProgress sp;
-	sp.hi = nb_files_total;
+	// Every file is stepped through twice, once when its modified times are fetched and once when it is processed.
+	sp.hi = nb_files_total * 2;
 	sp.progress = &scan_progress;
 
 	new_filesystem = memnew(EditorFileSystemDirectory);
@@ -521,6 +525,7 @@ void EditorFileSystem::_scan_filesystem() {
 		nb_files_total = _scan_new_dir(sd, d);
 	}
 
+	_fetch_modified_times(sd, &sp);
 	_process_file_system(sd, new_filesystem, sp, processed_files);
 
 	if (first_scan) {
@@ -1026,6 +1031,11 @@ bool EditorFileSystem::_update_scan_actions() {
 		}
 	}
 
+	if (!reimports.is_empty() && scan_only) {
+		print_line(vformat("Scan only: skipped reimporting %d files.", reimports.size()));
+		reimports.clear();
+	}
+
 	if (!reimports.is_empty()) {
 		if (_scan_import_support(reimports)) {
 			return true;
@@ -1129,8 +1139,8 @@ void EditorFileSystem::scan() {
 	}
 }
 
-void EditorFileSystem::ScanProgress::increment() {
-	current++;
+void EditorFileSystem::ScanProgress::increment(int p_count) {
+	current += p_count;
 	float ratio = current / MAX(hi, 1.0f);
 	if (progress) {
 		progress->step(ratio * 1000.0f);
@@ -1138,7 +1148,7 @@ void EditorFileSystem::ScanProgress::increment() {
 	EditorFileSystem::singleton->scan_total = ratio;
 }
 
-int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+void EditorFileSystem::_list_scanned_directory(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
 	List<String> dirs;
 	List<String> files;
 
@@ -1176,24 +1186,16 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 	dirs.sort_custom<FileNoCaseComparator>();
 	files.sort_custom<FileNoCaseComparator>();
 
-	int nb_files_total_scan = 0;
-
 	for (const String &dir : dirs) {
 		if (da->change_dir(dir) == OK) {
 			String d = da->get_current_dir();
+			da->change_dir(cd);
 
-			if (d == cd || !d.begins_with(cd)) {
-				da->change_dir(cd); //avoid recursion
-			} else {
+			if (d != cd && d.begins_with(cd)) { //avoid recursion
 				ScannedDirectory *sd = memnew(ScannedDirectory);
 				sd->name = dir;
 				sd->full_path = p_dir->full_path.path_join(sd->name);
-
-				nb_files_total_scan += _scan_new_dir(sd, da);
-
 				p_dir->subdirs.push_back(sd);
-
-				da->change_dir("..");
 			}
 		} else {
 			ERR_PRINT("Cannot go into subdir '" + dir + "'.");
@@ -1201,11 +1203,110 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 	}
 
 	p_dir->files = files;
-	nb_files_total_scan += files.size();
+}
+
+void EditorFileSystem::_list_scanned_directory_task(void *p_userdata, uint32_t p_index) {
+	ScannedDirectory *dir = static_cast<ScannedDirectory **>(p_userdata)[p_index];
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
+	if (da->change_dir(dir->full_path) != OK) {
+		ERR_PRINT("Cannot go into subdir '" + dir->full_path + "'.");
+		return;
+	}
+	_list_scanned_directory(dir, da);
+}
+
+int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+	_list_scanned_directory(p_dir, da);
+	int nb_files_total_scan = p_dir->files.size();
+
+	// The rest of the tree is listed one depth level at a time, with a task per directory,
+	// since listing is dominated by file system latency rather than CPU time.
+	LocalVector<ScannedDirectory *> level;
+	for (ScannedDirectory *sd : p_dir->subdirs) {
+		level.push_back(sd);
+	}
+
+	while (!level.is_empty()) {
+		if (level.size() == 1) {
+			_list_scanned_directory_task(level.ptr(), 0);
+		} else {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&EditorFileSystem::_list_scanned_directory_task, level.ptr(), level.size(), -1, false, "Scan directories");
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+
+		LocalVector<ScannedDirectory *> next_level;
+		for (ScannedDirectory *sd : level) {
+			nb_files_total_scan += sd->files.size();
+			for (ScannedDirectory *sub_dir : sd->subdirs) {
+				next_level.push_back(sub_dir);
+			}
+		}
+		level = next_level;
+	}
 
 	return nb_files_total_scan;
 }
 
+void EditorFileSystem::_fetch_modified_times_task(uint32_t p_index, ScannedDirectory **p_dirs) {
+	ScannedDirectory *dir = p_dirs[p_index];
+
+	dir->modified_times.resize(dir->files.size());
+	dir->import_modified_times.resize(dir->files.size());
+
+	uint32_t i = 0;
+	for (const String &file : dir->files) {
+		uint64_t mt = 0;
+		uint64_t import_mt = 0;
+		if (valid_extensions.has(file.get_extension().to_lower())) {
+			const String path = dir->full_path.path_join(file);
+			mt = FileAccess::get_modified_time(path);
+			if (_can_import_file(file)) {
+				import_mt = FileAccess::get_modified_time(path + ".import");
+			}
+		}
+		dir->modified_times[i] = mt;
+		dir->import_modified_times[i] = import_mt;
+		i++;
+	}
+}
+
+void EditorFileSystem::_fetch_modified_times(ScannedDirectory *p_dir, ScanProgress *p_progress) {
+	// Stat every file of the tree up front and in parallel, so that _process_file_system()
+	// only has to compare the results with the file cache.
+	LocalVector<ScannedDirectory *> dirs;
+	dirs.push_back(p_dir);
+	for (uint32_t i = 0; i < dirs.size(); i++) {
+		for (ScannedDirectory *sd : dirs[i]->subdirs) {
+			dirs.push_back(sd);
+		}
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_fetch_modified_times_task, dirs.ptr(), dirs.size(), -1, false, "Scan modified times");
+
+	if (p_progress) {
+		// Keep the progress moving while the workers stat, one step per file like _process_file_system() does.
+		int files_total = 0;
+		for (const ScannedDirectory *sd : dirs) {
+			files_total += sd->files.size();
+		}
+		int files_reported = 0;
+		while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+			const int files_done = (int)((uint64_t)files_total * WorkerThreadPool::get_singleton()->get_group_processed_element_count(group_task) / dirs.size());
+			if (files_done > files_reported) {
+				p_progress->increment(files_done - files_reported);
+				files_reported = files_done;
+			}
+			OS::get_singleton()->delay_usec(1000);
+		}
+		if (files_total > files_reported) {
+			p_progress->increment(files_total - files_reported);
+		}
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 void EditorFileSystem::_process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress, HashSet<String> *r_processed_files) {
 	p_dir->modified_time = FileAccess::get_modified_time(p_scan_dir->full_path);
 
@@ -1217,7 +1318,11 @@ void EditorFileSystem::_process_file_system(const ScannedDirectory *p_scan_dir,
 		_process_file_system(scan_sub_dir, sub_dir, p_progress, r_processed_files);
 	}
 
+	const bool has_modified_times = p_scan_dir->modified_times.size() == (uint32_t)p_scan_dir->files.size();
+	uint32_t file_index = 0;
+
 	for (const String &scan_file : p_scan_dir->files) {
+		const uint32_t scan_file_index = file_index++;
 		String ext = scan_file.get_extension().to_lower();
 		if (!valid_extensions.has(ext)) {
 			p_progress.increment();
@@ -1235,11 +1340,11 @@ void EditorFileSystem::_process_file_system(const ScannedDirectory *p_scan_dir,
 		}
 
 		FileCache *fc = file_cache.getptr(path);
-		uint64_t mt = FileAccess::get_modified_time(path);
+		uint64_t mt = has_modified_times ? p_scan_dir->modified_times[scan_file_index] : FileAccess::get_modified_time(path);
 
 		if (_can_import_file(scan_file)) {
 			//is imported
-			uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
+			uint64_t import_mt = has_modified_times ? p_scan_dir->import_modified_times[scan_file_index] : FileAccess::get_modified_time(path + ".import");
 
 			if (fc) {
 				fi->type = fc->type;
@@ -1476,6 +1581,7 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanPr
 					int nb_files_dir = _scan_new_dir(&sd, d);
 					p_progress.hi += nb_files_dir;
 					diff_nb_files += nb_files_dir;
+					_fetch_modified_times(&sd);
 					_process_file_system(&sd, efd, p_progress, nullptr);
 
 					ItemAction ia;
@@ -3465,8 +3571,10 @@ bool EditorFileSystem::_should_skip_directory(const String &p_path) {
 
 	if (FileAccess::exists(p_path.path_join("project.godot"))) {
 		// Skip if another project inside this.
-		if (EditorFileSystem::get_singleton() == nullptr || EditorFileSystem::get_singleton()->first_scan) {
-			WARN_PRINT_ONCE(vformat("Detected another project.godot at %s. The folder will be ignored.", p_path));
+		// Directories are listed on several threads at once, so WARN_PRINT_ONCE's unsynchronized flag can't be used.
+		static SafeNumeric<uint32_t> nested_project_warnings;
+		if ((EditorFileSystem::get_singleton() == nullptr || EditorFileSystem::get_singleton()->first_scan) && nested_project_warnings.increment() == 1) {
+			WARN_PRINT(vformat("Detected another project.godot at %s. The folder will be ignored.", p_path));
 		}
 		return true;
 	}
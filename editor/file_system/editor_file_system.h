@@ -44,6 +44,7 @@
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -182,6 +183,10 @@ class EditorFileSystem : public Node {
 		Vector<ScannedDirectory *> subdirs;
 		List<String> files;
 
+		// Filled by _fetch_modified_times(), in the same order as `files`.
+		LocalVector<uint64_t> modified_times;
+		LocalVector<uint64_t> import_modified_times;
+
 		~ScannedDirectory();
 	};
 
@@ -243,7 +248,7 @@ class EditorFileSystem : public Node {
 		float hi = 0;
 		int current = 0;
 		EditorProgressBG *progress = nullptr;
-		void increment();
+		void increment(int p_count = 1);
 	};
 
 	struct DirectoryComparator {
@@ -268,6 +273,10 @@ class EditorFileSystem : public Node {
 	HashSet<String> import_extensions;
 
 	static int _scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+	static void _list_scanned_directory(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+	static void _list_scanned_directory_task(void *p_userdata, uint32_t p_index);
+	void _fetch_modified_times(ScannedDirectory *p_dir, ScanProgress *p_progress = nullptr);
+	void _fetch_modified_times_task(uint32_t p_index, ScannedDirectory **p_dirs);
 	void _process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress, HashSet<String> *p_processed_files);
 
 	Thread thread_sources;
@@ -391,6 +400,9 @@ protected:
 public:
 	static EditorFileSystem *get_singleton() { return singleton; }
 
+	// Set by the --scan-only command line option: scans report what would be reimported instead of reimporting it.
+	static bool scan_only;
+
 	EditorFileSystemDirectory *get_filesystem();
 	bool is_scanning() const;
 	bool is_importing() const { return importing; }
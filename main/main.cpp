@@ -42,6 +42,7 @@
 #include "core/core_globals.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -278,6 +279,7 @@ static bool debug_navigation = false;
 static bool debug_avoidance = false;
 static bool debug_canvas_item_redraw = false;
 static bool debug_mute_audio = false;
+static String trace_file;
 #endif
 static int max_fps = -1;
 static int frame_delay = 0;
@@ -558,6 +560,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--scene <path>", "Path or UID of a scene in the project that should be started.\n");
 	print_help_option("-u, --upwards", "Scan folders upwards for project.godot file.\n");
 	print_help_option("--main-pack <file>", "Path to a pack (.pck) file to load.\n");
+	print_help_option("--mmap-reads", "Memory-map packs and large files opened for reading instead of using buffered reads (Unix only).\n");
 #ifdef DISABLE_DEPRECATED
 	print_help_option("--render-thread <mode>", "Render thread mode (\"safe\", \"separate\").\n");
 #else
@@ -652,6 +655,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--debug-avoidance", "Show navigation avoidance debug visuals when running the scene.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
 	print_help_option("--debug-stringnames", "Print all StringName allocations to stdout when the engine quits.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
 	print_help_option("--debug-canvas-item-redraw", "Display a rectangle each time a canvas item requests a redraw (useful to troubleshoot low processor mode).\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
+	print_help_option("--trace-file <path>", "Record timing zones on every thread and save them in Chrome trace format to the given file when the engine quits. The file can be opened in Perfetto or chrome://tracing.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
 
 #endif
 	print_help_option("--max-fps <fps>", "Set a maximum number of frames per second rendered (can be used to limit power usage). A value of 0 results in unlimited framerate.\n");
@@ -673,6 +677,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--check-only", "Only parse for errors and quit (use with --script).\n");
 #ifdef TOOLS_ENABLED
 	print_help_option("--import", "Starts the editor, waits for any resources to be imported, and then quits.\n", CLI_OPTION_AVAILABILITY_EDITOR);
+	print_help_option("--scan-only", "Starts the editor, scans the project file system without importing anything, prints the scan timings, and then quits. Implies --benchmark.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--export-release <preset> <path>", "Export the project in release mode using the given preset and output path. The preset name should match one defined in \"export_presets.cfg\".\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("", "<path> should be absolute or relative to the project directory, and include the filename for the binary (e.g. \"builds/game.exe\").\n");
 	print_help_option("", "The target directory must exist.\n");
@@ -1566,6 +1571,13 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			cmdline_tool = true;
 			wait_for_import = true;
 			quit_after = 1;
+		} else if (arg == "--scan-only") {
+			editor = true;
+			cmdline_tool = true;
+			wait_for_import = true;
+			quit_after = 1;
+			EditorFileSystem::scan_only = true;
+			OS::get_singleton()->set_use_benchmark(true);
 		} else if (arg == "--export-release" || arg == "--export-debug" ||
 				arg == "--export-pack" || arg == "--export-patch") { // Export project
 			// Actually handling is done in start().
@@ -1740,6 +1752,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				goto error;
 			}
 
+		} else if (arg == "--mmap-reads") {
+			FileAccess::set_memory_mapping_enabled(true);
+
 		} else if (arg == "-d" || arg == "--debug") {
 			debug_uri = "local://";
 			OS::get_singleton()->_debug_stdout = true;
@@ -1758,6 +1773,15 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			StringName::set_debug_stringnames(true);
 		} else if (arg == "--debug-mute-audio") {
 			debug_mute_audio = true;
+		} else if (arg == "--trace-file") {
+			if (N) {
+				trace_file = N->get();
+				TraceProfiler::set_enabled(true);
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --trace-file <path>.\n");
+				goto error;
+			}
 #endif
 #if defined(TOOLS_ENABLED) && (defined(WINDOWS_ENABLED) || defined(LINUXBSD_ENABLED))
 		} else if (arg == "--test-rd-support") {
@@ -4824,6 +4848,8 @@ static uint64_t navigation_process_max = 0;
 /// @}
 
 bool Main::iteration() {
+	TRACE_ZONE("Main::iteration");
+
 #ifdef MODULE_MCP_ENABLED
 	if (MCPBridge::get_singleton()) {
 		MCPBridge::get_singleton()->update();
@@ -4929,7 +4955,10 @@ bool Main::iteration() {
 
 #ifndef PHYSICS_3D_DISABLED
 		PhysicsServer3D::get_singleton()->end_sync();
-		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+		{
+			TRACE_ZONE("PhysicsServer3D::step");
+			PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+		}
 #endif // PHYSICS_3D_DISABLED
 
 #ifndef PHYSICS_2D_DISABLED
@@ -5099,6 +5128,11 @@ void Main::cleanup(bool p_force) {
 	}
 
 #ifdef DEBUG_ENABLED
+	if (!trace_file.is_empty()) {
+		TraceProfiler::set_enabled(false);
+		TraceProfiler::save_chrome_trace(trace_file);
+	}
+
 	if (input) {
 		input->flush_frame_parsed_events();
 	}
@@ -56,6 +56,7 @@ complete -c redot -s l -l language -d "Use a specific locale (<locale> being a t
 complete -c redot -l path -d "Path to a project (<directory> must contain a 'project.godot' file)" -r
 complete -c redot -s u -l upwards -d "Scan folders upwards for project.godot file"
 complete -c redot -l main-pack -d "Path to a pack (.pck) file to load" -r
+complete -c redot -l mmap-reads -d "Memory-map packs and large files opened for reading (Unix only)"
 complete -c redot -l render-thread -d "Set the render thread mode" -x -a "unsafe safe separate"
 complete -c redot -l remote-fs -d "Use a remote filesystem (<host/IP>[:<port>] address)" -x
 complete -c redot -l remote-fs-password -d "Password for remote filesystem" -x
@@ -92,6 +93,7 @@ complete -c redot -l remote-debug -d "Enable remote debugging"
 complete -c redot -l debug-collisions -d "Show collision shapes when running the scene"
 complete -c redot -l debug-navigation -d "Show navigation polygons when running the scene"
 complete -c redot -l debug-stringnames -d "Print all StringName allocations to stdout when the engine quits"
+complete -c redot -l trace-file -d "Record timing zones and save them in Chrome trace format when the engine quits" -x
 complete -c redot -l max-fps -d "Set a maximum number of frames per second rendered (can be used to limit power usage), a value of 0 results in unlimited framerate" -x
 complete -c redot -l frame-delay -d "Simulate high CPU load (delay each frame by the given number of milliseconds)" -x
 complete -c redot -l time-scale -d "Force time scale (higher values are faster, 1.0 is normal speed)" -x
@@ -113,6 +115,7 @@ complete -c redot -l no-docbase -d "Disallow dumping the base types (used with -
 complete -c redot -l build-solutions -d "Build the scripting solutions (e.g. for C# projects)"
 complete -c redot -l dump-gdextension-interface -d "Generate GDExtension header file 'gdextension_interface.h' in the current folder. This file is the base file required to implement a GDExtension"
 complete -c redot -l dump-extension-api -d "Generate JSON dump of the Redot API for GDExtension bindings named 'extension_api.json' in the current folder"
+complete -c redot -l scan-only -d "Scan the project file system, print the scan timings, and quit"
 complete -c redot -l benchmark -d "Benchmark the run time and print it to console"
 complete -c redot -l benchmark-file -d "Benchmark the run time and save it to a given file in JSON format" -x
 complete -c redot -l test -d "Run all unit tests; run with '--test --help' for more information" -x
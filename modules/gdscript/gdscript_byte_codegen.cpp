@@ -621,6 +621,7 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		const int operator_pos = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -629,6 +630,9 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+		fusable_operator_pos = operator_pos;
+		fusable_operator_target = p_target;
+		fusable_operator_result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 		return;
 	}
 
@@ -646,6 +650,22 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 }
 
+bool GDScriptByteCodeGenerator::_fuse_operator(const Address &p_result, GDScriptFunction::Opcode p_fused_opcode) {
+	// Only temporaries are fused: they are written by the operator right before being consumed.
+	// The operator still writes its result, so later reads of the temporary stay valid.
+	if (fusable_operator_pos < 0 || opcodes.size() != fusable_operator_pos + 5) {
+		return false;
+	}
+	if (p_result.mode != Address::TEMPORARY || fusable_operator_target.mode != Address::TEMPORARY || p_result.address != fusable_operator_target.address) {
+		return false;
+	}
+
+	// The operands stay in place, so the temporary indices recorded for them remain valid.
+	opcodes.write[fusable_operator_pos] = p_fused_opcode;
+	fusable_operator_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const GDScriptDataType &p_type) {
 	switch (p_type.kind) {
 		case GDScriptDataType::BUILTIN: {
@@ -1000,6 +1020,8 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_target);
 		append(p_source);
 		append(p_target.type.builtin_type);
+	} else if (_fuse_operator(p_source, GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN)) {
+		append(p_target);
 	} else {
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
 		append(p_target);
@@ -1029,6 +1051,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 		write_assign(p_dst, p_src);
 	}
 	function->default_arguments.push_back(opcodes.size());
+	fusable_operator_pos = -1;
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
@@ -1518,8 +1541,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (fusable_operator_result_type != Variant::BOOL || !_fuse_operator(p_condition, GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1790,12 +1815,15 @@ void GDScriptByteCodeGenerator::write_endfor(bool p_is_range) {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	fusable_operator_pos = -1;
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (fusable_operator_result_type != Variant::BOOL || !_fuse_operator(p_condition, GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -106,6 +106,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 
+	/// Start of the last validated operator while it is still the last instruction written, or -1.
+	/// The instruction that consumes its result may then be fused into it, see `_fuse_operator()`.
+	/// Anything that places a jump target after the operator must reset this.
+	int fusable_operator_pos = -1;
+	Address fusable_operator_target;
+	Variant::Type fusable_operator_result_type = Variant::NIL;
+
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
 #endif
@@ -462,8 +469,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		fusable_operator_pos = -1;
 	}
 
+	bool _fuse_operator(const Address &p_result, GDScriptFunction::Opcode p_fused_opcode);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
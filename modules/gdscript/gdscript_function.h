@@ -277,6 +277,8 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_ASSIGN, ///< Validated operator followed by an assignment of its result.
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, ///< Validated boolean operator followed by a conditional jump on its result.
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
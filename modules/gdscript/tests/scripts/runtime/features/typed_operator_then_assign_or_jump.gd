@@ -0,0 +1,59 @@
+# Typed operators followed by an assignment or a conditional jump are fused
+# into a single instruction. These must behave exactly like the unfused ones.
+
+static var static_total: int = 0
+var member_total: int = 0
+var member_scale: float = 1.0
+
+func default_sum(a: int = 2 + 3, b: int = a * 2) -> int:
+	return a + b
+
+func test():
+	var i: int = 0
+	var sum: int = 0
+	while i < 10:
+		sum += i
+		i += 1
+	print(sum)
+
+	for j in 5:
+		member_total += j
+		static_total -= j
+		member_scale *= 2.0
+	print(member_total)
+	print(static_total)
+	print(member_scale)
+
+	var x: float = 2.5
+	if x > 2.0:
+		print("greater")
+	elif x > 1.0:
+		print("not reached")
+	else:
+		print("not reached")
+
+	if x < 2.0:
+		print("not reached")
+	elif x == 2.5:
+		print("equal")
+
+	if i >= 10 and x != 0.0:
+		print("both")
+
+	var countdown: int = 3
+	while countdown > 0:
+		countdown -= 1
+		if countdown == 1:
+			continue
+		print(countdown)
+
+	var v := Vector2(1, 2)
+	v += Vector2(3, 4)
+	print(v)
+
+	var text: String = "a"
+	text += "b"
+	print(text)
+
+	print(default_sum())
+	print(default_sum(1))
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  test_gdscript_benchmark.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file test_gdscript_benchmark.h
+ *
+ * @brief Inner loop throughput of the GDScript VM.
+ *
+ * Runs every script in `tests/data/gdscript_benchmarks`. Each script
+ * defines `ITERATIONS` and `EXPECTED` constants and a `run()` method returning
+ * a checksum, which must match `EXPECTED`. Timings are reported as messages.
+ *
+ * The benchmark takes several seconds, so it is skipped by default. Run it
+ * with `--test --no-skip --tc="*[GDScript][Benchmark]*"`.
+ */
+
+#include "../gdscript.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace GDScriptTests {
+
+TEST_CASE("[Modules][GDScript][Benchmark] Inner loop throughput" * doctest::skip()) {
+	const String benchmarks_path = TestUtils::get_data_path("gdscript_benchmarks");
+	Ref<DirAccess> dir = DirAccess::open(benchmarks_path);
+	REQUIRE_MESSAGE(dir.is_valid(), vformat("The benchmark scripts should be in '%s'.", benchmarks_path));
+
+	PackedStringArray files = dir->get_files();
+	files.sort();
+
+	GDScriptLanguage::get_singleton()->init();
+
+	for (const String &file : files) {
+		if (file.get_extension() != "gd") {
+			continue;
+		}
+
+		Ref<GDScript> gdscript = memnew(GDScript);
+		gdscript->set_source_code(FileAccess::get_file_as_string(benchmarks_path.path_join(file)));
+		ERR_PRINT_OFF;
+		const Error error = gdscript->reload();
+		ERR_PRINT_ON;
+		// Failures don't abort the test case, so the language is always finished below.
+		CHECK_MESSAGE(error == OK, vformat("Benchmark '%s' should compile.", file));
+		if (error != OK) {
+			continue;
+		}
+
+		HashMap<StringName, Variant> constants;
+		gdscript->get_constants(&constants);
+		const int64_t iterations = constants["ITERATIONS"];
+		const int64_t expected = constants["EXPECTED"];
+
+		Ref<RefCounted> instance = memnew(RefCounted);
+		instance->set_script(gdscript);
+
+		// Best of a few runs, to keep the numbers comparable between runs.
+		uint64_t best_usec = UINT64_MAX;
+		for (int run = 0; run < 3; run++) {
+			const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			Callable::CallError call_error;
+			const Variant result = instance->callp(SNAME("run"), nullptr, 0, call_error);
+			best_usec = MIN(best_usec, OS::get_singleton()->get_ticks_usec() - begin);
+
+			CHECK(call_error.error == Callable::CallError::CALL_OK);
+			CHECK_MESSAGE(int64_t(result) == expected, vformat("Benchmark '%s' returned a wrong checksum.", file));
+		}
+
+		MESSAGE(vformat("%s: %.3f msec, %.1f M iterations/sec.", file.get_basename(), best_usec / 1000.0, iterations / double(MAX(best_usec, uint64_t(1)))));
+	}
+
+	GDScriptLanguage::get_singleton()->finish();
+}
+
+} // namespace GDScriptTests
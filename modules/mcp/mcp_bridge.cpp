@@ -43,6 +43,7 @@
 #include "core/input/input_enums.h"
 #include "core/input/input_map.h"
 #include "core/io/json.h"
+#include "core/io/marshalls.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "scene/2d/node_2d.h"
@@ -63,11 +64,16 @@ MCPBridge::MCPBridge() {
 }
 
 MCPBridge::~MCPBridge() {
+	_fail_pending_commands("Bridge destroyed");
 	singleton = nullptr;
 }
 
 void MCPBridge::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("send_command", "action", "args"), &MCPBridge::send_command, DEFVAL(Dictionary()));
+	ClassDB::bind_method(D_METHOD("queue_command", "action", "args"), &MCPBridge::queue_command, DEFVAL(Dictionary()));
+	ClassDB::bind_method(D_METHOD("wait_for_response", "id", "timeout_msec"), &MCPBridge::wait_for_response, DEFVAL(5000));
 	ClassDB::bind_method(D_METHOD("update"), &MCPBridge::update);
+	ClassDB::bind_method(D_METHOD("wait_for_activity", "timeout_msec"), &MCPBridge::wait_for_activity);
 }
 
 Error MCPBridge::start_server(int p_port) {
@@ -105,99 +111,151 @@ Error MCPBridge::connect_to_server(const String &p_host, int p_port) {
 	MutexLock lock(mutex);
 	is_host = false;
 	connection.instantiate();
+	read_buffer.clear();
 	port = p_port;
 	fprintf(stderr, "[MCP] Game process connecting to bridge at %s:%d\n", p_host.utf8().get_data(), port);
 	return connection->connect_to_host(p_host, p_port);
 }
 
-Dictionary MCPBridge::send_command(const String &p_action, const Dictionary &p_args) {
-	Ref<StreamPeerTCP> conn;
-	{
-		MutexLock lock(mutex);
-		if (!connection.is_valid() || connection->get_status() != StreamPeerTCP::STATUS_CONNECTED) {
-			Dictionary err;
-			err["error"] = "Bridge not connected";
-			return err;
+Error MCPBridge::_send_frame(uint32_t p_id, const String &p_payload) {
+	CharString utf8 = p_payload.utf8();
+	ERR_FAIL_COND_V(uint32_t(utf8.length()) > MAX_FRAME_SIZE, ERR_OUT_OF_MEMORY);
+
+	// Header and payload go out in a single write, so a frame never waits on a second segment.
+	write_buffer.resize(FRAME_HEADER_SIZE + utf8.length());
+	encode_uint32(utf8.length(), write_buffer.ptr());
+	encode_uint32(p_id, write_buffer.ptr() + 4);
+	memcpy(write_buffer.ptr() + FRAME_HEADER_SIZE, utf8.get_data(), utf8.length());
+	return connection->put_data(write_buffer.ptr(), write_buffer.size());
+}
+
+bool MCPBridge::_receive_frames(LocalVector<Frame> &r_frames) {
+	int available = connection->get_available_bytes();
+	if (available > 0) {
+		uint32_t old_size = read_buffer.size();
+		read_buffer.resize(old_size + available);
+		int received = 0;
+		connection->get_partial_data(read_buffer.ptr() + old_size, available, received);
+		read_buffer.resize(old_size + MAX(received, 0));
+	}
+
+	uint32_t offset = 0;
+	while (read_buffer.size() - offset >= FRAME_HEADER_SIZE) {
+		const uint8_t *header = read_buffer.ptr() + offset;
+		uint32_t size = decode_uint32(header);
+		if (size > MAX_FRAME_SIZE) {
+			read_buffer.clear();
+			return false;
 		}
-		conn = connection;
+		if (read_buffer.size() - offset - FRAME_HEADER_SIZE < size) {
+			break;
+		}
+		Frame frame;
+		frame.id = decode_uint32(header + 4);
+		// Decoded per frame, so multi-byte UTF-8 sequences spanning TCP reads are never split.
+		frame.payload = String::utf8((const char *)header + FRAME_HEADER_SIZE, size);
+		r_frames.push_back(frame);
+		offset += FRAME_HEADER_SIZE + size;
 	}
 
+	if (offset > 0) {
+		uint32_t remaining = read_buffer.size() - offset;
+		if (remaining > 0) {
+			memmove(read_buffer.ptr(), read_buffer.ptr() + offset, remaining);
+		}
+		read_buffer.resize(remaining);
+	}
+	return true;
+}
+
+void MCPBridge::_complete_command(uint32_t p_id, const Dictionary &p_response) {
+	MutexLock lock(pending_mutex);
+	PendingCommand *command = pending.getptr(p_id);
+	if (!command) {
+		return; // Timed out already.
+	}
+	command->response = p_response;
+	command->done = true;
+	pending_cond.notify_all();
+}
+
+void MCPBridge::_fail_pending_commands(const String &p_error) {
+	MutexLock lock(pending_mutex);
+	bool failed = false;
+	for (KeyValue<uint32_t, PendingCommand> &E : pending) {
+		if (!E.value.done) {
+			E.value.response["error"] = p_error;
+			E.value.done = true;
+			failed = true;
+		}
+	}
+	if (failed) {
+		pending_cond.notify_all();
+	}
+}
+
+uint32_t MCPBridge::queue_command(const String &p_action, const Dictionary &p_args) {
 	Dictionary cmd;
 	cmd["action"] = p_action;
 	cmd["args"] = p_args;
-
 	String json = JSON::stringify(cmd);
-	CharString utf8 = json.utf8();
-	conn->put_data((const uint8_t *)utf8.get_data(), utf8.length());
-	conn->put_u8('\n');
-
-	// Wait for response (blocking with timeout)
-	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
-	CharString raw_buffer;
-	bool got_response = false;
-	while (OS::get_singleton()->get_ticks_msec() - start_time < 5000) {
-		conn->poll();
-		int avail = conn->get_available_bytes();
-		if (avail > 0) {
-			uint8_t buf[4096];
-			int to_read = avail < (int)sizeof(buf) ? avail : (int)sizeof(buf);
-			int read_bytes = 0;
-			conn->get_partial_data(buf, to_read, read_bytes);
-			if (read_bytes > 0) {
-				// Append raw bytes to the buffer (resize + copy).
-				int old_len = raw_buffer.length();
-				raw_buffer.resize_uninitialized(old_len + read_bytes + 1);
-				char *dst = raw_buffer.ptrw();
-				memcpy(dst + old_len, buf, read_bytes);
-				dst[old_len + read_bytes] = 0;
-
-				// Only scan the newly appended bytes for the delimiter.
-				for (int i = old_len; i < old_len + read_bytes; i++) {
-					if (raw_buffer[i] == '\n') {
-						got_response = true;
-						break;
-					}
-				}
-				if (got_response) {
-					break;
-				}
-			}
-		} else {
-			OS::get_singleton()->delay_usec(1000);
-		}
-	}
 
-	if (!got_response) {
-		Dictionary err;
-		err["error"] = "Bridge timeout";
-		return err;
+	MutexLock lock(mutex);
+	if (!connection.is_valid() || connection->get_status() != StreamPeerTCP::STATUS_CONNECTED) {
+		return 0;
 	}
 
-	// Decode the full buffer at once so multi-byte UTF-8 sequences
-	// spanning TCP chunk boundaries are handled correctly.
-	int nl = -1;
-	for (int i = 0; i < raw_buffer.length(); i++) {
-		if (raw_buffer[i] == '\n') {
-			nl = i;
-			break;
+	uint32_t id = 0;
+	{
+		MutexLock pending_lock(pending_mutex);
+		id = next_request_id++;
+		if (next_request_id == 0) {
+			next_request_id = 1;
 		}
+		pending.insert(id, PendingCommand());
 	}
-	int len = (nl >= 0) ? nl : raw_buffer.length();
-	String response_str = String::utf8(raw_buffer.get_data(), len);
-	if (response_str.is_empty()) {
-		Dictionary err;
-		err["error"] = "Empty response";
-		return err;
+
+	if (_send_frame(id, json) != OK) {
+		MutexLock pending_lock(pending_mutex);
+		pending.erase(id);
+		return 0;
 	}
+	return id;
+}
 
-	Variant res_var = JSON::parse_string(response_str);
-	if (res_var.get_type() == Variant::DICTIONARY) {
-		return res_var;
+Dictionary MCPBridge::wait_for_response(uint32_t p_id, int p_timeout_msec) {
+	Dictionary response;
+	if (p_id == 0) {
+		response["error"] = "Bridge not connected";
+		return response;
 	}
 
-	Dictionary err;
-	err["error"] = "Bridge invalid response: " + response_str;
-	return err;
+	// Responses are routed here by whichever thread runs update(), usually the server's bridge thread.
+	uint64_t deadline = OS::get_singleton()->get_ticks_usec() + uint64_t(MAX(p_timeout_msec, 0)) * 1000;
+	MutexLock lock(pending_mutex);
+	while (true) {
+		PendingCommand *command = pending.getptr(p_id);
+		if (!command) {
+			response["error"] = "Unknown bridge request";
+			return response;
+		}
+		if (command->done) {
+			response = command->response;
+			pending.erase(p_id);
+			return response;
+		}
+		uint64_t now = OS::get_singleton()->get_ticks_usec();
+		if (now >= deadline) {
+			pending.erase(p_id);
+			response["error"] = "Bridge timeout";
+			return response;
+		}
+		pending_cond.wait_for_usec(lock, deadline - now);
+	}
+}
+
+Dictionary MCPBridge::send_command(const String &p_action, const Dictionary &p_args) {
+	return wait_for_response(queue_command(p_action, p_args));
 }
 
 void MCPBridge::update() {
@@ -213,6 +271,8 @@ void MCPBridge::update() {
 			}
 			if (!current_ok) {
 				connection = server->take_connection();
+				read_buffer.clear();
+				_fail_pending_commands("Bridge connection replaced");
 				fprintf(stderr, "[MCP] Game process connected to bridge on host side\n");
 			} else {
 				// Drain and discard the extra pending connection.
@@ -221,47 +281,104 @@ void MCPBridge::update() {
 				fprintf(stderr, "[MCP] Bridge: extra pending connection discarded (active connection in use)\n");
 			}
 		}
+
+		if (connection.is_null()) {
+			return;
+		}
+		connection->poll();
+		if (connection->get_status() != StreamPeerTCP::STATUS_CONNECTED) {
+			_fail_pending_commands("Bridge disconnected");
+			return;
+		}
+
+		LocalVector<Frame> frames;
+		if (!_receive_frames(frames)) {
+			fprintf(stderr, "[MCP] Bridge: oversized frame received, dropping connection\n");
+			connection->disconnect_from_host();
+			_fail_pending_commands("Bridge protocol error");
+			return;
+		}
+		for (const Frame &frame : frames) {
+			Variant res_var = JSON::parse_string(frame.payload);
+			if (res_var.get_type() == Variant::DICTIONARY) {
+				_complete_command(frame.id, res_var);
+			} else {
+				Dictionary err;
+				err["error"] = "Bridge invalid response: " + frame.payload;
+				_complete_command(frame.id, err);
+			}
+		}
 	} else {
 		// Client (Game) side
-		if (connection.is_valid()) {
-			connection->poll();
-			if (connection->get_status() == StreamPeerTCP::STATUS_CONNECTED) {
-				Ref<StreamPeerTCP> conn = connection;
-				while (conn->get_available_bytes() > 0) {
-					uint8_t c;
-					int read_bytes;
-					conn->get_partial_data(&c, 1, read_bytes);
-					if (read_bytes > 0) {
-						if (c == '\n') {
-							String cmd_str = partial_data;
-							partial_data = "";
-
-							mutex.unlock();
-							Variant cmd_var = JSON::parse_string(cmd_str);
-							if (cmd_var.get_type() == Variant::DICTIONARY) {
-								Dictionary resp = _process_command(cmd_var);
-								String resp_json = JSON::stringify(resp);
-								CharString utf8 = resp_json.utf8();
-
-								mutex.lock();
-								if (connection.is_valid() && connection->get_status() == StreamPeerTCP::STATUS_CONNECTED) {
-									connection->put_data((const uint8_t *)utf8.get_data(), utf8.length());
-									connection->put_u8('\n');
-								}
-							} else {
-								mutex.lock();
-							}
-						} else {
-							if (partial_data.length() > 1024 * 1024) { // 1MB limit
-								partial_data = "";
-							}
-							partial_data += (char)c;
-						}
-					}
-				}
+		if (connection.is_null()) {
+			return;
+		}
+		connection->poll();
+		if (connection->get_status() != StreamPeerTCP::STATUS_CONNECTED) {
+			return;
+		}
+
+		LocalVector<Frame> frames;
+		if (!_receive_frames(frames)) {
+			fprintf(stderr, "[MCP] Bridge: oversized frame received, dropping connection\n");
+			connection->disconnect_from_host();
+			return;
+		}
+
+		// Everything that arrived is handled in this call; each response is written as soon as it is ready
+		// so pipelined commands don't wait on the slowest one in the batch.
+		for (const Frame &frame : frames) {
+			mutex.unlock();
+			Dictionary resp;
+			Variant cmd_var = JSON::parse_string(frame.payload);
+			if (cmd_var.get_type() == Variant::DICTIONARY) {
+				resp = _process_command(cmd_var);
+			} else {
+				resp["error"] = "Invalid command";
+			}
+			String resp_json = JSON::stringify(resp);
+			mutex.lock();
+
+			if (connection.is_valid() && connection->get_status() == StreamPeerTCP::STATUS_CONNECTED) {
+				_send_frame(frame.id, resp_json);
+			}
+		}
+	}
+}
+
+void MCPBridge::wait_for_activity(int p_timeout_msec) {
+	Ref<NetSocketPoller> active_poller;
+	{
+		MutexLock lock(mutex);
+		if (poller.is_null()) {
+			poller = NetSocketPoller::create();
+		}
+		if (is_host && !polling_server && server->is_listening()) {
+			polling_server = poller->add_socket(server->get_socket(), 0, NetSocketPoller::EVENT_IN) == OK;
+		}
+
+		Ref<NetSocket> socket;
+		if (connection.is_valid() && connection->get_status() == StreamPeerTCP::STATUS_CONNECTED) {
+			socket = connection->get_socket();
+		}
+		if (socket != polled_socket) {
+			if (polled_socket.is_valid()) {
+				poller->remove_socket(polled_socket);
+			}
+			polled_socket = socket;
+			if (polled_socket.is_valid() && poller->add_socket(polled_socket, 1, NetSocketPoller::EVENT_IN) != OK) {
+				polled_socket.unref();
 			}
 		}
+		active_poller = poller;
 	}
+
+	if (active_poller->get_socket_count() == 0) {
+		OS::get_singleton()->delay_usec(uint64_t(p_timeout_msec) * 1000);
+		return;
+	}
+	LocalVector<NetSocketPoller::Event> events;
+	active_poller->wait(p_timeout_msec, events);
 }
 
 void MCPBridge::_trigger_action_event(const StringName &p_action) {
@@ -309,6 +426,11 @@ Dictionary MCPBridge::_process_command(const Dictionary &p_cmd) {
 	Dictionary args = p_cmd.get("args", Dictionary());
 	Dictionary resp;
 
+	if (action == "ping") {
+		resp["status"] = "pong";
+		return resp;
+	}
+
 	fprintf(stderr, "[MCP] Bridge processing command: %s\n", action.utf8().get_data());
 
 	if (action == "capture") {
@@ -38,10 +38,14 @@
  * [Add any documentation that applies to the entire file here!]
  */
 
+#include "core/io/net_socket_poller.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/io/tcp_server.h"
 #include "core/object/class_db.h"
+#include "core/os/condition_variable.h"
 #include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/dictionary.h"
 
 class MCPBridge : public Object {
@@ -56,7 +60,39 @@ private:
 
 	bool is_host = false;
 	int port = 0;
-	String partial_data;
+
+	/// Wire format: every message is a frame made of a little-endian u32 payload size, a u32 request ID
+	/// and a UTF-8 JSON payload. Responses carry the ID of their command, so many commands can be in flight.
+	static constexpr uint32_t FRAME_HEADER_SIZE = 8;
+	static constexpr uint32_t MAX_FRAME_SIZE = 64 * 1024 * 1024;
+
+	struct Frame {
+		uint32_t id = 0;
+		String payload;
+	};
+
+	LocalVector<uint8_t> read_buffer; ///< Bytes received but not yet split into frames, reused between reads.
+	LocalVector<uint8_t> write_buffer;
+
+	/// Host side bookkeeping of the commands waiting for a response.
+	struct PendingCommand {
+		Dictionary response;
+		bool done = false;
+	};
+
+	BinaryMutex pending_mutex;
+	ConditionVariable pending_cond;
+	HashMap<uint32_t, PendingCommand> pending;
+	uint32_t next_request_id = 1;
+
+	Ref<NetSocketPoller> poller;
+	Ref<NetSocket> polled_socket;
+	bool polling_server = false;
+
+	Error _send_frame(uint32_t p_id, const String &p_payload);
+	bool _receive_frames(LocalVector<Frame> &r_frames);
+	void _complete_command(uint32_t p_id, const Dictionary &p_response);
+	void _fail_pending_commands(const String &p_error);
 
 	/// Internal command handling
 	Dictionary _process_command(const Dictionary &p_cmd);
@@ -81,5 +117,10 @@ public:
 
 	/// Communication
 	Dictionary send_command(const String &p_action, const Dictionary &p_args = Dictionary());
+	/// Sends a command without waiting, returns its request ID (0 when not connected) for `wait_for_response()`.
+	uint32_t queue_command(const String &p_action, const Dictionary &p_args = Dictionary());
+	Dictionary wait_for_response(uint32_t p_id, int p_timeout_msec = 5000);
 	void update(); ///< Called by MainLoop or Server loop
+	/// Blocks until the bridge sockets have activity (or the timeout expires), so the caller can `update()` right away.
+	void wait_for_activity(int p_timeout_msec);
 };
@@ -0,0 +1,375 @@
+/**************************************************************************/
+/*  mcp_code_index.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file mcp_code_index.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "mcp_code_index.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/variant/dictionary.h"
+
+#include "modules/modules_enabled.gen.h"
+
+#ifdef MODULE_GDSCRIPT_ENABLED
+#include "modules/gdscript/gdscript_parser.h"
+#include "modules/gdscript/gdscript_tokenizer.h"
+#endif
+
+static String _as_dir(const String &p_dir) {
+	return p_dir.ends_with("/") ? p_dir : p_dir + "/";
+}
+
+#ifdef MODULE_GDSCRIPT_ENABLED
+static void _add_class_symbols(const GDScriptParser::ClassNode *p_class, const String &p_outer, LocalVector<MCPCodeIndex::Symbol> &r_symbols) {
+	for (const GDScriptParser::ClassNode::Member &m : p_class->members) {
+		MCPCodeIndex::Symbol symbol;
+		switch (m.type) {
+			case GDScriptParser::ClassNode::Member::CLASS:
+				symbol.kind = MCPCodeIndex::SYMBOL_CLASS;
+				break;
+			case GDScriptParser::ClassNode::Member::CONSTANT:
+			case GDScriptParser::ClassNode::Member::ENUM_VALUE:
+				symbol.kind = MCPCodeIndex::SYMBOL_CONSTANT;
+				break;
+			case GDScriptParser::ClassNode::Member::ENUM:
+				symbol.kind = MCPCodeIndex::SYMBOL_ENUM;
+				break;
+			case GDScriptParser::ClassNode::Member::FUNCTION:
+				symbol.kind = MCPCodeIndex::SYMBOL_FUNCTION;
+				break;
+			case GDScriptParser::ClassNode::Member::SIGNAL:
+				symbol.kind = MCPCodeIndex::SYMBOL_SIGNAL;
+				break;
+			case GDScriptParser::ClassNode::Member::VARIABLE:
+				symbol.kind = MCPCodeIndex::SYMBOL_VARIABLE;
+				break;
+			default:
+				continue;
+		}
+		symbol.name = m.get_name();
+		symbol.line = m.get_line();
+		symbol.outer = p_outer;
+		r_symbols.push_back(symbol);
+
+		if (m.type == GDScriptParser::ClassNode::Member::CLASS) {
+			_add_class_symbols(m.m_class, p_outer.is_empty() ? String(symbol.name) : p_outer + "." + symbol.name, r_symbols);
+		}
+	}
+}
+#endif // MODULE_GDSCRIPT_ENABLED
+
+bool MCPCodeIndex::_is_stale(const ScriptInfo *p_info, uint64_t p_modified_time) {
+	// Modification times have a one second resolution: a script written during the second it was parsed in
+	// may have changed again without its time changing, so it's parsed again until that second has passed.
+	return !p_info || p_info->modified_time != p_modified_time || p_modified_time >= p_info->indexed_time;
+}
+
+void MCPCodeIndex::_parse_script(const String &p_path, ScriptInfo &r_info) {
+#ifdef MODULE_GDSCRIPT_ENABLED
+	Error err;
+	const String source = FileAccess::get_file_as_string(p_path, &err);
+	if (err != OK) {
+		r_info.errors = "Failed to open script";
+		return;
+	}
+
+	GDScriptParser parser;
+	if (parser.parse(source, p_path, false) != OK) {
+		for (const GDScriptParser::ParserError &e : parser.get_errors()) {
+			r_info.errors += "Line " + itos(e.line) + ": " + e.message + "\n";
+		}
+		return;
+	}
+	r_info.valid = true;
+
+	const GDScriptParser::ClassNode *head = parser.get_tree();
+	if (head) {
+		if (head->identifier) {
+			r_info.class_name = head->identifier->name;
+			Symbol symbol;
+			symbol.name = head->identifier->name;
+			symbol.kind = SYMBOL_CLASS;
+			symbol.line = head->identifier->start_line;
+			r_info.symbols.push_back(symbol);
+		}
+		if (!head->extends_path.is_empty()) {
+			r_info.extends = head->extends_path;
+		}
+		for (const GDScriptParser::IdentifierNode *E : head->extends) {
+			r_info.extends += (r_info.extends.is_empty() ? "" : ".") + String(E->name);
+		}
+		_add_class_symbols(head, String(), r_info.symbols);
+	}
+
+	// References only need identifiers and lines, so the tokenizer is enough.
+	GDScriptTokenizerText tokenizer;
+	tokenizer.set_source_code(source);
+	for (GDScriptTokenizer::Token token = tokenizer.scan(); token.type != GDScriptTokenizer::Token::TK_EOF; token = tokenizer.scan()) {
+		if (token.type != GDScriptTokenizer::Token::IDENTIFIER) {
+			continue;
+		}
+		LocalVector<int> &lines = r_info.references[token.get_identifier()];
+		if (lines.is_empty() || lines[lines.size() - 1] != token.start_line) {
+			lines.push_back(token.start_line);
+		}
+	}
+#else
+	r_info.errors = "GDScript module disabled";
+#endif // MODULE_GDSCRIPT_ENABLED
+}
+
+void MCPCodeIndex::_collect_scripts(const String &p_dir, LocalVector<String> &r_paths) {
+	Ref<DirAccess> d = DirAccess::open(p_dir);
+	if (d.is_null()) {
+		return;
+	}
+	d->list_dir_begin();
+	for (String n = d->get_next(); !n.is_empty(); n = d->get_next()) {
+		if (n.begins_with(".")) {
+			continue;
+		}
+		const String full = p_dir.path_join(n);
+		if (d->current_is_dir()) {
+			_collect_scripts(full, r_paths);
+		} else if (n.ends_with(".gd")) {
+			r_paths.push_back(full);
+		}
+	}
+}
+
+void MCPCodeIndex::_unlink_script(const String &p_path, const ScriptInfo &p_info) {
+	for (const Symbol &symbol : p_info.symbols) {
+		HashMap<StringName, HashSet<String>>::Iterator E = definitions.find(symbol.name);
+		if (E) {
+			E->value.erase(p_path);
+			if (E->value.is_empty()) {
+				definitions.remove(E);
+			}
+		}
+	}
+	for (const KeyValue<StringName, LocalVector<int>> &R : p_info.references) {
+		HashMap<StringName, HashSet<String>>::Iterator E = references.find(R.key);
+		if (E) {
+			E->value.erase(p_path);
+			if (E->value.is_empty()) {
+				references.remove(E);
+			}
+		}
+	}
+}
+
+void MCPCodeIndex::_link_script(const String &p_path, const ScriptInfo &p_info) {
+	for (const Symbol &symbol : p_info.symbols) {
+		definitions[symbol.name].insert(p_path);
+	}
+	for (const KeyValue<StringName, LocalVector<int>> &R : p_info.references) {
+		references[R.key].insert(p_path);
+	}
+}
+
+void MCPCodeIndex::_update_script(const String &p_path, uint64_t p_modified_time) {
+	ScriptInfo info;
+	info.modified_time = p_modified_time;
+	info.indexed_time = (uint64_t)OS::get_singleton()->get_unix_time();
+	_parse_script(p_path, info);
+
+	MutexLock lock(mutex);
+	ScriptInfo *existing = scripts.getptr(p_path);
+	if (existing) {
+		_unlink_script(p_path, *existing);
+		*existing = info;
+	} else {
+		scripts.insert(p_path, info);
+	}
+	_link_script(p_path, info);
+}
+
+bool MCPCodeIndex::get_script(const String &p_path, ScriptInfo &r_info) {
+	if (!FileAccess::exists(p_path)) {
+		return false;
+	}
+	const uint64_t modified_time = FileAccess::get_modified_time(p_path);
+	{
+		MutexLock lock(mutex);
+		const ScriptInfo *info = scripts.getptr(p_path);
+		if (!_is_stale(info, modified_time)) {
+			r_info = *info;
+			return true;
+		}
+	}
+
+	_update_script(p_path, modified_time);
+
+	MutexLock lock(mutex);
+	const ScriptInfo *info = scripts.getptr(p_path);
+	ERR_FAIL_NULL_V(info, false);
+	r_info = *info;
+	return true;
+}
+
+void MCPCodeIndex::refresh(const String &p_dir, bool p_force, ProgressFunc p_progress, void *p_progress_userdata) {
+	const String dir = _as_dir(p_dir);
+	{
+		MutexLock lock(mutex);
+		const uint64_t *last = last_refresh.getptr(dir);
+		if (!p_force && last && OS::get_singleton()->get_ticks_msec() - *last < REFRESH_INTERVAL_MSEC) {
+			return;
+		}
+	}
+
+	LocalVector<String> paths;
+	_collect_scripts(dir, paths);
+
+	HashSet<String> seen;
+	int parsed = 0;
+	for (const String &path : paths) {
+		seen.insert(path);
+		const uint64_t modified_time = FileAccess::get_modified_time(path);
+		bool stale = true;
+		{
+			MutexLock lock(mutex);
+			stale = _is_stale(scripts.getptr(path), modified_time);
+		}
+		if (!stale) {
+			continue;
+		}
+		_update_script(path, modified_time);
+		parsed++;
+		if (p_progress && parsed % 64 == 0) {
+			p_progress(p_progress_userdata, parsed, vformat("Indexed %d scripts (%d found)", parsed, paths.size()));
+		}
+	}
+
+	MutexLock lock(mutex);
+	LocalVector<String> removed;
+	for (const KeyValue<String, ScriptInfo> &E : scripts) {
+		if (E.key.begins_with(dir) && !seen.has(E.key)) {
+			removed.push_back(E.key);
+		}
+	}
+	for (const String &path : removed) {
+		_unlink_script(path, scripts[path]);
+		scripts.erase(path);
+	}
+	last_refresh[dir] = OS::get_singleton()->get_ticks_msec();
+}
+
+Array MCPCodeIndex::find_symbol(const StringName &p_name, const String &p_dir) const {
+	const String dir = _as_dir(p_dir);
+	Array result;
+
+	MutexLock lock(mutex);
+	const HashSet<String> *paths = definitions.getptr(p_name);
+	if (!paths) {
+		return result;
+	}
+	for (const String &path : *paths) {
+		if (!path.begins_with(dir)) {
+			continue;
+		}
+		for (const Symbol &symbol : scripts[path].symbols) {
+			if (symbol.name != p_name) {
+				continue;
+			}
+			Dictionary d;
+			d["file"] = path;
+			d["line"] = symbol.line;
+			d["kind"] = get_kind_name(symbol.kind);
+			d["class"] = symbol.outer;
+			result.push_back(d);
+		}
+	}
+	return result;
+}
+
+Array MCPCodeIndex::find_references(const StringName &p_name, const String &p_dir, int p_max_results) const {
+	const String dir = _as_dir(p_dir);
+	Array result;
+
+	MutexLock lock(mutex);
+	const HashSet<String> *paths = references.getptr(p_name);
+	if (!paths) {
+		return result;
+	}
+	for (const String &path : *paths) {
+		if (!path.begins_with(dir)) {
+			continue;
+		}
+		for (int line : scripts[path].references[p_name]) {
+			if (result.size() >= p_max_results) {
+				return result;
+			}
+			Dictionary d;
+			d["file"] = path;
+			d["line"] = line;
+			result.push_back(d);
+		}
+	}
+	return result;
+}
+
+int MCPCodeIndex::get_script_count() const {
+	MutexLock lock(mutex);
+	return scripts.size();
+}
+
+void MCPCodeIndex::clear() {
+	MutexLock lock(mutex);
+	scripts.clear();
+	definitions.clear();
+	references.clear();
+	last_refresh.clear();
+}
+
+String MCPCodeIndex::get_kind_name(SymbolKind p_kind) {
+	switch (p_kind) {
+		case SYMBOL_CLASS:
+			return "class";
+		case SYMBOL_CONSTANT:
+			return "constant";
+		case SYMBOL_ENUM:
+			return "enum";
+		case SYMBOL_FUNCTION:
+			return "function";
+		case SYMBOL_SIGNAL:
+			return "signal";
+		case SYMBOL_VARIABLE:
+			return "variable";
+	}
+	return String();
+}
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  mcp_code_index.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file mcp_code_index.h
+ *
+ * @brief Persistent GDScript symbol index used by the `code_intel` tool.
+ */
+
+#include "core/os/mutex.h"
+#include "core/string/string_name.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/array.h"
+
+/// Keeps the declarations and identifier references of every script parsed so far. Scripts are parsed once
+/// and only parsed again when their modification time changes, so repeated queries are hash lookups.
+/// All methods are thread-safe; parsing happens outside of the lock.
+class MCPCodeIndex {
+public:
+	enum SymbolKind {
+		SYMBOL_CLASS,
+		SYMBOL_CONSTANT,
+		SYMBOL_ENUM,
+		SYMBOL_FUNCTION,
+		SYMBOL_SIGNAL,
+		SYMBOL_VARIABLE,
+	};
+
+	struct Symbol {
+		StringName name;
+		SymbolKind kind = SYMBOL_FUNCTION;
+		int line = 0;
+		String outer; ///< Inner class declaring the symbol, empty for members of the script itself.
+	};
+
+	struct ScriptInfo {
+		uint64_t modified_time = 0;
+		uint64_t indexed_time = 0; ///< Unix time the script was parsed at.
+		bool valid = false;
+		String errors; ///< Parse errors, one "Line N: message" per line.
+		String class_name;
+		String extends;
+		LocalVector<Symbol> symbols;
+		HashMap<StringName, LocalVector<int>> references; ///< Lines each identifier appears on, in order.
+	};
+
+	/// Rescans are skipped if the same directory was scanned this recently, unless forced.
+	static constexpr uint64_t REFRESH_INTERVAL_MSEC = 1000;
+
+private:
+	mutable Mutex mutex;
+	HashMap<String, ScriptInfo> scripts;
+	HashMap<StringName, HashSet<String>> definitions; ///< Symbol name -> scripts declaring it.
+	HashMap<StringName, HashSet<String>> references; ///< Identifier -> scripts using it.
+	HashMap<String, uint64_t> last_refresh; ///< Directory -> ticks of its last full scan.
+
+	static bool _is_stale(const ScriptInfo *p_info, uint64_t p_modified_time);
+	static void _parse_script(const String &p_path, ScriptInfo &r_info);
+	static void _collect_scripts(const String &p_dir, LocalVector<String> &r_paths);
+	void _unlink_script(const String &p_path, const ScriptInfo &p_info);
+	void _link_script(const String &p_path, const ScriptInfo &p_info);
+	void _update_script(const String &p_path, uint64_t p_modified_time);
+
+public:
+	typedef void (*ProgressFunc)(void *p_userdata, int64_t p_progress, const String &p_message);
+
+	/// Fills `r_info` with the up-to-date entry of a script, parsing it if needed. Returns `false` if it can't be read.
+	bool get_script(const String &p_path, ScriptInfo &r_info);
+
+	/// Brings every script below `p_dir` up to date and drops deleted ones.
+	void refresh(const String &p_dir, bool p_force = false, ProgressFunc p_progress = nullptr, void *p_progress_userdata = nullptr);
+
+	/// Declarations named `p_name` below `p_dir`, as `{ file, line, kind, class }` dictionaries.
+	Array find_symbol(const StringName &p_name, const String &p_dir) const;
+	/// Lines using the identifier `p_name` below `p_dir`, as `{ file, line }` dictionaries.
+	Array find_references(const StringName &p_name, const String &p_dir, int p_max_results) const;
+
+	int get_script_count() const;
+	void clear();
+
+	static String get_kind_name(SymbolKind p_kind);
+};
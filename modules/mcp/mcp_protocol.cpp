@@ -54,6 +54,7 @@ MCPProtocol::MCPProtocol() {
 }
 
 MCPProtocol::~MCPProtocol() {
+	_reap_tool_calls(true);
 	if (tools) {
 		memdelete(tools);
 		tools = nullptr;
@@ -62,6 +63,9 @@ MCPProtocol::~MCPProtocol() {
 
 void MCPProtocol::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_initialized"), &MCPProtocol::is_initialized);
+	ClassDB::bind_method(D_METHOD("set_concurrent_tools_enabled", "enabled"), &MCPProtocol::set_concurrent_tools_enabled);
+	ClassDB::bind_method(D_METHOD("is_concurrent_tools_enabled"), &MCPProtocol::is_concurrent_tools_enabled);
+	ClassDB::bind_method(D_METHOD("set_output_callback", "callback"), &MCPProtocol::set_output_callback);
 
 	ClassDB::bind_method(D_METHOD("_handle_initialize", "params"), &MCPProtocol::_handle_initialize, DEFVAL(Variant()));
 	ClassDB::bind_method(D_METHOD("_handle_initialized_notification", "params"), &MCPProtocol::_handle_initialized_notification, DEFVAL(Variant()));
@@ -158,8 +162,21 @@ Variant MCPProtocol::_handle_tools_call(const Variant &p_params) {
 		}
 	}
 
+	// Progress is only reported when the client asked for it and there is a way to send it out of band.
+	ProgressTarget progress_target;
+	MCPTools::Progress progress;
+	Variant meta = params.get("_meta", Variant());
+	if (meta.get_type() == Variant::DICTIONARY && output_callback.is_valid()) {
+		progress_target.token = Dictionary(meta).get("progressToken", Variant());
+		if (progress_target.token.get_type() != Variant::NIL) {
+			progress_target.protocol = this;
+			progress.callback = _report_progress;
+			progress.userdata = &progress_target;
+		}
+	}
+
 	// Execute the tool
-	MCPTools::ToolResult result = tools->execute_tool(tool_name, arguments);
+	MCPTools::ToolResult result = tools->execute_tool(tool_name, arguments, progress.callback ? &progress : nullptr);
 
 	return _make_tool_result(result.content, !result.success);
 }
@@ -187,6 +204,47 @@ Dictionary MCPProtocol::_make_tool_result_error(const String &p_message) const {
 	return result;
 }
 
+Variant MCPProtocol::_normalize_id(const Variant &p_id) {
+	// Same as JSONRPC::process_action(): use an int if the id was serialized as a float with a .0 fraction.
+	if (p_id.get_type() == Variant::FLOAT && p_id.operator float() == (float)(p_id.operator int())) {
+		return p_id.operator int();
+	}
+	return p_id;
+}
+
+void MCPProtocol::_write_message(const Variant &p_message) {
+	if (output_callback.is_valid()) {
+		output_callback.call(JSON::stringify(p_message));
+	}
+}
+
+void MCPProtocol::_report_progress(void *p_userdata, int64_t p_progress, const String &p_message) {
+	ProgressTarget *target = (ProgressTarget *)p_userdata;
+	Dictionary params;
+	params["progressToken"] = target->token;
+	params["progress"] = p_progress;
+	params["message"] = p_message;
+	target->protocol->_write_message(target->protocol->make_notification("notifications/progress", params));
+}
+
+void MCPProtocol::_tool_call_task(void *p_userdata) {
+	ToolCall *call = (ToolCall *)p_userdata;
+	Variant result = call->protocol->_handle_tools_call(call->params);
+	call->protocol->_write_message(call->protocol->make_response(result, call->id));
+	memdelete(call);
+}
+
+void MCPProtocol::_reap_tool_calls(bool p_wait_all) {
+	for (uint32_t i = 0; i < tool_call_tasks.size();) {
+		if (p_wait_all || WorkerThreadPool::get_singleton()->is_task_completed(tool_call_tasks[i])) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tool_call_tasks[i]);
+			tool_call_tasks.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+}
+
 Variant MCPProtocol::_handle_initialized_notification(const Variant &p_params) {
 	// Per spec, the operation phase begins after this notification.
 	initialized = true;
@@ -198,30 +256,57 @@ Variant MCPProtocol::_handle_ping(const Variant &p_params) {
 }
 
 String MCPProtocol::process_string(const String &p_input) {
+	if (p_input.is_empty()) {
+		return String();
+	}
+
+	// Parsed once here and dispatched directly, rather than parsing again in JSONRPC::process_string().
+	JSON json;
+	if (json.parse(p_input) != OK) {
+		return JSON::stringify(make_response_error(PARSE_ERROR, "Parse error"));
+	}
+	const Variant &data = json.get_data();
+
 	// Gate tools/* requests before initialization at the protocol level,
 	// returning a proper JSON-RPC error (not a double-wrapped result).
 	// Notifications (no id) are silently dropped so the tool never executes.
-	if (!initialized && !p_input.is_empty()) {
-		JSON json;
-		if (json.parse(p_input) == OK) {
-			Variant data = json.get_data();
-			if (data.get_type() == Variant::DICTIONARY) {
-				Dictionary req = data;
-				String method = req.get("method", "");
-				if (method == "tools/list" || method == "tools/call") {
-					if (req.has("id")) {
-						Variant id = req["id"];
-						if (id.get_type() == Variant::FLOAT && id.operator float() == (float)(id.operator int())) {
-							id = id.operator int();
-						}
-						Dictionary resp = make_response_error(INVALID_REQUEST, "Protocol not initialized", id);
-						return JSON::stringify(resp);
-					}
-					// Notification before init: drop silently (no response permitted).
-					return String();
-				}
+	if (!initialized && data.get_type() == Variant::DICTIONARY) {
+		Dictionary req = data;
+		String method = req.get("method", "");
+		if (method == "tools/list" || method == "tools/call") {
+			if (req.has("id")) {
+				Dictionary resp = make_response_error(INVALID_REQUEST, "Protocol not initialized", _normalize_id(req["id"]));
+				return JSON::stringify(resp);
 			}
+			// Notification before init: drop silently (no response permitted).
+			return String();
 		}
 	}
-	return JSONRPC::process_string(p_input);
+
+	_reap_tool_calls(false);
+
+	// Read-only tool calls are answered later from a worker thread, so a slow scan doesn't hold up
+	// pings or other calls queued behind it.
+	if (concurrent_tools && initialized && output_callback.is_valid() && data.get_type() == Variant::DICTIONARY) {
+		Dictionary req = data;
+		Variant params = req.get("params", Variant());
+		if (req.has("id") && String(req.get("method", "")) == "tools/call" && params.get_type() == Variant::DICTIONARY) {
+			Dictionary call_params = params;
+			Variant arguments = call_params.get("arguments", Variant());
+			if (MCPTools::is_tool_read_only(call_params.get("name", ""), arguments.get_type() == Variant::DICTIONARY ? Dictionary(arguments) : Dictionary())) {
+				ToolCall *call = memnew(ToolCall);
+				call->protocol = this;
+				call->id = _normalize_id(req["id"]);
+				call->params = params;
+				tool_call_tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(_tool_call_task, call, false, "MCP tool call"));
+				return String();
+			}
+		}
+	}
+
+	Variant ret = process_action(data, true);
+	if (ret.get_type() == Variant::NIL) {
+		return String();
+	}
+	return JSON::stringify(ret);
 }
@@ -41,6 +41,8 @@
 #include "mcp_types.h"
 
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 #include "modules/jsonrpc/jsonrpc.h"
 
@@ -53,6 +55,32 @@ private:
 	bool initialized = false;
 	MCPTools *tools = nullptr;
 
+	/// @name Concurrent tool calls
+	/// Read-only tool calls run on the WorkerThreadPool and write their response through `output_callback`
+	/// when done, so responses may arrive out of order (clients match them by JSON-RPC id).
+	/// @{
+	Callable output_callback;
+	bool concurrent_tools = false;
+
+	struct ToolCall {
+		MCPProtocol *protocol = nullptr;
+		Variant id;
+		Variant params;
+	};
+
+	struct ProgressTarget {
+		MCPProtocol *protocol = nullptr;
+		Variant token;
+	};
+
+	LocalVector<WorkerThreadPool::TaskID> tool_call_tasks; ///< Only touched from the thread calling process_string().
+
+	static void _tool_call_task(void *p_userdata);
+	static void _report_progress(void *p_userdata, int64_t p_progress, const String &p_message);
+	void _reap_tool_calls(bool p_wait_all);
+	void _write_message(const Variant &p_message);
+	/// @}
+
 	/// @name MCP method handlers
 	/// @{
 	Variant _handle_initialize(const Variant &p_params);
@@ -67,6 +95,7 @@ private:
 	Dictionary _make_server_info() const;
 	Array _get_tool_definitions() const;
 	static String _negotiate_version(const String &p_client_version);
+	static Variant _normalize_id(const Variant &p_id);
 	/// @}
 
 	/// Make MCP-formatted tool result
@@ -82,6 +111,13 @@ public:
 
 	bool is_initialized() const { return initialized; }
 
+	/// Called with every message written outside of `process_string()`'s return value: out of order responses
+	/// and progress notifications. May be called from worker threads.
+	void set_output_callback(const Callable &p_callback) { output_callback = p_callback; }
+
+	void set_concurrent_tools_enabled(bool p_enabled) { concurrent_tools = p_enabled; }
+	bool is_concurrent_tools_enabled() const { return concurrent_tools; }
+
 	/// Override to gate pre-initialization requests (avoids double-wrapped errors).
 	/// Shadows JSONRPC::process_string; called via MCPProtocol* static dispatch.
 	String process_string(const String &p_input);
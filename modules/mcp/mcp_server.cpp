@@ -64,6 +64,8 @@ MCPServer *MCPServer::singleton = nullptr;
 MCPServer::MCPServer() {
 	singleton = this;
 	protocol = memnew(MCPProtocol);
+	protocol->set_output_callback(callable_mp(this, &MCPServer::_send_line));
+	protocol->set_concurrent_tools_enabled(true);
 #ifndef WINDOWS_ENABLED
 	if (pipe(wake_fds) != 0) {
 		wake_fds[0] = -1;
@@ -110,10 +112,83 @@ void MCPServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_running"), &MCPServer::is_running);
 }
 
+uint8_t *MCPLineReader::prepare_write(uint32_t p_size) {
+	// Drop consumed bytes before growing the buffer, keeping the partial line at the front.
+	if (read_pos > 0) {
+		uint32_t remaining = buffer.size() - read_pos;
+		if (remaining > 0) {
+			memmove(buffer.ptr(), buffer.ptr() + read_pos, remaining);
+		}
+		buffer.resize(remaining);
+		scan_pos -= read_pos;
+		read_pos = 0;
+	}
+	uint32_t old_size = buffer.size();
+	buffer.resize(old_size + p_size);
+	write_reserved = p_size;
+	return buffer.ptr() + old_size;
+}
+
+void MCPLineReader::commit_write(uint32_t p_written) {
+	// Only the bytes actually read are kept from the room reserved by prepare_write().
+	buffer.resize(buffer.size() - write_reserved + MIN(p_written, write_reserved));
+	write_reserved = 0;
+}
+
+void MCPLineReader::append(const uint8_t *p_data, uint32_t p_size) {
+	memcpy(prepare_write(p_size), p_data, p_size);
+	commit_write(p_size);
+}
+
+bool MCPLineReader::take_line(String &r_line) {
+	const uint8_t *data = buffer.ptr();
+	for (uint32_t i = scan_pos; i < buffer.size(); i++) {
+		if (data[i] != '\n') {
+			continue;
+		}
+		uint32_t start = read_pos;
+		read_pos = i + 1;
+		scan_pos = read_pos;
+		if (discarding) {
+			// End of a line that was already reported as dropped.
+			discarding = false;
+			continue;
+		}
+		uint32_t end = i;
+		if (end > start && data[end - 1] == '\r') {
+			end--;
+		}
+		if (end - start > max_line_size) {
+			dropped_lines++;
+			continue;
+		}
+		r_line = String::utf8((const char *)data + start, end - start);
+		return true;
+	}
+	scan_pos = buffer.size();
+
+	// A partial line can't be allowed to grow without bound, its bytes are released and the rest is skipped.
+	if (!discarding && buffer.size() - read_pos > max_line_size) {
+		discarding = true;
+		dropped_lines++;
+	}
+	if (discarding) {
+		read_pos = buffer.size();
+	}
+	return false;
+}
+
+uint32_t MCPLineReader::take_dropped_lines() {
+	uint32_t dropped = dropped_lines;
+	dropped_lines = 0;
+	return dropped;
+}
+
 String MCPServer::_read_line() {
 #ifdef WINDOWS_ENABLED
 	// On Windows, raw non-blocking reading from stdin is complex.
 	// Fallback to simpler blocking read for now to ensure compatibility.
+	_flush_output();
 	std::string line;
 	if (std::getline(std::cin, line)) {
 		return String::utf8(line.c_str());
@@ -123,13 +198,27 @@ String MCPServer::_read_line() {
 #else
 	while (!should_stop) {
 		// 1. Check if we already have a complete line in the buffer
-		int newline_pos = stdin_buffer.find("\n");
-		if (newline_pos != -1) {
-			String line = stdin_buffer.substr(0, newline_pos);
-			stdin_buffer = stdin_buffer.substr(newline_pos + 1);
+		String line;
+		bool has_line = stdin_reader.take_line(line);
+		for (uint32_t dropped = stdin_reader.take_dropped_lines(); dropped > 0; dropped--) {
+			// The request ID is unknown, so the client gets the JSON-RPC error reserved for unparsable input.
+			fprintf(stderr, "[MCP] Dropped a message larger than %u bytes\n", MCPLineReader::DEFAULT_MAX_LINE_SIZE);
+			Dictionary error;
+			error["code"] = -32700;
+			error["message"] = "Message too large";
+			Dictionary response;
+			response["jsonrpc"] = "2.0";
+			response["id"] = Variant();
+			response["error"] = error;
+			_write_line(JSON::stringify(response));
+		}
+		if (has_line) {
 			return line.strip_edges();
 		}
 
+		// Everything queued so far goes out before blocking, so replies are never held back by idle input.
+		_flush_output();
+
 		// 2. No line? Wait for data using poll
 		struct pollfd p_fds[2];
 		p_fds[0].fd = STDIN_FILENO;
@@ -155,21 +244,20 @@ String MCPServer::_read_line() {
 				return String();
 			}
 
-			if (p_fds[0].revents & POLLIN) {
-				// Raw read from stdin
-				char buf[4096];
-				ssize_t bytes = read(STDIN_FILENO, buf, sizeof(buf));
-				if (bytes > 0) {
-					stdin_buffer += String::utf8(buf, bytes);
-					// Continue to loop to extract the line from buffer
-				} else if (bytes == 0) {
+			if (p_fds[0].revents & (POLLIN | POLLHUP)) {
+				// Raw read from stdin, straight into the buffer.
+				uint8_t *dst = stdin_reader.prepare_write(STDIN_READ_SIZE);
+				ssize_t bytes = read(STDIN_FILENO, dst, STDIN_READ_SIZE);
+				stdin_reader.commit_write(MAX(bytes, (ssize_t)0));
+				if (bytes == 0) {
 					// EOF
 					should_stop = true;
 					return String();
-				} else if (errno != EAGAIN && errno != EINTR) {
+				} else if (bytes < 0 && errno != EAGAIN && errno != EINTR) {
 					should_stop = true;
 					return String();
 				}
+				// Continue to loop to extract the line from buffer
 			}
 		}
 	}
@@ -179,18 +267,77 @@ String MCPServer::_read_line() {
 
 void MCPServer::_write_line(const String &p_line) {
 	CharString utf8 = p_line.utf8();
-	fprintf(stdout, "%s\n", utf8.get_data());
+	MutexLock lock(output_mutex);
+	uint32_t old_size = output_buffer.size();
+	output_buffer.resize(old_size + utf8.length() + 1);
+	memcpy(output_buffer.ptr() + old_size, utf8.get_data(), utf8.length());
+	output_buffer[old_size + utf8.length()] = '\n';
+	if (output_buffer.size() >= OUTPUT_FLUSH_SIZE) {
+		_flush_output_locked();
+	}
+}
+
+void MCPServer::_send_line(const String &p_line) {
+	// Written from tool worker threads, so the line goes out right away instead of waiting for the reader.
+	_write_line(p_line);
+	_flush_output();
+}
+
+void MCPServer::_flush_output() {
+	MutexLock lock(output_mutex);
+	_flush_output_locked();
+}
+
+// EAGAIN and EWOULDBLOCK have the same value on most platforms, but it's not guaranteed.
+GODOT_GCC_WARNING_PUSH_AND_IGNORE("-Wlogical-op")
+
+void MCPServer::_flush_output_locked() {
+	if (output_buffer.is_empty()) {
+		return;
+	}
+#ifndef WINDOWS_ENABLED
+	const uint8_t *data = output_buffer.ptr();
+	size_t left = output_buffer.size();
+	while (left > 0) {
+		ssize_t written = write(STDOUT_FILENO, data, left);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				// The client isn't reading yet, block until the pipe drains instead of spinning on write().
+				struct pollfd out_fd;
+				out_fd.fd = STDOUT_FILENO;
+				out_fd.events = POLLOUT;
+				if (poll(&out_fd, 1, 1000) >= 0 || errno == EINTR) {
+					continue;
+				}
+			}
+			break;
+		}
+		data += written;
+		left -= written;
+	}
+#else
+	fwrite(output_buffer.ptr(), 1, output_buffer.size(), stdout);
 	fflush(stdout);
+#endif
+	output_buffer.clear();
 }
 
+GODOT_GCC_WARNING_POP
+
 void MCPServer::_bridge_thread_func(void *p_userdata) {
 	MCPServer *ms = (MCPServer *)p_userdata;
 	while (!ms->should_stop) {
 		if (MCPBridge::get_singleton()) {
+			// Wakes up as soon as the game connects or answers, instead of sleeping a fixed interval.
+			MCPBridge::get_singleton()->wait_for_activity(100);
 			MCPBridge::get_singleton()->update();
+		} else {
+			OS::get_singleton()->delay_usec(10000); // 10ms
 		}
 		ms->_check_game_process();
-		OS::get_singleton()->delay_usec(10000); // 10ms
 	}
 }
 
@@ -284,6 +431,7 @@ void MCPServer::_server_loop() {
 		}
 	}
 
+	_flush_output();
 	should_stop = true;
 	bridge_thread.wait_to_finish();
 	fprintf(stderr, "[MCP] Redot MCP Server stopped\n");
@@ -45,9 +45,39 @@
 #include "core/os/os.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 
 #include <atomic>
 
+/// Splits raw stdin bytes into newline-delimited messages.
+/// Only bytes that arrived since the last call are scanned, and only complete lines are decoded.
+class MCPLineReader {
+	LocalVector<uint8_t> buffer; ///< Raw stdin bytes, consumed lines are dropped lazily.
+	uint32_t read_pos = 0; ///< Start of the first unconsumed line.
+	uint32_t scan_pos = 0; ///< Bytes before this were already searched for a newline.
+	uint32_t max_line_size = 0;
+	bool discarding = false; ///< Skipping the rest of an oversized line up to its newline.
+	uint32_t dropped_lines = 0;
+	uint32_t write_reserved = 0;
+
+public:
+	static constexpr uint32_t DEFAULT_MAX_LINE_SIZE = 64 * 1024 * 1024;
+
+	/// Returns room for `p_size` more bytes at the end of the buffer, to be followed by `commit_write()`.
+	uint8_t *prepare_write(uint32_t p_size);
+	void commit_write(uint32_t p_written);
+	void append(const uint8_t *p_data, uint32_t p_size);
+
+	/// Extracts the next complete line without its `\n` or `\r\n` terminator.
+	/// Lines longer than the maximum size are skipped and counted by `take_dropped_lines()`.
+	bool take_line(String &r_line);
+	uint32_t take_dropped_lines();
+	uint32_t get_buffered_size() const { return buffer.size() - read_pos; }
+
+	MCPLineReader(uint32_t p_max_line_size = DEFAULT_MAX_LINE_SIZE) :
+			max_line_size(p_max_line_size) {}
+};
+
 class MCPServer : public Object {
 	GDCLASS(MCPServer, Object)
 
@@ -67,8 +97,11 @@ private:
 	/// Read a line from stdin
 	String _read_line();
 
-	/// Write a line to stdout
+	/// Queue a line for stdout, written in batches by `_flush_output()`
 	void _write_line(const String &p_line);
+	void _send_line(const String &p_line);
+	void _flush_output();
+	void _flush_output_locked();
 
 protected:
 	static void _bind_methods();
@@ -106,5 +139,12 @@ private:
 	mutable Mutex process_mutex; ///< Protects game_pid and game_log_path
 	void _check_game_process(); ///< Reaper logic
 	int wake_fds[2];
-	String stdin_buffer;
+
+	static constexpr uint32_t STDIN_READ_SIZE = 64 * 1024;
+	static constexpr uint32_t OUTPUT_FLUSH_SIZE = 256 * 1024;
+
+	MCPLineReader stdin_reader;
+
+	Mutex output_mutex;
+	LocalVector<uint8_t> output_buffer;
 };
@@ -55,10 +55,6 @@
 
 #include "modules/modules_enabled.gen.h"
 
-#ifdef MODULE_GDSCRIPT_ENABLED
-#include "modules/gdscript/gdscript_parser.h"
-#endif
-
 #include "core/doc_data.h"
 #include <functional>
 
@@ -241,9 +237,10 @@ Array MCPTools::get_tool_definitions() {
 	// code_intel
 	{
 		Dictionary props;
-		props["action"] = MCPSchemaBuilder::make_string_property("Action: 'get_symbols', 'search', 'validate', 'get_docs'");
-		props["path"] = MCPSchemaBuilder::make_string_property("Path to script (.gd)");
-		props["query"] = MCPSchemaBuilder::make_string_property("Class name or search query");
+		props["action"] = MCPSchemaBuilder::make_string_property("Action: 'get_symbols', 'search', 'validate', 'get_docs', 'find_symbol', 'find_references'");
+		props["path"] = MCPSchemaBuilder::make_string_property("Path to script (.gd), or directory for 'search', 'find_symbol' and 'find_references' (default res://)");
+		props["query"] = MCPSchemaBuilder::make_string_property("Class name, search query, or symbol name for 'find_symbol' and 'find_references'");
+		props["refresh"] = MCPSchemaBuilder::make_boolean_property("Rescan the directory before 'find_symbol' or 'find_references' even if it was indexed less than a second ago");
 
 		Array required;
 		required.push_back("action");
@@ -308,7 +305,27 @@ Array MCPTools::get_tool_definitions() {
 // Tool Execution
 // ============================================================================
 
-MCPTools::ToolResult MCPTools::execute_tool(const String &p_name, const Dictionary &p_arguments) {
+bool MCPTools::is_tool_read_only(const String &p_name, const Dictionary &p_arguments) {
+	const String action = p_arguments.get("action", "");
+	if (p_name == "code_intel") {
+		// validate, get_symbols, find_symbol and find_references run GDScriptParser, which resolves
+		// against global script state that mutating tools change, so they stay on the main thread.
+		return action == "get_docs" || action == "search";
+	}
+	if (p_name == "resource_action") {
+		return action == "inspect" || action == "inspect_asset";
+	}
+	if (p_name == "project_config") {
+		return action == "get_info" || action == "output" || action == "read_file_res" || action == "list_files";
+	}
+	if (p_name == "game_control") {
+		// Bridge commands are multiplexed, so these don't hold up other calls while the game answers.
+		return action == "capture" || action == "inspect_live";
+	}
+	return false;
+}
+
+MCPTools::ToolResult MCPTools::execute_tool(const String &p_name, const Dictionary &p_arguments, const Progress *p_progress) {
 	if (p_name == "scene_action") {
 		return tool_scene_action(p_arguments);
 	}
@@ -316,7 +333,7 @@ MCPTools::ToolResult MCPTools::execute_tool(const String &p_name, const Dictiona
 		return tool_resource_action(p_arguments);
 	}
 	if (p_name == "code_intel") {
-		return tool_code_intel(p_arguments);
+		return tool_code_intel(p_arguments, p_progress);
 	}
 	if (p_name == "project_config") {
 		return tool_project_config(p_arguments);
@@ -650,7 +667,7 @@ MCPTools::ToolResult MCPTools::tool_resource_action(const Dictionary &p_args) {
 	return result;
 }
 
-MCPTools::ToolResult MCPTools::tool_code_intel(const Dictionary &p_args) {
+MCPTools::ToolResult MCPTools::tool_code_intel(const Dictionary &p_args, const Progress *p_progress) {
 	ToolResult result;
 	String action = p_args.get("action", "");
 	if (action == "get_docs") {
@@ -714,6 +731,7 @@ MCPTools::ToolResult MCPTools::tool_code_intel(const Dictionary &p_args) {
 		Array matches;
 		int match_count = 0;
 		const int max_matches = 100;
+		int scanned_files = 0;
 		std::function<void(const String &)> scan_dir = [&](const String &p_dir) {
 			if (match_count >= max_matches) {
 				return;
@@ -733,6 +751,10 @@ MCPTools::ToolResult MCPTools::tool_code_intel(const Dictionary &p_args) {
 				if (d->current_is_dir()) {
 					scan_dir(full);
 				} else if (n.ends_with(".gd")) {
+					scanned_files++;
+					if (p_progress && scanned_files % 64 == 0) {
+						p_progress->report(scanned_files, vformat("Scanned %d scripts, %d matches", scanned_files, match_count));
+					}
 					Error ferr;
 					Ref<FileAccess> f = FileAccess::open(full, FileAccess::READ, &ferr);
 					if (f.is_valid()) {
@@ -764,6 +786,29 @@ MCPTools::ToolResult MCPTools::tool_code_intel(const Dictionary &p_args) {
 		}
 		return result;
 	}
+	if (action == "find_symbol" || action == "find_references") {
+		String query = p_args.get("query", "");
+		if (query.is_empty()) {
+			result.set_error("Missing query");
+			return result;
+		}
+		String search_dir = p_args.get("path", "res://");
+		if (!validate_path(search_dir)) {
+			result.set_error("Invalid path: " + search_dir);
+			return result;
+		}
+		search_dir = normalize_path(search_dir);
+
+		// Only scripts changed since the last scan are parsed, lookups themselves are hash map queries.
+		code_index.refresh(search_dir, p_args.get("refresh", false), p_progress ? p_progress->callback : nullptr, p_progress ? p_progress->userdata : nullptr);
+		const int max_matches = 100;
+		Array matches = action == "find_symbol" ? code_index.find_symbol(query, search_dir) : code_index.find_references(query, search_dir, max_matches);
+		result.add_text(JSON::stringify(matches, "  "));
+		if (matches.size() >= max_matches && action == "find_references") {
+			result.add_text("\n(Results truncated at " + itos(max_matches) + " matches)");
+		}
+		return result;
+	}
 	String path = p_args.get("path", "");
 	if (path.is_empty()) {
 		result.set_error("Missing path");
@@ -776,45 +821,52 @@ MCPTools::ToolResult MCPTools::tool_code_intel(const Dictionary &p_args) {
 	String normalized = normalize_path(path);
 #ifdef MODULE_GDSCRIPT_ENABLED
 	if (action == "validate" || action == "get_symbols") {
-		Error err;
-		Ref<FileAccess> f = FileAccess::open(normalized, FileAccess::READ, &err);
-		if (err != OK) {
+		// Served from the index, the script is only parsed again if it changed since the last query.
+		MCPCodeIndex::ScriptInfo info;
+		if (!code_index.get_script(normalized, info)) {
 			result.set_error("Failed to open script");
 			return result;
 		}
-		String source = f->get_as_text();
-		GDScriptParser parser;
-		Error parse_err = parser.parse(source, normalized, false);
-		if (parse_err != OK) {
-			String el = "Validation failed:\n";
-			for (const GDScriptParser::ParserError &e : parser.get_errors()) {
-				el += "Line " + itos(e.line) + ": " + e.message + "\n";
-			}
-			result.set_error(el);
+		if (!info.valid) {
+			result.set_error("Validation failed:\n" + info.errors);
+		} else if (action == "validate") {
+			result.add_text("Valid");
 		} else {
-			if (action == "validate") {
-				result.add_text("Valid");
-			} else {
-				Dictionary symbols;
-				const GDScriptParser::ClassNode *head = parser.get_tree();
-				if (head) {
-					Array functions, variables, signals;
-					for (int i = 0; i < head->members.size(); i++) {
-						const GDScriptParser::ClassNode::Member &m = head->members[i];
-						if (m.type == GDScriptParser::ClassNode::Member::FUNCTION) {
-							functions.push_back(m.get_name());
-						} else if (m.type == GDScriptParser::ClassNode::Member::VARIABLE) {
-							variables.push_back(m.get_name());
-						} else if (m.type == GDScriptParser::ClassNode::Member::SIGNAL) {
-							signals.push_back(m.get_name());
+			Dictionary symbols;
+			Array functions, variables, signals, constants, classes;
+			for (const MCPCodeIndex::Symbol &symbol : info.symbols) {
+				if (!symbol.outer.is_empty()) {
+					continue;
+				}
+				switch (symbol.kind) {
+					case MCPCodeIndex::SYMBOL_FUNCTION:
+						functions.push_back(symbol.name);
+						break;
+					case MCPCodeIndex::SYMBOL_VARIABLE:
+						variables.push_back(symbol.name);
+						break;
+					case MCPCodeIndex::SYMBOL_SIGNAL:
+						signals.push_back(symbol.name);
+						break;
+					case MCPCodeIndex::SYMBOL_CONSTANT:
+					case MCPCodeIndex::SYMBOL_ENUM:
+						constants.push_back(symbol.name);
+						break;
+					case MCPCodeIndex::SYMBOL_CLASS:
+						if (symbol.name != StringName(info.class_name)) {
+							classes.push_back(symbol.name);
 						}
-					}
-					symbols["functions"] = functions;
-					symbols["variables"] = variables;
-					symbols["signals"] = signals;
+						break;
 				}
-				result.add_text(JSON::stringify(symbols, "  "));
 			}
+			symbols["class_name"] = info.class_name;
+			symbols["extends"] = info.extends;
+			symbols["functions"] = functions;
+			symbols["variables"] = variables;
+			symbols["signals"] = signals;
+			symbols["constants"] = constants;
+			symbols["classes"] = classes;
+			result.add_text(JSON::stringify(symbols, "  "));
 		}
 		return result;
 	}
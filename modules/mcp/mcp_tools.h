@@ -38,6 +38,7 @@
  * [Add any documentation that applies to the entire file here!]
  */
 
+#include "mcp_code_index.h"
 #include "mcp_types.h"
 
 #include "core/object/class_db.h"
@@ -71,7 +72,21 @@ public:
 		}
 	};
 
+	/// Receives progress updates from long running tools, on the thread running the tool.
+	struct Progress {
+		void (*callback)(void *p_userdata, int64_t p_progress, const String &p_message) = nullptr;
+		void *userdata = nullptr;
+
+		void report(int64_t p_progress, const String &p_message) const {
+			if (callback) {
+				callback(userdata, p_progress, p_message);
+			}
+		}
+	};
+
 private:
+	MCPCodeIndex code_index;
+
 	/// @name Path Utilities
 	/// @{
 	static String normalize_path(const String &p_path);
@@ -88,14 +103,18 @@ public:
 	/// Get all tool definitions
 	static Array get_tool_definitions();
 
+	/// Returns `true` if the call only reads project or game state, so it can run alongside other calls.
+	/// Calls that parse scripts are not, they are serialized with the calls that modify the project.
+	static bool is_tool_read_only(const String &p_name, const Dictionary &p_arguments);
+
 	/// Execute a tool by name
-	ToolResult execute_tool(const String &p_name, const Dictionary &p_arguments);
+	ToolResult execute_tool(const String &p_name, const Dictionary &p_arguments, const Progress *p_progress = nullptr);
 
 	/// @name
 	/// @{=== Master Controllers ===
 	ToolResult tool_scene_action(const Dictionary &p_args);
 	ToolResult tool_resource_action(const Dictionary &p_args);
-	ToolResult tool_code_intel(const Dictionary &p_args);
+	ToolResult tool_code_intel(const Dictionary &p_args, const Progress *p_progress = nullptr);
 	ToolResult tool_project_config(const Dictionary &p_args);
 	ToolResult tool_game_control(const Dictionary &p_args);
 	/// @}
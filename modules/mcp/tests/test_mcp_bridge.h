@@ -0,0 +1,324 @@
+/**************************************************************************/
+/*  test_mcp_bridge.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file test_mcp_bridge.h
+ *
+ * @brief Framing, request routing and loopback throughput of the MCP bridge transport.
+ *
+ * The unit tests run a host bridge against a raw TCP peer that writes frames by
+ * hand, so responses can be reordered, malformed or cut off at will. The host is
+ * pumped by its own thread like the MCP server's bridge thread.
+ *
+ * The loopback benchmark is skipped by default, run it with
+ * `--test --no-skip --tc="*[MCP][Benchmark]*"`.
+ */
+
+#include "../mcp_bridge.h"
+
+#include "core/io/json.h"
+#include "core/io/marshalls.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/sort_array.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMCPBridge {
+
+struct BridgePump {
+	MCPBridge *bridge = nullptr;
+	SafeFlag stop;
+
+	static void pump(void *p_userdata) {
+		BridgePump *self = (BridgePump *)p_userdata;
+		while (!self->stop.is_set()) {
+			self->bridge->wait_for_activity(10);
+			self->bridge->update();
+		}
+	}
+};
+
+static constexpr uint64_t WAIT_MSEC = 2000;
+
+// A listening host bridge pumped from a thread, with a raw TCP peer standing in for the game.
+struct HostWithPeer {
+	MCPBridge *host = nullptr;
+	BridgePump pump;
+	Thread thread;
+	Ref<StreamPeerTCP> peer;
+
+	bool start() {
+		host = memnew(MCPBridge);
+		if (host->start_server() != OK) {
+			return false;
+		}
+		pump.bridge = host;
+		thread.start(BridgePump::pump, &pump);
+
+		peer.instantiate();
+		if (peer->connect_to_host(IPAddress("127.0.0.1"), host->get_port()) != OK) {
+			return false;
+		}
+		const uint64_t start = OS::get_singleton()->get_ticks_msec();
+		while (OS::get_singleton()->get_ticks_msec() - start < WAIT_MSEC) {
+			peer->poll();
+			if (peer->get_status() == StreamPeerTCP::STATUS_CONNECTED && host->is_client_connected()) {
+				return true;
+			}
+			OS::get_singleton()->delay_usec(1000);
+		}
+		return false;
+	}
+
+	bool wait_for_bytes(int p_bytes) {
+		const uint64_t start = OS::get_singleton()->get_ticks_msec();
+		while (OS::get_singleton()->get_ticks_msec() - start < WAIT_MSEC) {
+			peer->poll();
+			if (peer->get_available_bytes() >= p_bytes) {
+				return true;
+			}
+			OS::get_singleton()->delay_usec(1000);
+		}
+		return false;
+	}
+
+	bool read_frame(uint32_t &r_id, Dictionary &r_command) {
+		uint8_t header[8];
+		if (!wait_for_bytes(8) || peer->get_data(header, 8) != OK) {
+			return false;
+		}
+		const uint32_t size = decode_uint32(header);
+		r_id = decode_uint32(header + 4);
+		LocalVector<uint8_t> payload;
+		payload.resize(size);
+		if (size > 0 && (!wait_for_bytes(size) || peer->get_data(payload.ptr(), size) != OK)) {
+			return false;
+		}
+		r_command = JSON::parse_string(String::utf8((const char *)payload.ptr(), size));
+		return true;
+	}
+
+	void write_header(uint32_t p_size, uint32_t p_id) {
+		uint8_t header[8];
+		encode_uint32(p_size, header);
+		encode_uint32(p_id, header + 4);
+		peer->put_data(header, 8);
+	}
+
+	void write_frame(uint32_t p_id, const Dictionary &p_response) {
+		CharString utf8 = JSON::stringify(p_response).utf8();
+		write_header(utf8.length(), p_id);
+		peer->put_data((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+
+	~HostWithPeer() {
+		if (peer.is_valid()) {
+			peer->disconnect_from_host();
+		}
+		pump.stop.set();
+		if (thread.is_started()) {
+			thread.wait_to_finish();
+		}
+		if (host) {
+			memdelete(host);
+		}
+	}
+};
+
+TEST_CASE("[Modules][MCP] Bridge routes responses by request ID") {
+	HostWithPeer bridge;
+	REQUIRE(bridge.start());
+
+	Dictionary args;
+	args["index"] = 1;
+	const uint32_t first = bridge.host->queue_command("echo", args);
+	args["index"] = 2;
+	const uint32_t second = bridge.host->queue_command("echo", args);
+	REQUIRE(first != 0);
+	REQUIRE(second != 0);
+	CHECK(first != second);
+
+	uint32_t ids[2] = {};
+	Dictionary commands[2];
+	REQUIRE(bridge.read_frame(ids[0], commands[0]));
+	REQUIRE(bridge.read_frame(ids[1], commands[1]));
+	CHECK(ids[0] == first);
+	CHECK(ids[1] == second);
+	CHECK(String(commands[0].get("action", "")) == "echo");
+
+	// Answered in reverse order, each response must still reach the command with its ID.
+	for (int i = 1; i >= 0; i--) {
+		Dictionary response;
+		response["index"] = Dictionary(commands[i].get("args", Dictionary())).get("index", 0);
+		bridge.write_frame(ids[i], response);
+	}
+
+	Dictionary second_response = bridge.host->wait_for_response(second, WAIT_MSEC);
+	Dictionary first_response = bridge.host->wait_for_response(first, WAIT_MSEC);
+	CHECK(int(first_response.get("index", 0)) == 1);
+	CHECK(int(second_response.get("index", 0)) == 2);
+
+	// Responses to unknown or already answered IDs are ignored.
+	Dictionary stray;
+	stray["index"] = 3;
+	bridge.write_frame(first, stray);
+	const uint32_t third = bridge.host->queue_command("echo");
+	uint32_t third_id = 0;
+	Dictionary third_command;
+	REQUIRE(bridge.read_frame(third_id, third_command));
+	CHECK(third_id == third);
+	Dictionary answer;
+	answer["index"] = 4;
+	bridge.write_frame(third_id, answer);
+	CHECK(int(bridge.host->wait_for_response(third, WAIT_MSEC).get("index", 0)) == 4);
+}
+
+TEST_CASE("[Modules][MCP] Bridge fails pending commands when the game disconnects") {
+	HostWithPeer bridge;
+	REQUIRE(bridge.start());
+
+	const uint32_t first = bridge.host->queue_command("echo");
+	const uint32_t second = bridge.host->queue_command("echo");
+	REQUIRE(first != 0);
+	REQUIRE(second != 0);
+	bridge.peer->disconnect_from_host();
+
+	// Both waiters are released well before the timeout would expire.
+	const uint64_t start = OS::get_singleton()->get_ticks_msec();
+	Dictionary first_response = bridge.host->wait_for_response(first, 10 * WAIT_MSEC);
+	Dictionary second_response = bridge.host->wait_for_response(second, 10 * WAIT_MSEC);
+	CHECK(OS::get_singleton()->get_ticks_msec() - start < 5 * WAIT_MSEC);
+	CHECK(String(first_response.get("error", "")) == "Bridge disconnected");
+	CHECK(String(second_response.get("error", "")) == "Bridge disconnected");
+
+	CHECK(bridge.host->queue_command("echo") == 0);
+	CHECK(String(bridge.host->wait_for_response(0).get("error", "")) == "Bridge not connected");
+}
+
+TEST_CASE("[Modules][MCP] Bridge drops the connection on oversized frames") {
+	HostWithPeer bridge;
+	REQUIRE(bridge.start());
+
+	const uint32_t id = bridge.host->queue_command("echo");
+	REQUIRE(id != 0);
+	uint32_t received_id = 0;
+	Dictionary command;
+	REQUIRE(bridge.read_frame(received_id, command));
+
+	// Only the header is sent: the size alone must be rejected, without waiting for (or allocating) the payload.
+	bridge.write_header(UINT32_MAX, received_id);
+	Dictionary response = bridge.host->wait_for_response(id, WAIT_MSEC);
+	CHECK(String(response.get("error", "")) == "Bridge protocol error");
+
+	const uint64_t start = OS::get_singleton()->get_ticks_msec();
+	while (bridge.host->is_client_connected() && OS::get_singleton()->get_ticks_msec() - start < WAIT_MSEC) {
+		OS::get_singleton()->delay_usec(1000);
+	}
+	CHECK_FALSE(bridge.host->is_client_connected());
+}
+
+// Skipped by default, run with `--test --no-skip --tc="*[MCP][Benchmark]*"`.
+TEST_CASE("[Modules][MCP][Benchmark] Bridge loopback" * doctest::skip()) {
+	MCPBridge *host = memnew(MCPBridge);
+	MCPBridge *game = memnew(MCPBridge);
+	REQUIRE(host->start_server() == OK);
+	REQUIRE(game->connect_to_server("127.0.0.1", host->get_port()) == OK);
+
+	BridgePump host_pump;
+	host_pump.bridge = host;
+	BridgePump game_pump;
+	game_pump.bridge = game;
+	Thread host_thread;
+	host_thread.start(BridgePump::pump, &host_pump);
+	Thread game_thread;
+	game_thread.start(BridgePump::pump, &game_pump);
+
+	const uint64_t connect_start = OS::get_singleton()->get_ticks_msec();
+	while (!host->is_client_connected() && OS::get_singleton()->get_ticks_msec() - connect_start < 2000) {
+		OS::get_singleton()->delay_usec(1000);
+	}
+	REQUIRE(host->is_client_connected());
+
+	Dictionary pong = host->send_command("ping");
+	CHECK(String(pong.get("status", "")) == "pong");
+
+	const uint32_t commands = 2000;
+	const uint32_t window = 32;
+	LocalVector<uint64_t> latencies;
+	latencies.reserve(commands);
+	LocalVector<uint32_t> in_flight_ids;
+	LocalVector<uint64_t> in_flight_start;
+	uint32_t sent = 0;
+	uint32_t failed = 0;
+
+	const uint64_t start = OS::get_singleton()->get_ticks_usec();
+	while (latencies.size() + failed < commands) {
+		while (sent < commands && in_flight_ids.size() < window) {
+			in_flight_ids.push_back(host->queue_command("ping"));
+			in_flight_start.push_back(OS::get_singleton()->get_ticks_usec());
+			sent++;
+		}
+		// Responses may complete in any order, waiting on the oldest keeps the window full.
+		Dictionary response = host->wait_for_response(in_flight_ids[0]);
+		if (String(response.get("status", "")) == "pong") {
+			latencies.push_back(OS::get_singleton()->get_ticks_usec() - in_flight_start[0]);
+		} else {
+			failed++;
+		}
+		in_flight_ids.remove_at(0);
+		in_flight_start.remove_at(0);
+	}
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+
+	host_pump.stop.set();
+	game_pump.stop.set();
+	host_thread.wait_to_finish();
+	game_thread.wait_to_finish();
+	memdelete(game);
+	memdelete(host);
+
+	CHECK(failed == 0);
+	REQUIRE(latencies.size() > 0);
+
+	SortArray<uint64_t> sorter;
+	sorter.sort(latencies.ptr(), latencies.size());
+	const uint64_t p99 = latencies[MIN(latencies.size() - 1, latencies.size() * 99 / 100)];
+	MESSAGE(vformat("Bridge loopback: %d commands (window %d) in %.1f ms, %.0f commands/s, p50 %d us, p99 %d us.",
+			commands, window, elapsed / 1000.0, commands * 1000000.0 / MAX(elapsed, (uint64_t)1),
+			latencies[latencies.size() / 2], p99));
+}
+
+} // namespace TestMCPBridge
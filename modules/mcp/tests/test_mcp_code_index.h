@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  test_mcp_code_index.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../mcp_code_index.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+#include "modules/modules_enabled.gen.h"
+
+#ifdef MODULE_GDSCRIPT_ENABLED
+
+namespace TestMCPCodeIndex {
+
+static void write_script(const String &p_path, const String &p_source) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_source);
+}
+
+TEST_CASE("[Modules][MCP] Code index") {
+	const String dir = TestUtils::get_temp_path("mcp_code_index");
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	da->make_dir_recursive(dir);
+	const String player_path = dir.path_join("player.gd");
+	const String enemy_path = dir.path_join("enemy.gd");
+
+	write_script(player_path, "class_name Player\nextends Node\n\nsignal died\n\nvar health := 10\n\nfunc hurt(amount: int) -> void:\n\thealth -= amount\n\tif health <= 0:\n\t\tdied.emit()\n");
+	write_script(enemy_path, "extends Node\n\nfunc attack(target: Player) -> void:\n\ttarget.hurt(2)\n");
+
+	MCPCodeIndex index;
+	index.refresh(dir, true);
+	CHECK(index.get_script_count() == 2);
+
+	MCPCodeIndex::ScriptInfo info;
+	REQUIRE(index.get_script(player_path, info));
+	CHECK(info.valid);
+	CHECK(info.class_name == "Player");
+	CHECK(info.extends == "Node");
+
+	Array definitions = index.find_symbol("hurt", dir);
+	REQUIRE(definitions.size() == 1);
+	Dictionary definition = definitions[0];
+	CHECK(String(definition["file"]) == player_path);
+	CHECK(int(definition["line"]) == 8);
+	CHECK(String(definition["kind"]) == "function");
+
+	// The declaration and the call in enemy.gd.
+	CHECK(index.find_references("hurt", dir, 100).size() == 2);
+	CHECK(index.find_references("hurt", dir, 1).size() == 1);
+
+	SUBCASE("Changed scripts are parsed again") {
+		write_script(enemy_path, "extends Node\n\nfunc attack(target: Player) -> void:\n\tpass\n");
+		REQUIRE(index.get_script(enemy_path, info));
+		CHECK(index.find_references("hurt", dir, 100).size() == 1);
+	}
+
+	SUBCASE("Deleted scripts are dropped") {
+		da->remove(player_path);
+		index.refresh(dir, true);
+		CHECK(index.get_script_count() == 1);
+		CHECK(index.find_symbol("hurt", dir).is_empty());
+		CHECK_FALSE(index.get_script(player_path, info));
+	}
+
+	SUBCASE("Invalid scripts report their errors") {
+		write_script(enemy_path, "extends Node\n\nfunc attack(\n");
+		REQUIRE(index.get_script(enemy_path, info));
+		CHECK_FALSE(info.valid);
+		CHECK_FALSE(info.errors.is_empty());
+	}
+
+	da->remove(enemy_path);
+	da->remove(player_path);
+	da->remove(dir);
+}
+
+} // namespace TestMCPCodeIndex
+
+#endif // MODULE_GDSCRIPT_ENABLED
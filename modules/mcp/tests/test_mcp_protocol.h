@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*  test_mcp_protocol.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file test_mcp_protocol.h
+ *
+ * @brief Dispatch of MCP tool calls, inline or on the WorkerThreadPool.
+ */
+
+#include "../mcp_protocol.h"
+#include "../mcp_tools.h"
+
+#include "core/io/json.h"
+#include "core/os/mutex.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMCPProtocol {
+
+// Collects the messages written outside of process_string(), possibly from worker threads.
+class OutputSink : public Object {
+	GDSOFTCLASS(OutputSink, Object);
+
+public:
+	BinaryMutex mutex;
+	LocalVector<Dictionary> messages;
+
+	void write(const String &p_line) {
+		Dictionary message = JSON::parse_string(p_line);
+		MutexLock lock(mutex);
+		messages.push_back(message);
+	}
+};
+
+static String send(MCPProtocol *p_protocol, int p_id, const String &p_method, const Dictionary &p_params = Dictionary()) {
+	Dictionary request;
+	request["jsonrpc"] = "2.0";
+	if (p_id >= 0) {
+		request["id"] = p_id;
+	}
+	request["method"] = p_method;
+	request["params"] = p_params;
+	return p_protocol->process_string(JSON::stringify(request));
+}
+
+static Dictionary tool_call(const String &p_name, const String &p_action, const String &p_query = String()) {
+	Dictionary arguments;
+	arguments["action"] = p_action;
+	if (!p_query.is_empty()) {
+		arguments["query"] = p_query;
+		arguments["path"] = p_query;
+	}
+	Dictionary params;
+	params["name"] = p_name;
+	params["arguments"] = arguments;
+	return params;
+}
+
+static MCPProtocol *make_protocol(OutputSink *p_sink, bool p_concurrent) {
+	MCPProtocol *protocol = memnew(MCPProtocol);
+	protocol->set_output_callback(callable_mp(p_sink, &OutputSink::write));
+	protocol->set_concurrent_tools_enabled(p_concurrent);
+	const Dictionary initialize_response = JSON::parse_string(send(protocol, 0, "initialize"));
+	CHECK(initialize_response.has("result"));
+	CHECK_MESSAGE(send(protocol, -1, "notifications/initialized").is_empty(), "Notifications should not be answered.");
+	CHECK(protocol->is_initialized());
+	return protocol;
+}
+
+TEST_CASE("[Modules][MCP] Read-only tool classification") {
+	Dictionary args;
+	args["action"] = "get_docs";
+	CHECK(MCPTools::is_tool_read_only("code_intel", args));
+	args["action"] = "search";
+	CHECK(MCPTools::is_tool_read_only("code_intel", args));
+
+	// Parser-backed actions are serialized with the mutating tools.
+	args["action"] = "validate";
+	CHECK_FALSE(MCPTools::is_tool_read_only("code_intel", args));
+	args["action"] = "get_symbols";
+	CHECK_FALSE(MCPTools::is_tool_read_only("code_intel", args));
+	args["action"] = "find_symbol";
+	CHECK_FALSE(MCPTools::is_tool_read_only("code_intel", args));
+	args["action"] = "find_references";
+	CHECK_FALSE(MCPTools::is_tool_read_only("code_intel", args));
+
+	args["action"] = "inspect";
+	CHECK(MCPTools::is_tool_read_only("resource_action", args));
+	args["action"] = "modify";
+	CHECK_FALSE(MCPTools::is_tool_read_only("resource_action", args));
+	args["action"] = "list_files";
+	CHECK(MCPTools::is_tool_read_only("project_config", args));
+	args["action"] = "create_file_res";
+	CHECK_FALSE(MCPTools::is_tool_read_only("project_config", args));
+	args["action"] = "capture";
+	CHECK(MCPTools::is_tool_read_only("game_control", args));
+	args["action"] = "run";
+	CHECK_FALSE(MCPTools::is_tool_read_only("game_control", args));
+	args["action"] = "get_node";
+	CHECK_FALSE(MCPTools::is_tool_read_only("scene_action", args));
+	CHECK_FALSE(MCPTools::is_tool_read_only("unknown_tool", Dictionary()));
+}
+
+TEST_CASE("[Modules][MCP] Tool calls answered inline and from workers") {
+	OutputSink sink;
+
+	SUBCASE("Read-only calls are answered later through the output callback") {
+		MCPProtocol *protocol = make_protocol(&sink, true);
+		CHECK(send(protocol, 1, "tools/call", tool_call("code_intel", "get_docs", "Object")).is_empty());
+
+		// Calls behind it are not held up, mutating and parser-backed ones run inline.
+		Dictionary ping = JSON::parse_string(send(protocol, 2, "ping"));
+		CHECK(int(ping.get("id", -1)) == 2);
+		Dictionary validate = JSON::parse_string(send(protocol, 3, "tools/call", tool_call("code_intel", "validate", "res://missing.gd")));
+		CHECK(int(validate.get("id", -1)) == 3);
+		CHECK(validate.has("result"));
+
+		memdelete(protocol);
+		REQUIRE(sink.messages.size() == 1);
+		const Dictionary &response = sink.messages[0];
+		CHECK(int(response.get("id", -1)) == 1);
+		Dictionary result = response.get("result", Dictionary());
+		CHECK_FALSE(bool(result.get("isError", false)));
+		CHECK(JSON::stringify(result).contains("\\\"class\\\": \\\"Object\\\""));
+	}
+
+	SUBCASE("Everything is answered inline when concurrency is disabled") {
+		MCPProtocol *protocol = make_protocol(&sink, false);
+		Dictionary response = JSON::parse_string(send(protocol, 1, "tools/call", tool_call("code_intel", "get_docs", "Object")));
+		CHECK(int(response.get("id", -1)) == 1);
+		CHECK(response.has("result"));
+		memdelete(protocol);
+		CHECK(sink.messages.is_empty());
+	}
+}
+
+TEST_CASE("[Modules][MCP] In-flight tool calls are reaped with their responses") {
+	OutputSink sink;
+	MCPProtocol *protocol = make_protocol(&sink, true);
+
+	const int calls = 32;
+	for (int i = 1; i <= calls; i++) {
+		CHECK(send(protocol, i, "tools/call", tool_call("code_intel", "get_docs", i % 2 ? "Node" : "Object")).is_empty());
+	}
+	// Destroying the protocol waits for every task still running.
+	memdelete(protocol);
+
+	REQUIRE(sink.messages.size() == calls);
+	LocalVector<int> seen;
+	seen.resize_initialized(calls + 1);
+	for (const Dictionary &response : sink.messages) {
+		const int id = response.get("id", 0);
+		REQUIRE(id >= 1);
+		REQUIRE(id <= calls);
+		seen[id]++;
+		CHECK(response.has("result"));
+	}
+	for (int i = 1; i <= calls; i++) {
+		CHECK_MESSAGE(seen[i] == 1, vformat("Request %d answered %d times.", i, seen[i]));
+	}
+}
+
+} // namespace TestMCPProtocol
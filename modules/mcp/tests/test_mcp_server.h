@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  test_mcp_server.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file test_mcp_server.h
+ *
+ * @brief Framing of the newline-delimited stdio transport used by MCPServer.
+ */
+
+#include "../mcp_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMCPServer {
+
+static void append_string(MCPLineReader &r_reader, const char *p_text) {
+	r_reader.append((const uint8_t *)p_text, strlen(p_text));
+}
+
+TEST_CASE("[Modules][MCP] Line reader splits messages") {
+	MCPLineReader reader;
+	String line;
+
+	SUBCASE("Several lines in one read") {
+		append_string(reader, "{\"id\":1}\n{\"id\":2}\n");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "{\"id\":1}");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "{\"id\":2}");
+		CHECK_FALSE(reader.take_line(line));
+		CHECK(reader.get_buffered_size() == 0);
+	}
+
+	SUBCASE("Partial lines are kept until their newline arrives") {
+		append_string(reader, "{\"method\":");
+		CHECK_FALSE(reader.take_line(line));
+		append_string(reader, "\"ping\"");
+		CHECK_FALSE(reader.take_line(line));
+		append_string(reader, "}\n{\"id\"");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "{\"method\":\"ping\"}");
+		CHECK_FALSE(reader.take_line(line));
+		CHECK(reader.get_buffered_size() == 5);
+	}
+
+	SUBCASE("CRLF terminators are stripped") {
+		append_string(reader, "first\r\nsecond\r");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "first");
+		CHECK_FALSE(reader.take_line(line));
+		append_string(reader, "\n\r\n");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "second");
+		REQUIRE(reader.take_line(line));
+		CHECK(line.is_empty());
+	}
+
+	SUBCASE("Multi-byte characters split across reads") {
+		// "é" is 0xC3 0xA9 in UTF-8, the read boundary falls between both bytes.
+		const uint8_t first[] = { 'c', 'a', 'f', 0xC3 };
+		const uint8_t second[] = { 0xA9, '\n' };
+		reader.append(first, sizeof(first));
+		CHECK_FALSE(reader.take_line(line));
+		reader.append(second, sizeof(second));
+		REQUIRE(reader.take_line(line));
+		CHECK(line == String::utf8("caf\xC3\xA9"));
+	}
+
+	SUBCASE("Short reads only keep the bytes read") {
+		uint8_t *dst = reader.prepare_write(64);
+		memcpy(dst, "abc\nde", 6);
+		reader.commit_write(6);
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "abc");
+		CHECK(reader.get_buffered_size() == 2);
+		dst = reader.prepare_write(64);
+		memcpy(dst, "f\n", 2);
+		reader.commit_write(2);
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "def");
+	}
+
+	CHECK(reader.take_dropped_lines() == 0);
+}
+
+TEST_CASE("[Modules][MCP] Line reader drops oversized messages") {
+	MCPLineReader reader(8);
+	String line;
+
+	SUBCASE("Complete line") {
+		append_string(reader, "0123456789\nok\n");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "ok");
+		CHECK(reader.take_dropped_lines() == 1);
+	}
+
+	SUBCASE("Partial line is released before its newline arrives") {
+		append_string(reader, "0123456789");
+		CHECK_FALSE(reader.take_line(line));
+		CHECK(reader.take_dropped_lines() == 1);
+		CHECK(reader.get_buffered_size() == 0);
+
+		// The rest of the oversized line is skipped, without being reported again.
+		append_string(reader, "0123456789");
+		CHECK_FALSE(reader.take_line(line));
+		CHECK(reader.get_buffered_size() == 0);
+		append_string(reader, "tail\nnext\n");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "next");
+		CHECK(reader.take_dropped_lines() == 0);
+	}
+
+	SUBCASE("Lines at the limit are kept") {
+		append_string(reader, "01234567\r\n");
+		REQUIRE(reader.take_line(line));
+		CHECK(line == "01234567");
+		CHECK(reader.take_dropped_lines() == 0);
+	}
+}
+
+} // namespace TestMCPServer
@@ -213,6 +213,34 @@ bool GodotNavigationServer3D::map_get_use_edge_connections(RID p_map) const {
 	return map->get_use_edge_connections();
 }
 
+COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_hierarchical_pathfinding(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_hierarchical_pathfinding(RID p_map) const {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_hierarchical_pathfinding();
+}
+
+COMMAND_2(map_set_use_packed_avoidance, RID, p_map, bool, p_enabled) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_packed_avoidance(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_packed_avoidance(RID p_map) const {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_packed_avoidance();
+}
+
 COMMAND_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin) {
 	NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL(map);
@@ -388,6 +416,13 @@ Vector3 GodotNavigationServer3D::map_get_random_point(RID p_map, uint32_t p_navi
 	return map->get_random_point(p_navigation_layers, p_uniformly);
 }
 
+Vector3 GodotNavigationServer3D::map_get_flow_direction(RID p_map, const Vector3 &p_target_position, const Vector3 &p_position, uint32_t p_navigation_layers) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Vector3());
+
+	return map->get_flow_direction(p_target_position, p_position, p_navigation_layers);
+}
+
 RID GodotNavigationServer3D::region_create() {
 	MutexLock lock(operations_mutex);
 
@@ -976,6 +1011,13 @@ bool GodotNavigationServer3D::agent_is_map_changed(RID p_agent) const {
 	return agent->is_map_changed();
 }
 
+Vector3 GodotNavigationServer3D::agent_get_flow_direction(RID p_agent, const Vector3 &p_target_position, uint32_t p_navigation_layers) const {
+	NavAgent3D *agent = agent_owner.get_or_null(p_agent);
+	ERR_FAIL_NULL_V(agent, Vector3());
+
+	return agent->get_flow_direction(p_target_position, p_navigation_layers);
+}
+
 COMMAND_2(agent_set_avoidance_callback, RID, p_agent, Callable, p_callback) {
 	NavAgent3D *agent = agent_owner.get_or_null(p_agent);
 	ERR_FAIL_NULL(agent);
@@ -1372,6 +1414,13 @@ uint32_t GodotNavigationServer3D::map_get_iteration_id(RID p_map) const {
 	return map->get_iteration_id();
 }
 
+uint64_t GodotNavigationServer3D::map_get_pathfinding_memory_usage(RID p_map) const {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_pathfinding_memory_usage();
+}
+
 void GodotNavigationServer3D::sync() {
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->sync();
@@ -1452,6 +1501,23 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryBatchResult3D> p_query_result) {
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	p_query_result->reset();
+	if (p_query_parameters.is_empty()) {
+		return;
+	}
+
+	const Ref<NavigationPathQueryParameters3D> first_parameters = p_query_parameters[0];
+	ERR_FAIL_COND(first_parameters.is_null());
+
+	NavMap3D *map = map_owner.get_or_null(first_parameters->get_map());
+	ERR_FAIL_NULL(map);
+
+	NavMeshQueries3D::map_query_path_batch(map, p_query_parameters, p_query_result);
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -130,6 +130,12 @@ public:
 	COMMAND_2(map_set_use_edge_connections, RID, p_map, bool, p_enabled);
 	virtual bool map_get_use_edge_connections(RID p_map) const override;
 
+	COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled);
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const override;
+
+	COMMAND_2(map_set_use_packed_avoidance, RID, p_map, bool, p_enabled);
+	virtual bool map_get_use_packed_avoidance(RID p_map) const override;
+
 	COMMAND_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin);
 	virtual real_t map_get_edge_connection_margin(RID p_map) const override;
 
@@ -155,6 +161,7 @@ public:
 	virtual bool map_get_use_async_iterations(RID p_map) const override;
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override;
+	virtual Vector3 map_get_flow_direction(RID p_map, const Vector3 &p_target_position, const Vector3 &p_position, uint32_t p_navigation_layers = 1) const override;
 
 	virtual RID region_create() override;
 	virtual uint32_t region_get_iteration_id(RID p_region) const override;
@@ -247,6 +254,7 @@ public:
 	COMMAND_2(agent_set_position, RID, p_agent, Vector3, p_position);
 	virtual Vector3 agent_get_position(RID p_agent) const override;
 	virtual bool agent_is_map_changed(RID p_agent) const override;
+	virtual Vector3 agent_get_flow_direction(RID p_agent, const Vector3 &p_target_position, uint32_t p_navigation_layers = 1) const override;
 	COMMAND_2(agent_set_avoidance_callback, RID, p_agent, Callable, p_callback);
 	virtual bool agent_has_avoidance_callback(RID p_agent) const override;
 	COMMAND_2(agent_set_avoidance_layers, RID, p_agent, uint32_t, p_layers);
@@ -313,9 +321,13 @@ public:
 	virtual void finish() override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryBatchResult3D> p_query_result) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
+	/// Bytes used by the map for hierarchical pathfinding and path query scratch data.
+	uint64_t map_get_pathfinding_memory_usage(RID p_map) const;
+
 private:
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
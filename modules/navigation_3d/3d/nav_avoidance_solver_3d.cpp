@@ -0,0 +1,564 @@
+/**************************************************************************/
+/*  nav_avoidance_solver_3d.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file nav_avoidance_solver_3d.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "nav_avoidance_solver_3d.h"
+
+#include "../nav_agent_3d.h"
+
+#include "core/object/worker_thread_pool.h"
+
+#include <KdTree2d.h>
+#include <Obstacle2d.h>
+
+void NavAvoidanceSolver3D::_pack_agents(const LocalVector<NavAgent3D *> &p_agents) {
+	const uint32_t agent_count = p_agents.size();
+
+	agents = p_agents;
+	position_x.resize(agent_count);
+	position_y.resize(agent_count);
+	velocity_x.resize(agent_count);
+	velocity_y.resize(agent_count);
+	elevation.resize(agent_count);
+	height.resize(agent_count);
+	radius.resize(agent_count);
+	neighbor_distance.resize(agent_count);
+	time_horizon.resize(agent_count);
+	avoidance_priority.resize(agent_count);
+	max_neighbors.resize(agent_count);
+	avoidance_layers.resize(agent_count);
+	avoidance_mask.resize(agent_count);
+	new_velocity_x.resize(agent_count);
+	new_velocity_y.resize(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const RVO2D::Agent2D *rvo_agent = p_agents[i]->get_rvo_agent_2d();
+		position_x[i] = rvo_agent->position_.x();
+		position_y[i] = rvo_agent->position_.y();
+		velocity_x[i] = rvo_agent->velocity_.x();
+		velocity_y[i] = rvo_agent->velocity_.y();
+		elevation[i] = rvo_agent->elevation_;
+		height[i] = rvo_agent->height_;
+		radius[i] = rvo_agent->radius_;
+		neighbor_distance[i] = rvo_agent->neighborDist_;
+		time_horizon[i] = rvo_agent->timeHorizon_;
+		avoidance_priority[i] = rvo_agent->avoidance_priority_;
+		max_neighbors[i] = rvo_agent->maxNeighbors_;
+		avoidance_layers[i] = rvo_agent->avoidance_layers_;
+		avoidance_mask[i] = rvo_agent->avoidance_mask_;
+	}
+}
+
+void NavAvoidanceSolver3D::_build_grid() {
+	const uint32_t agent_count = agents.size();
+
+	float min_x = FLT_MAX;
+	float min_y = FLT_MAX;
+	float max_x = -FLT_MAX;
+	float max_y = -FLT_MAX;
+	for (uint32_t i = 0; i < agent_count; i++) {
+		min_x = MIN(min_x, position_x[i]);
+		min_y = MIN(min_y, position_y[i]);
+		max_x = MAX(max_x, position_x[i]);
+		max_y = MAX(max_y, position_y[i]);
+	}
+
+	// Cells sized for a few agents each, so that the nearest neighbors are usually found in the first rings around an agent.
+	// Degenerate crowds on a line or a point use larger cells, so that the search doesn't walk through rings of empty cells.
+	const float extent_x = MAX(max_x - min_x, 0.01f);
+	const float extent_y = MAX(max_y - min_y, 0.01f);
+	grid_cell_size = MAX(Math::sqrt(extent_x * extent_y * AGENTS_PER_GRID_CELL / agent_count), 0.01f);
+	const double max_cells = double(agent_count) * MAX_GRID_CELLS_PER_AGENT + 1.0;
+	double width = Math::floor((max_x - min_x) / grid_cell_size) + 1.0;
+	double height_cells = Math::floor((max_y - min_y) / grid_cell_size) + 1.0;
+	while (width * height_cells > max_cells) {
+		grid_cell_size *= 2.0f;
+		width = Math::floor((max_x - min_x) / grid_cell_size) + 1.0;
+		height_cells = Math::floor((max_y - min_y) / grid_cell_size) + 1.0;
+	}
+
+	grid_origin_x = min_x;
+	grid_origin_y = min_y;
+	grid_width = int32_t(width);
+	grid_height = int32_t(height_cells);
+
+	// Counting sort of the agents by hash bucket.
+	const uint32_t bucket_count = next_power_of_2(MAX(agent_count * GRID_BUCKETS_PER_AGENT, 2u));
+	grid_bucket_mask = bucket_count - 1;
+	grid_bucket_start.resize(bucket_count + 1);
+	for (uint32_t &bucket_start : grid_bucket_start) {
+		bucket_start = 0;
+	}
+	agent_cell_x.resize(agent_count);
+	agent_cell_y.resize(agent_count);
+	grid_agents.resize(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		agent_cell_x[i] = MIN(int32_t((position_x[i] - grid_origin_x) / grid_cell_size), grid_width - 1);
+		agent_cell_y[i] = MIN(int32_t((position_y[i] - grid_origin_y) / grid_cell_size), grid_height - 1);
+		grid_bucket_start[_get_cell_bucket(agent_cell_x[i], agent_cell_y[i]) + 1]++;
+	}
+	for (uint32_t bucket = 0; bucket < bucket_count; bucket++) {
+		grid_bucket_start[bucket + 1] += grid_bucket_start[bucket];
+	}
+	for (uint32_t i = 0; i < agent_count; i++) {
+		grid_agents[grid_bucket_start[_get_cell_bucket(agent_cell_x[i], agent_cell_y[i])]++] = i;
+	}
+	// Filling moved every bucket start to the start of the next bucket, move them back.
+	for (uint32_t bucket = bucket_count - 1; bucket > 0; bucket--) {
+		grid_bucket_start[bucket] = grid_bucket_start[bucket - 1];
+	}
+	grid_bucket_start[0] = 0;
+}
+
+void NavAvoidanceSolver3D::_compute_agent_neighbors(uint32_t p_agent_index, Scratch &r_scratch) const {
+	r_scratch.neighbors.clear();
+	r_scratch.neighbor_distances_sq.clear();
+
+	const uint32_t neighbor_count = max_neighbors[p_agent_index];
+	if (neighbor_count == 0) {
+		return;
+	}
+
+	const float x = position_x[p_agent_index];
+	const float y = position_y[p_agent_index];
+	float range_sq = neighbor_distance[p_agent_index] * neighbor_distance[p_agent_index];
+
+	const int32_t cell_x_of_agent = agent_cell_x[p_agent_index];
+	const int32_t cell_y_of_agent = agent_cell_y[p_agent_index];
+	const int32_t max_ring = MAX(grid_width, grid_height);
+
+	// Visit the cells in rings around the agent cell. Like the RVO2 kd-tree, the search range shrinks
+	// once enough neighbors are found, and the search stops when the next ring is out of range.
+	for (int32_t ring = 0; ring <= max_ring; ring++) {
+		if (ring > 0 && (ring - 1) * grid_cell_size * (ring - 1) * grid_cell_size >= range_sq) {
+			break;
+		}
+
+		const int32_t begin_y = MAX(cell_y_of_agent - ring, 0);
+		const int32_t end_y = MIN(cell_y_of_agent + ring, grid_height - 1);
+		for (int32_t cell_y = begin_y; cell_y <= end_y; cell_y++) {
+			const bool full_row = cell_y == cell_y_of_agent - ring || cell_y == cell_y_of_agent + ring;
+			const int32_t step_x = full_row ? 1 : MAX(2 * ring, 1);
+			for (int32_t cell_x = cell_x_of_agent - ring; cell_x <= cell_x_of_agent + ring; cell_x += step_x) {
+				if (cell_x < 0 || cell_x >= grid_width) {
+					continue;
+				}
+
+				// Same filters and nearest neighbors selection as RVO2D::Agent2D::insertAgentNeighbor().
+				const uint32_t bucket = _get_cell_bucket(cell_x, cell_y);
+				for (uint32_t bucket_agent = grid_bucket_start[bucket]; bucket_agent < grid_bucket_start[bucket + 1]; bucket_agent++) {
+					const uint32_t other = grid_agents[bucket_agent];
+					if (other == p_agent_index || agent_cell_x[other] != cell_x || agent_cell_y[other] != cell_y) {
+						continue;
+					}
+					if ((avoidance_mask[p_agent_index] & avoidance_layers[other]) == 0) {
+						continue;
+					}
+					if (elevation[p_agent_index] > elevation[other] + height[other] || elevation[p_agent_index] + height[p_agent_index] < elevation[other]) {
+						continue;
+					}
+					if (avoidance_priority[p_agent_index] > avoidance_priority[other]) {
+						continue;
+					}
+
+					const float offset_x = position_x[other] - x;
+					const float offset_y = position_y[other] - y;
+					const float distance_sq = offset_x * offset_x + offset_y * offset_y;
+					if (distance_sq >= range_sq) {
+						continue;
+					}
+
+					if (r_scratch.neighbors.size() < neighbor_count) {
+						r_scratch.neighbors.push_back(other);
+						r_scratch.neighbor_distances_sq.push_back(distance_sq);
+					}
+
+					uint32_t i = r_scratch.neighbors.size() - 1;
+					while (i != 0 && distance_sq < r_scratch.neighbor_distances_sq[i - 1]) {
+						r_scratch.neighbors[i] = r_scratch.neighbors[i - 1];
+						r_scratch.neighbor_distances_sq[i] = r_scratch.neighbor_distances_sq[i - 1];
+						i--;
+					}
+					r_scratch.neighbors[i] = other;
+					r_scratch.neighbor_distances_sq[i] = distance_sq;
+
+					if (r_scratch.neighbors.size() == neighbor_count) {
+						range_sq = r_scratch.neighbor_distances_sq[neighbor_count - 1];
+					}
+				}
+			}
+		}
+	}
+}
+
+void NavAvoidanceSolver3D::_compute_obstacle_lines(RVO2D::Agent2D *p_rvo_agent, Scratch &r_scratch) const {
+	// Same as the obstacle part of RVO2D::Agent2D::computeNewVelocity().
+	const RVO2D::Vector2 &position = p_rvo_agent->position_;
+	const RVO2D::Vector2 &velocity = p_rvo_agent->velocity_;
+	const float agent_radius = p_rvo_agent->radius_;
+	const float inv_time_horizon_obstacles = 1.0f / p_rvo_agent->timeHorizonObst_;
+	std::vector<RVO2D::Line> &lines = r_scratch.lines;
+
+	for (const std::pair<float, const RVO2D::Obstacle2D *> &obstacle_neighbor : p_rvo_agent->obstacleNeighbors_) {
+		const RVO2D::Obstacle2D *obstacle1 = obstacle_neighbor.second;
+		const RVO2D::Obstacle2D *obstacle2 = obstacle1->nextObstacle_;
+
+		const RVO2D::Vector2 relative_position1 = obstacle1->point_ - position;
+		const RVO2D::Vector2 relative_position2 = obstacle2->point_ - position;
+
+		// Check if the velocity obstacle of the obstacle is already taken care of by previous obstacle lines.
+		bool already_covered = false;
+		for (const RVO2D::Line &line : lines) {
+			if (det(inv_time_horizon_obstacles * relative_position1 - line.point, line.direction) - inv_time_horizon_obstacles * agent_radius >= -RVO_EPSILON && det(inv_time_horizon_obstacles * relative_position2 - line.point, line.direction) - inv_time_horizon_obstacles * agent_radius >= -RVO_EPSILON) {
+				already_covered = true;
+				break;
+			}
+		}
+		if (already_covered) {
+			continue;
+		}
+
+		const float distance_sq1 = absSq(relative_position1);
+		const float distance_sq2 = absSq(relative_position2);
+		const float radius_sq = RVO2D::sqr(agent_radius);
+
+		const RVO2D::Vector2 obstacle_vector = obstacle2->point_ - obstacle1->point_;
+		const float s = (-relative_position1 * obstacle_vector) / absSq(obstacle_vector);
+		const float distance_sq_line = absSq(-relative_position1 - s * obstacle_vector);
+
+		RVO2D::Line line;
+
+		if (s < 0.0f && distance_sq1 <= radius_sq) {
+			// Collision with left vertex, ignored if non-convex.
+			if (obstacle1->isConvex_) {
+				line.point = RVO2D::Vector2(0.0f, 0.0f);
+				line.direction = normalize(RVO2D::Vector2(-relative_position1.y(), relative_position1.x()));
+				lines.push_back(line);
+			}
+			continue;
+		} else if (s > 1.0f && distance_sq2 <= radius_sq) {
+			// Collision with right vertex, ignored if non-convex or if handled by the neighboring obstacle.
+			if (obstacle2->isConvex_ && det(relative_position2, obstacle2->unitDir_) >= 0.0f) {
+				line.point = RVO2D::Vector2(0.0f, 0.0f);
+				line.direction = normalize(RVO2D::Vector2(-relative_position2.y(), relative_position2.x()));
+				lines.push_back(line);
+			}
+			continue;
+		} else if (s >= 0.0f && s < 1.0f && distance_sq_line <= radius_sq) {
+			// Collision with obstacle segment.
+			line.point = RVO2D::Vector2(0.0f, 0.0f);
+			line.direction = -obstacle1->unitDir_;
+			lines.push_back(line);
+			continue;
+		}
+
+		// No collision, compute the legs. When viewed obliquely, both legs can come from a single vertex.
+		RVO2D::Vector2 left_leg_direction;
+		RVO2D::Vector2 right_leg_direction;
+
+		if (s < 0.0f && distance_sq_line <= radius_sq) {
+			// Left vertex defines the velocity obstacle.
+			if (!obstacle1->isConvex_) {
+				continue;
+			}
+			obstacle2 = obstacle1;
+
+			const float leg1 = Math::sqrt(distance_sq1 - radius_sq);
+			left_leg_direction = RVO2D::Vector2(relative_position1.x() * leg1 - relative_position1.y() * agent_radius, relative_position1.x() * agent_radius + relative_position1.y() * leg1) / distance_sq1;
+			right_leg_direction = RVO2D::Vector2(relative_position1.x() * leg1 + relative_position1.y() * agent_radius, -relative_position1.x() * agent_radius + relative_position1.y() * leg1) / distance_sq1;
+		} else if (s > 1.0f && distance_sq_line <= radius_sq) {
+			// Right vertex defines the velocity obstacle.
+			if (!obstacle2->isConvex_) {
+				continue;
+			}
+			obstacle1 = obstacle2;
+
+			const float leg2 = Math::sqrt(distance_sq2 - radius_sq);
+			left_leg_direction = RVO2D::Vector2(relative_position2.x() * leg2 - relative_position2.y() * agent_radius, relative_position2.x() * agent_radius + relative_position2.y() * leg2) / distance_sq2;
+			right_leg_direction = RVO2D::Vector2(relative_position2.x() * leg2 + relative_position2.y() * agent_radius, -relative_position2.x() * agent_radius + relative_position2.y() * leg2) / distance_sq2;
+		} else {
+			if (obstacle1->isConvex_) {
+				const float leg1 = Math::sqrt(distance_sq1 - radius_sq);
+				left_leg_direction = RVO2D::Vector2(relative_position1.x() * leg1 - relative_position1.y() * agent_radius, relative_position1.x() * agent_radius + relative_position1.y() * leg1) / distance_sq1;
+			} else {
+				// Left vertex non-convex, the left leg extends the cut-off line.
+				left_leg_direction = -obstacle1->unitDir_;
+			}
+
+			if (obstacle2->isConvex_) {
+				const float leg2 = Math::sqrt(distance_sq2 - radius_sq);
+				right_leg_direction = RVO2D::Vector2(relative_position2.x() * leg2 + relative_position2.y() * agent_radius, -relative_position2.x() * agent_radius + relative_position2.y() * leg2) / distance_sq2;
+			} else {
+				// Right vertex non-convex, the right leg extends the cut-off line.
+				right_leg_direction = obstacle1->unitDir_;
+			}
+		}
+
+		// Legs can never point into a neighboring edge at a convex vertex, use the cut-off line of that edge instead.
+		// If the velocity is projected on such a "foreign" leg, no line is added.
+		const RVO2D::Obstacle2D *const left_neighbor = obstacle1->prevObstacle_;
+
+		bool is_left_leg_foreign = false;
+		bool is_right_leg_foreign = false;
+
+		if (obstacle1->isConvex_ && det(left_leg_direction, -left_neighbor->unitDir_) >= 0.0f) {
+			left_leg_direction = -left_neighbor->unitDir_;
+			is_left_leg_foreign = true;
+		}
+		if (obstacle2->isConvex_ && det(right_leg_direction, obstacle2->unitDir_) <= 0.0f) {
+			right_leg_direction = obstacle2->unitDir_;
+			is_right_leg_foreign = true;
+		}
+
+		const RVO2D::Vector2 left_cutoff = inv_time_horizon_obstacles * (obstacle1->point_ - position);
+		const RVO2D::Vector2 right_cutoff = inv_time_horizon_obstacles * (obstacle2->point_ - position);
+		const RVO2D::Vector2 cutoff_vector = right_cutoff - left_cutoff;
+
+		const float t = obstacle1 == obstacle2 ? 0.5f : ((velocity - left_cutoff) * cutoff_vector) / absSq(cutoff_vector);
+		const float t_left = (velocity - left_cutoff) * left_leg_direction;
+		const float t_right = (velocity - right_cutoff) * right_leg_direction;
+
+		if ((t < 0.0f && t_left < 0.0f) || (obstacle1 == obstacle2 && t_left < 0.0f && t_right < 0.0f)) {
+			// Project on the left cut-off circle.
+			const RVO2D::Vector2 unit_w = normalize(velocity - left_cutoff);
+			line.direction = RVO2D::Vector2(unit_w.y(), -unit_w.x());
+			line.point = left_cutoff + agent_radius * inv_time_horizon_obstacles * unit_w;
+			lines.push_back(line);
+			continue;
+		} else if (t > 1.0f && t_right < 0.0f) {
+			// Project on the right cut-off circle.
+			const RVO2D::Vector2 unit_w = normalize(velocity - right_cutoff);
+			line.direction = RVO2D::Vector2(unit_w.y(), -unit_w.x());
+			line.point = right_cutoff + agent_radius * inv_time_horizon_obstacles * unit_w;
+			lines.push_back(line);
+			continue;
+		}
+
+		// Project on the left leg, the right leg, or the cut-off line, whichever is closest to the velocity.
+		const float distance_sq_cutoff = (t < 0.0f || t > 1.0f || obstacle1 == obstacle2) ? FLT_MAX : absSq(velocity - (left_cutoff + t * cutoff_vector));
+		const float distance_sq_left = t_left < 0.0f ? FLT_MAX : absSq(velocity - (left_cutoff + t_left * left_leg_direction));
+		const float distance_sq_right = t_right < 0.0f ? FLT_MAX : absSq(velocity - (right_cutoff + t_right * right_leg_direction));
+
+		if (distance_sq_cutoff <= distance_sq_left && distance_sq_cutoff <= distance_sq_right) {
+			line.direction = -obstacle1->unitDir_;
+			line.point = left_cutoff + agent_radius * inv_time_horizon_obstacles * RVO2D::Vector2(-line.direction.y(), line.direction.x());
+			lines.push_back(line);
+		} else if (distance_sq_left <= distance_sq_right) {
+			if (is_left_leg_foreign) {
+				continue;
+			}
+			line.direction = left_leg_direction;
+			line.point = left_cutoff + agent_radius * inv_time_horizon_obstacles * RVO2D::Vector2(-line.direction.y(), line.direction.x());
+			lines.push_back(line);
+		} else {
+			if (is_right_leg_foreign) {
+				continue;
+			}
+			line.direction = -right_leg_direction;
+			line.point = right_cutoff + agent_radius * inv_time_horizon_obstacles * RVO2D::Vector2(-line.direction.y(), line.direction.x());
+			lines.push_back(line);
+		}
+	}
+}
+
+void NavAvoidanceSolver3D::_compute_agent_lines(uint32_t p_agent_index, Scratch &r_scratch) const {
+	const uint32_t neighbor_count = r_scratch.neighbors.size();
+	if (neighbor_count == 0) {
+		return;
+	}
+
+	r_scratch.relative_position_x.resize(neighbor_count);
+	r_scratch.relative_position_y.resize(neighbor_count);
+	r_scratch.relative_velocity_x.resize(neighbor_count);
+	r_scratch.relative_velocity_y.resize(neighbor_count);
+	r_scratch.combined_radius.resize(neighbor_count);
+	r_scratch.line_point_x.resize(neighbor_count);
+	r_scratch.line_point_y.resize(neighbor_count);
+	r_scratch.line_direction_x.resize(neighbor_count);
+	r_scratch.line_direction_y.resize(neighbor_count);
+
+	const float agent_velocity_x = velocity_x[p_agent_index];
+	const float agent_velocity_y = velocity_y[p_agent_index];
+
+	for (uint32_t i = 0; i < neighbor_count; i++) {
+		const uint32_t other = r_scratch.neighbors[i];
+		r_scratch.relative_position_x[i] = position_x[other] - position_x[p_agent_index];
+		r_scratch.relative_position_y[i] = position_y[other] - position_y[p_agent_index];
+		r_scratch.relative_velocity_x[i] = agent_velocity_x - velocity_x[other];
+		r_scratch.relative_velocity_y[i] = agent_velocity_y - velocity_y[other];
+		r_scratch.combined_radius[i] = radius[p_agent_index] + radius[other];
+	}
+
+	// Same lines as the agent part of RVO2D::Agent2D::computeNewVelocity(), but the branches are replaced
+	// by selects over the packed neighbor data so that the compiler can vectorize the loop.
+	const float inv_time_horizon = 1.0f / time_horizon[p_agent_index];
+	const float inv_time_step = 1.0f / time_step;
+
+	const float *relative_position_x = r_scratch.relative_position_x.ptr();
+	const float *relative_position_y = r_scratch.relative_position_y.ptr();
+	const float *relative_velocity_x = r_scratch.relative_velocity_x.ptr();
+	const float *relative_velocity_y = r_scratch.relative_velocity_y.ptr();
+	const float *combined_radius = r_scratch.combined_radius.ptr();
+	float *line_point_x = r_scratch.line_point_x.ptr();
+	float *line_point_y = r_scratch.line_point_y.ptr();
+	float *line_direction_x = r_scratch.line_direction_x.ptr();
+	float *line_direction_y = r_scratch.line_direction_y.ptr();
+
+	for (uint32_t i = 0; i < neighbor_count; i++) {
+		const float rp_x = relative_position_x[i];
+		const float rp_y = relative_position_y[i];
+		const float rv_x = relative_velocity_x[i];
+		const float rv_y = relative_velocity_y[i];
+		const float r = combined_radius[i];
+
+		const float distance_sq = rp_x * rp_x + rp_y * rp_y;
+		const float r_sq = r * r;
+		const bool collision = distance_sq <= r_sq;
+
+		// Vector from the cut-off center to the relative velocity. When colliding, the cut-off circle of the time step is used.
+		const float inv_time = collision ? inv_time_step : inv_time_horizon;
+		const float w_x = rv_x - inv_time * rp_x;
+		const float w_y = rv_y - inv_time * rp_y;
+		const float w_length_sq = w_x * w_x + w_y * w_y;
+		const float dot_product1 = w_x * rp_x + w_y * rp_y;
+		const bool use_cutoff_circle = collision || (dot_product1 < 0.0f && dot_product1 * dot_product1 > r_sq * w_length_sq);
+
+		// Projection on the cut-off circle.
+		const float w_length = Math::sqrt(w_length_sq);
+		const float inv_w_length = w_length > 0.0f ? 1.0f / w_length : 0.0f;
+		const float unit_w_x = w_x * inv_w_length;
+		const float unit_w_y = w_y * inv_w_length;
+		const float circle_u_scale = r * inv_time - w_length;
+
+		// Projection on the left or right leg.
+		const float leg = Math::sqrt(MAX(distance_sq - r_sq, 0.0f));
+		const float inv_distance_sq = distance_sq > 0.0f ? 1.0f / distance_sq : 0.0f;
+		const bool left_leg = rp_x * w_y - rp_y * w_x > 0.0f;
+		const float leg_direction_x = left_leg ? (rp_x * leg - rp_y * r) * inv_distance_sq : -(rp_x * leg + rp_y * r) * inv_distance_sq;
+		const float leg_direction_y = left_leg ? (rp_x * r + rp_y * leg) * inv_distance_sq : -(-rp_x * r + rp_y * leg) * inv_distance_sq;
+		const float dot_product2 = rv_x * leg_direction_x + rv_y * leg_direction_y;
+
+		const float u_x = use_cutoff_circle ? circle_u_scale * unit_w_x : dot_product2 * leg_direction_x - rv_x;
+		const float u_y = use_cutoff_circle ? circle_u_scale * unit_w_y : dot_product2 * leg_direction_y - rv_y;
+
+		line_direction_x[i] = use_cutoff_circle ? unit_w_y : leg_direction_x;
+		line_direction_y[i] = use_cutoff_circle ? -unit_w_x : leg_direction_y;
+		line_point_x[i] = agent_velocity_x + 0.5f * u_x;
+		line_point_y[i] = agent_velocity_y + 0.5f * u_y;
+	}
+
+	for (uint32_t i = 0; i < neighbor_count; i++) {
+		RVO2D::Line line;
+		line.point = RVO2D::Vector2(line_point_x[i], line_point_y[i]);
+		line.direction = RVO2D::Vector2(line_direction_x[i], line_direction_y[i]);
+		r_scratch.lines.push_back(line);
+	}
+}
+
+void NavAvoidanceSolver3D::_solve_agents(uint32_t p_worker_index, NavAgent3D **p_agents) {
+	Scratch &scratch = scratches[p_worker_index];
+
+	const uint32_t agent_count = agents.size();
+	while (true) {
+		const uint32_t begin = next_chunk.postincrement() * AGENTS_PER_CHUNK;
+		if (begin >= agent_count) {
+			break;
+		}
+		const uint32_t end = MIN(begin + AGENTS_PER_CHUNK, agent_count);
+
+		for (uint32_t agent_index = begin; agent_index < end; agent_index++) {
+			RVO2D::Agent2D *rvo_agent = p_agents[agent_index]->get_rvo_agent_2d();
+			scratch.lines.clear();
+
+			rvo_agent->obstacleNeighbors_.clear();
+			if (!rvo_simulation->obstacles_.empty()) {
+				const float range_sq = RVO2D::sqr(rvo_agent->timeHorizonObst_ * rvo_agent->maxSpeed_ + rvo_agent->radius_);
+				rvo_simulation->kdTree_->computeObstacleNeighbors(rvo_agent, range_sq);
+				_compute_obstacle_lines(rvo_agent, scratch);
+			}
+			const size_t obstacle_line_count = scratch.lines.size();
+
+			_compute_agent_neighbors(agent_index, scratch);
+			_compute_agent_lines(agent_index, scratch);
+
+			RVO2D::Vector2 new_velocity;
+			const size_t line_fail = RVO2D::linearProgram2(scratch.lines, rvo_agent->maxSpeed_, rvo_agent->prefVelocity_, false, new_velocity);
+			if (line_fail < scratch.lines.size()) {
+				RVO2D::linearProgram3(scratch.lines, obstacle_line_count, line_fail, rvo_agent->maxSpeed_, new_velocity);
+			}
+
+			new_velocity_x[agent_index] = new_velocity.x();
+			new_velocity_y[agent_index] = new_velocity.y();
+		}
+	}
+}
+
+void NavAvoidanceSolver3D::step(const LocalVector<NavAgent3D *> &p_agents, RVO2D::RVOSimulator2D &p_rvo_simulation, float p_time_step, bool p_use_threads, bool p_use_high_priority_threads) {
+	if (p_agents.is_empty()) {
+		return;
+	}
+
+	rvo_simulation = &p_rvo_simulation;
+	time_step = p_time_step;
+
+	_pack_agents(p_agents);
+	_build_grid();
+
+	// All agents read the velocities of the previous step, the new ones are only applied once every agent is solved.
+	// Every worker takes chunks of agents until none are left, with its own scratch buffers.
+	const uint32_t chunk_count = (agents.size() + AGENTS_PER_CHUNK - 1) / AGENTS_PER_CHUNK;
+	const uint32_t worker_count = p_use_threads ? MIN(uint32_t(WorkerThreadPool::get_singleton()->get_thread_count()), chunk_count) : 1;
+	if (scratches.size() < worker_count) {
+		scratches.resize(worker_count);
+	}
+	next_chunk.set(0);
+	if (worker_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavAvoidanceSolver3D::_solve_agents, agents.ptr(), worker_count, worker_count, p_use_high_priority_threads, SNAME("NavAvoidanceSolver3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_solve_agents(0, agents.ptr());
+	}
+
+	for (uint32_t i = 0; i < agents.size(); i++) {
+		RVO2D::Agent2D *rvo_agent = agents[i]->get_rvo_agent_2d();
+		rvo_agent->newVelocity_ = RVO2D::Vector2(new_velocity_x[i], new_velocity_y[i]);
+		rvo_agent->velocity_ = rvo_agent->newVelocity_;
+		rvo_agent->position_ += rvo_agent->velocity_ * time_step;
+		agents[i]->update();
+	}
+}
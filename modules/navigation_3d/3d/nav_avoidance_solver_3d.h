@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*  nav_avoidance_solver_3d.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file nav_avoidance_solver_3d.h
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+#include <Agent2d.h>
+#include <RVOSimulator2d.h>
+
+#include <vector>
+
+class NavAgent3D;
+
+/// Alternative to stepping the RVO2 agents one by one for the agents of a map that use 2D avoidance.
+/// The agent data is packed into arrays, the agent neighbors are found with a spatial hash that is rebuilt
+/// every step, and the agent ORCA lines are built in batches. Obstacles still use the RVO2 obstacle tree.
+/// The results are written back into the RVO2 agents, so NavAgent3D reads them like with the default solver.
+class NavAvoidanceSolver3D {
+	/// Number of agents a worker takes at once.
+	static constexpr uint32_t AGENTS_PER_CHUNK = 64;
+	/// Average number of agents per grid cell the grid cell size is chosen for.
+	static constexpr float AGENTS_PER_GRID_CELL = 2.0f;
+	/// The grid cell size grows when the crowd bounds would hold more cells than this many times the agent count,
+	/// which keeps the number of empty cells visited by the neighbor search low for crowds on a line or a point.
+	static constexpr uint32_t MAX_GRID_CELLS_PER_AGENT = 4;
+	/// Number of spatial hash buckets per agent, rounded up to a power of two.
+	static constexpr uint32_t GRID_BUCKETS_PER_AGENT = 2;
+
+	/// Per worker buffers, reused for all agents of the worker and kept from one step to the next.
+	struct Scratch {
+		LocalVector<uint32_t> neighbors;
+		LocalVector<float> neighbor_distances_sq;
+
+		LocalVector<float> relative_position_x;
+		LocalVector<float> relative_position_y;
+		LocalVector<float> relative_velocity_x;
+		LocalVector<float> relative_velocity_y;
+		LocalVector<float> combined_radius;
+
+		LocalVector<float> line_point_x;
+		LocalVector<float> line_point_y;
+		LocalVector<float> line_direction_x;
+		LocalVector<float> line_direction_y;
+
+		// The RVO2 linear programs expect a std::vector.
+		std::vector<RVO2D::Line> lines;
+	};
+
+	RVO2D::RVOSimulator2D *rvo_simulation = nullptr;
+	float time_step = 0.0f;
+
+	LocalVector<NavAgent3D *> agents;
+
+	LocalVector<float> position_x;
+	LocalVector<float> position_y;
+	LocalVector<float> velocity_x;
+	LocalVector<float> velocity_y;
+	LocalVector<float> elevation;
+	LocalVector<float> height;
+	LocalVector<float> radius;
+	LocalVector<float> neighbor_distance;
+	LocalVector<float> time_horizon;
+	LocalVector<float> avoidance_priority;
+	LocalVector<uint32_t> max_neighbors;
+	LocalVector<uint32_t> avoidance_layers;
+	LocalVector<uint32_t> avoidance_mask;
+
+	LocalVector<float> new_velocity_x;
+	LocalVector<float> new_velocity_y;
+
+	LocalVector<Scratch> scratches;
+	SafeNumeric<uint32_t> next_chunk;
+
+	float grid_cell_size = 1.0f;
+	float grid_origin_x = 0.0f;
+	float grid_origin_y = 0.0f;
+	int32_t grid_width = 0;
+	int32_t grid_height = 0;
+	/// The cells only exist in the hash, so memory follows the agent count and not the crowd bounds.
+	uint32_t grid_bucket_mask = 0;
+	/// Agent indices sorted by hash bucket, the agents of bucket `i` are in `[grid_bucket_start[i], grid_bucket_start[i + 1])`.
+	/// A bucket can hold agents of several cells, the search checks the cell of every agent it visits.
+	LocalVector<uint32_t> grid_bucket_start;
+	LocalVector<uint32_t> grid_agents;
+	LocalVector<int32_t> agent_cell_x;
+	LocalVector<int32_t> agent_cell_y;
+
+	_FORCE_INLINE_ uint32_t _get_cell_bucket(int32_t p_cell_x, int32_t p_cell_y) const {
+		return ((uint32_t(p_cell_x) * 73856093u) ^ (uint32_t(p_cell_y) * 19349663u)) & grid_bucket_mask;
+	}
+
+	void _pack_agents(const LocalVector<NavAgent3D *> &p_agents);
+	void _build_grid();
+	void _solve_agents(uint32_t p_worker_index, NavAgent3D **p_agents);
+	void _compute_agent_neighbors(uint32_t p_agent_index, Scratch &r_scratch) const;
+	void _compute_obstacle_lines(RVO2D::Agent2D *p_rvo_agent, Scratch &r_scratch) const;
+	void _compute_agent_lines(uint32_t p_agent_index, Scratch &r_scratch) const;
+
+public:
+	void step(const LocalVector<NavAgent3D *> &p_agents, RVO2D::RVOSimulator2D &p_rvo_simulation, float p_time_step, bool p_use_threads, bool p_use_high_priority_threads);
+};
@@ -80,6 +80,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_cluster_graph(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -402,6 +404,216 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_cluster_graph(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+	NavMapClusterGraph3D &graph = map_iteration->cluster_graph;
+
+	graph.clear();
+
+	if (!r_build.use_hierarchical_pathfinding) {
+		return;
+	}
+
+	const HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+
+	// Every region and link is a cluster.
+	graph.clusters.reserve(map_iteration->region_iterations.size() + map_iteration->link_iterations.size());
+	graph.owner_to_cluster.reserve(map_iteration->region_iterations.size() + map_iteration->link_iterations.size());
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		graph.owner_to_cluster[region.ptr()] = graph.clusters.size();
+		NavMapClusterGraph3D::Cluster cluster;
+		cluster.owner = region.ptr();
+		graph.clusters.push_back(cluster);
+	}
+	for (const Ref<NavLinkIteration3D> &link : map_iteration->link_iterations) {
+		graph.owner_to_cluster[link.ptr()] = graph.clusters.size();
+		NavMapClusterGraph3D::Cluster cluster;
+		cluster.owner = link.ptr();
+		graph.clusters.push_back(cluster);
+	}
+
+	// Merge all the external connections between the same two clusters into a single portal.
+	// The polygons on both sides of the portal are kept to link the portals across their clusters.
+	LocalVector<LocalVector<uint32_t>> portals_exit_polygons;
+	LocalVector<LocalVector<uint32_t>> portals_entry_polygons;
+	LocalVector<uint32_t> portals_connection_count;
+	HashMap<uint32_t, uint32_t> to_cluster_to_portal;
+
+	for (uint32_t cluster_index = 0; cluster_index < graph.clusters.size(); cluster_index++) {
+		NavMapClusterGraph3D::Cluster &cluster = graph.clusters[cluster_index];
+		cluster.portals_begin = graph.portals.size();
+		cluster.portals_end = graph.portals.size();
+
+		const LocalVector<LocalVector<Nav3D::Connection>> *polygons_connections = navbases_polygons_external_connections.getptr(cluster.owner);
+		if (!polygons_connections) {
+			continue;
+		}
+
+		to_cluster_to_portal.clear();
+		for (uint32_t polygon_index = 0; polygon_index < polygons_connections->size(); polygon_index++) {
+			for (const Connection &connection : (*polygons_connections)[polygon_index]) {
+				const uint32_t *to_cluster = graph.owner_to_cluster.getptr(connection.polygon->owner);
+				if (!to_cluster || *to_cluster == cluster_index) {
+					continue;
+				}
+
+				uint32_t *portal_index = to_cluster_to_portal.getptr(*to_cluster);
+				if (!portal_index) {
+					NavMapClusterGraph3D::Portal portal;
+					portal.from_cluster = cluster_index;
+					portal.to_cluster = *to_cluster;
+					portal_index = &to_cluster_to_portal.insert(*to_cluster, graph.portals.size())->value;
+					graph.portals.push_back(portal);
+					portals_exit_polygons.push_back(LocalVector<uint32_t>());
+					portals_entry_polygons.push_back(LocalVector<uint32_t>());
+					portals_connection_count.push_back(0);
+				}
+
+				graph.portals[*portal_index].position += (connection.pathway_start + connection.pathway_end) * 0.5;
+				portals_connection_count[*portal_index] += 1;
+				portals_exit_polygons[*portal_index].push_back(polygon_index);
+				portals_entry_polygons[*portal_index].push_back(connection.polygon->id);
+			}
+		}
+		cluster.portals_end = graph.portals.size();
+	}
+
+	if (graph.portals.is_empty()) {
+		return;
+	}
+
+	LocalVector<LocalVector<uint32_t>> clusters_entry_portals;
+	clusters_entry_portals.resize(graph.clusters.size());
+	for (uint32_t portal_index = 0; portal_index < graph.portals.size(); portal_index++) {
+		graph.portals[portal_index].position /= portals_connection_count[portal_index];
+		clusters_entry_portals[graph.portals[portal_index].to_cluster].push_back(portal_index);
+	}
+
+	// Link every portal entering a cluster to the portals leaving it.
+	// For regions the travel costs are measured with a Dijkstra search over the region polygons started from each leaving portal.
+	LocalVector<LocalVector<NavMapClusterGraph3D::Edge>> portals_edges;
+	portals_edges.resize(graph.portals.size());
+
+	LocalVector<Vector3> polygon_centers;
+	LocalVector<real_t> polygon_costs;
+	Heap<ClusterSearchEntry, ClusterSearchEntryGreaterThan> polygon_heap;
+
+	for (uint32_t cluster_index = 0; cluster_index < graph.clusters.size(); cluster_index++) {
+		const NavMapClusterGraph3D::Cluster &cluster = graph.clusters[cluster_index];
+		const LocalVector<uint32_t> &entry_portals = clusters_entry_portals[cluster_index];
+		if (entry_portals.is_empty() || cluster.portals_begin == cluster.portals_end) {
+			continue;
+		}
+
+		const NavBaseIteration3D *owner = cluster.owner;
+		const real_t travel_cost = owner->get_travel_cost();
+
+		if (owner->get_type() == NavigationUtilities::PathSegmentType::PATH_SEGMENT_TYPE_LINK) {
+			for (uint32_t exit_portal_index = cluster.portals_begin; exit_portal_index < cluster.portals_end; exit_portal_index++) {
+				const NavMapClusterGraph3D::Portal &exit_portal = graph.portals[exit_portal_index];
+				const real_t enter_cost = graph.clusters[exit_portal.to_cluster].owner->get_enter_cost();
+				for (uint32_t entry_portal_index : entry_portals) {
+					const NavMapClusterGraph3D::Portal &entry_portal = graph.portals[entry_portal_index];
+					if (entry_portal.from_cluster == exit_portal.to_cluster) {
+						continue;
+					}
+					NavMapClusterGraph3D::Edge edge;
+					edge.portal = exit_portal_index;
+					edge.cost = entry_portal.position.distance_to(exit_portal.position) * travel_cost + enter_cost;
+					portals_edges[entry_portal_index].push_back(edge);
+				}
+			}
+			continue;
+		}
+
+		const LocalVector<Polygon> &polygons = owner->get_navmesh_polygons();
+		const LocalVector<LocalVector<Connection>> &internal_connections = owner->get_internal_connections();
+
+		polygon_centers.resize(polygons.size());
+		for (uint32_t polygon_index = 0; polygon_index < polygons.size(); polygon_index++) {
+			Vector3 center;
+			for (const Vector3 &vertex : polygons[polygon_index].vertices) {
+				center += vertex;
+			}
+			if (polygons[polygon_index].vertices.size() > 0) {
+				center /= polygons[polygon_index].vertices.size();
+			}
+			polygon_centers[polygon_index] = center;
+		}
+		polygon_costs.resize(polygons.size());
+
+		for (uint32_t exit_portal_index = cluster.portals_begin; exit_portal_index < cluster.portals_end; exit_portal_index++) {
+			const NavMapClusterGraph3D::Portal &exit_portal = graph.portals[exit_portal_index];
+
+			for (real_t &cost : polygon_costs) {
+				cost = FLT_MAX;
+			}
+			polygon_heap.clear();
+
+			for (uint32_t polygon_index : portals_exit_polygons[exit_portal_index]) {
+				const real_t cost = polygon_centers[polygon_index].distance_to(exit_portal.position) * travel_cost;
+				if (cost < polygon_costs[polygon_index]) {
+					polygon_costs[polygon_index] = cost;
+					polygon_heap.push({ cost, cost, polygon_index });
+				}
+			}
+
+			while (!polygon_heap.is_empty()) {
+				const ClusterSearchEntry entry = polygon_heap.pop();
+				if (entry.traveled > polygon_costs[entry.index]) {
+					// Outdated entry, the polygon was reached with a lower cost in the meantime.
+					continue;
+				}
+				if (internal_connections.size() <= entry.index) {
+					continue;
+				}
+				for (const Connection &connection : internal_connections[entry.index]) {
+					const uint32_t neighbor_index = connection.polygon->id;
+					const real_t cost = entry.traveled + polygon_centers[entry.index].distance_to(polygon_centers[neighbor_index]) * travel_cost;
+					if (cost < polygon_costs[neighbor_index]) {
+						polygon_costs[neighbor_index] = cost;
+						polygon_heap.push({ cost, cost, neighbor_index });
+					}
+				}
+			}
+
+			const real_t enter_cost = graph.clusters[exit_portal.to_cluster].owner->get_enter_cost();
+			for (uint32_t entry_portal_index : entry_portals) {
+				const NavMapClusterGraph3D::Portal &entry_portal = graph.portals[entry_portal_index];
+				if (entry_portal.from_cluster == exit_portal.to_cluster) {
+					continue;
+				}
+
+				real_t best_cost = FLT_MAX;
+				for (uint32_t polygon_index : portals_entry_polygons[entry_portal_index]) {
+					if (polygon_costs[polygon_index] == FLT_MAX) {
+						continue;
+					}
+					best_cost = MIN(best_cost, polygon_costs[polygon_index] + entry_portal.position.distance_to(polygon_centers[polygon_index]) * travel_cost);
+				}
+				if (best_cost == FLT_MAX) {
+					// The portals are not connected inside this region.
+					continue;
+				}
+
+				NavMapClusterGraph3D::Edge edge;
+				edge.portal = exit_portal_index;
+				edge.cost = best_cost + enter_cost;
+				portals_edges[entry_portal_index].push_back(edge);
+			}
+		}
+	}
+
+	for (uint32_t portal_index = 0; portal_index < graph.portals.size(); portal_index++) {
+		NavMapClusterGraph3D::Portal &portal = graph.portals[portal_index];
+		portal.edges_begin = graph.edges.size();
+		for (const NavMapClusterGraph3D::Edge &edge : portals_edges[portal_index]) {
+			graph.edges.push_back(edge);
+		}
+		portal.edges_end = graph.edges.size();
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -435,6 +647,21 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		}
 
 		DEV_ASSERT(p_path_query_slot.path_corridor.size() == p_path_query_slot.poly_to_id.size());
+
+		// Queries only reset the polygons they touched, so start from a clean corridor.
+		for (NavigationPoly &navigation_poly : p_path_query_slot.path_corridor) {
+			navigation_poly.reset();
+		}
+		p_path_query_slot.touched_polys.clear();
+		p_path_query_slot.touched_polys.reserve(navmesh_polygon_count * 0.25);
+
+		const NavMapClusterGraph3D &cluster_graph = map_iteration->cluster_graph;
+		p_path_query_slot.portal_costs.resize(cluster_graph.portals.size());
+		p_path_query_slot.portal_back.resize(cluster_graph.portals.size());
+		p_path_query_slot.portal_heap.clear();
+		p_path_query_slot.portal_heap.reserve(cluster_graph.portals.size());
+		p_path_query_slot.cluster_usable.resize(cluster_graph.clusters.size());
+		p_path_query_slot.cluster_corridor.resize(cluster_graph.clusters.size());
 	}
 
 	map_iteration->path_query_slots_mutex.unlock();
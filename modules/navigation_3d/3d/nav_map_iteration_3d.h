@@ -50,9 +50,125 @@ class NavRegion3D;
 class NavRegionIteration3D;
 struct NavMapIteration3D;
 
+/// Abstract graph used by hierarchical pathfinding to search long paths.
+/// Every region and link of the map is a cluster, and all the connections leading from one cluster to another
+/// are merged into a single portal. Each portal is linked to the portals leaving the cluster it leads into,
+/// with the travel cost between the two precomputed across the polygons of that cluster.
+struct NavMapClusterGraph3D {
+	struct Cluster {
+		const NavBaseIteration3D *owner = nullptr;
+		/// Range of `portals` leaving this cluster.
+		uint32_t portals_begin = 0;
+		uint32_t portals_end = 0;
+	};
+
+	struct Portal {
+		uint32_t from_cluster = 0;
+		uint32_t to_cluster = 0;
+		/// Average of the middle of the connections merged into this portal.
+		Vector3 position;
+		/// Range of `edges` leading to the portals leaving `to_cluster`.
+		uint32_t edges_begin = 0;
+		uint32_t edges_end = 0;
+	};
+
+	struct Edge {
+		uint32_t portal = 0;
+		/// Travel cost from the portal to the next one, including the enter cost of the cluster behind it.
+		real_t cost = 0.0;
+	};
+
+	LocalVector<Cluster> clusters;
+	LocalVector<Portal> portals;
+	LocalVector<Edge> edges;
+	HashMap<const NavBaseIteration3D *, uint32_t> owner_to_cluster;
+
+	bool is_empty() const { return portals.is_empty(); }
+
+	/// Bytes allocated by the graph, with `owner_to_cluster` counted as its table plus one element per entry.
+	uint64_t get_memory_usage() const {
+		return uint64_t(clusters.get_capacity()) * sizeof(Cluster) + uint64_t(portals.get_capacity()) * sizeof(Portal) + uint64_t(edges.get_capacity()) * sizeof(Edge) +
+				uint64_t(owner_to_cluster.get_capacity()) * (sizeof(HashMapElement<const NavBaseIteration3D *, uint32_t> *) + sizeof(uint32_t)) +
+				uint64_t(owner_to_cluster.size()) * sizeof(HashMapElement<const NavBaseIteration3D *, uint32_t>);
+	}
+
+	void clear() {
+		clusters.clear();
+		portals.clear();
+		edges.clear();
+		owner_to_cluster.clear();
+	}
+};
+
+/// Dijkstra map over all polygons of a map iteration toward a target polygon.
+/// It is computed once and shared by all the agents moving toward that polygon.
+class NavMapFlowField3D : public RefCounted {
+	GDCLASS(NavMapFlowField3D, RefCounted);
+
+public:
+	struct PolygonFlow {
+		/// Id of the next polygon toward the target, `UINT32_MAX` for the target polygon and unreachable polygons.
+		uint32_t next = UINT32_MAX;
+		/// Pathway leading into the next polygon.
+		Vector3 pathway_start;
+		Vector3 pathway_end;
+		real_t cost = FLT_MAX;
+	};
+
+	uint32_t target_polygon = UINT32_MAX;
+	LocalVector<PolygonFlow> polygon_flows;
+};
+
+/// Flow fields of a map iteration, cached per target polygon and navigation layers until the iteration is rebuilt.
+struct NavMapFlowFieldCache3D {
+	struct Key {
+		uint32_t target_polygon = UINT32_MAX;
+		uint32_t navigation_layers = 0;
+
+		static uint32_t hash(const Key &p_key) {
+			return hash_murmur3_one_32(p_key.navigation_layers, hash_murmur3_one_32(p_key.target_polygon));
+		}
+
+		bool operator==(const Key &p_key) const {
+			return target_polygon == p_key.target_polygon && navigation_layers == p_key.navigation_layers;
+		}
+	};
+
+	struct IncomingConnection {
+		uint32_t polygon = UINT32_MAX;
+		Vector3 pathway_start;
+		Vector3 pathway_end;
+	};
+
+	static constexpr uint32_t MAX_FLOW_FIELDS = 32;
+
+	/// Held while indexing the polygons, which happens once per map iteration.
+	Mutex index_mutex;
+	/// The polygon ids and reversed connections are only indexed once the first flow field is requested.
+	/// Set with release semantics once they are complete, so samples only need to check it.
+	SafeFlag polygons_indexed;
+	LocalVector<const Nav3D::Polygon *> polygons;
+	LocalVector<Vector3> polygon_centers;
+	AHashMap<const Nav3D::Polygon *, uint32_t> polygon_to_id;
+	LocalVector<LocalVector<IncomingConnection>> incoming_connections;
+	/// Oldest flow fields first. Looked up by every sample, so most accesses only need to read.
+	HashMap<Key, Ref<NavMapFlowField3D>, Key> flow_fields;
+	RWLock flow_fields_rwlock;
+
+	void clear() {
+		polygons_indexed.clear();
+		polygons.clear();
+		polygon_centers.clear();
+		polygon_to_id.clear();
+		incoming_connections.clear();
+		flow_fields.clear();
+	}
+};
+
 struct NavMapIterationBuild3D {
 	Vector3 merge_rasterizer_cell_size;
 	bool use_edge_connections = true;
+	bool use_hierarchical_pathfinding = false;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
 	Nav3D::PerformanceData performance_data;
@@ -83,6 +199,7 @@ struct NavMapIteration3D {
 	RWLock rwlock;
 
 	Vector3 map_up;
+	uint32_t iteration_id = 0;
 
 	LocalVector<Ref<NavRegionIteration3D>> region_iterations;
 	LocalVector<Ref<NavLinkIteration3D>> link_iterations;
@@ -97,6 +214,11 @@ struct NavMapIteration3D {
 
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
+	/// Only built when the map uses hierarchical pathfinding.
+	NavMapClusterGraph3D cluster_graph;
+
+	mutable NavMapFlowFieldCache3D flow_field_cache;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
@@ -111,6 +233,8 @@ struct NavMapIteration3D {
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
 		region_ptr_to_region_iteration.clear();
+		cluster_graph.clear();
+		flow_field_cache.clear();
 	}
 };
 
@@ -56,6 +56,8 @@ bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashMap<Ref<NavigationMesh>, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshTileCache3D *> NavMeshGenerator3D::tile_caches;
 
 static const char *_navmesh_bake_state_msgs[(size_t)NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_MAX] = {
 	"",
@@ -94,6 +96,8 @@ NavMeshGenerator3D::~NavMeshGenerator3D() {
 }
 
 void NavMeshGenerator3D::sync() {
+	_prune_tile_caches();
+
 	if (generator_tasks.is_empty()) {
 		return;
 	}
@@ -127,6 +131,42 @@ void NavMeshGenerator3D::sync() {
 	}
 }
 
+void NavMeshGenerator3D::_prune_tile_caches() {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	if (tile_caches.is_empty()) {
+		return;
+	}
+
+	// A navigation mesh that is still baking is referenced by its task, so only the caches of freed meshes are pruned.
+	LocalVector<ObjectID> freed_navigation_meshes;
+	for (const KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+		if (!ObjectDB::get_instance(E.key)) {
+			freed_navigation_meshes.push_back(E.key);
+		}
+	}
+	for (const ObjectID &navigation_mesh_id : freed_navigation_meshes) {
+		memdelete(tile_caches[navigation_mesh_id]);
+		tile_caches.erase(navigation_mesh_id);
+	}
+}
+
+void NavMeshGenerator3D::_free_tile_cache(ObjectID p_navigation_mesh_id) {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh_id);
+	if (tile_cache_ptr) {
+		memdelete(*tile_cache_ptr);
+		tile_caches.erase(p_navigation_mesh_id);
+	}
+}
+
+uint32_t NavMeshGenerator3D::get_last_baked_tile_count(const Ref<NavigationMesh> &p_navigation_mesh) {
+	ERR_FAIL_COND_V(p_navigation_mesh.is_null(), 0);
+
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	NavMeshTileCache3D *const *tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+	return tile_cache_ptr ? (*tile_cache_ptr)->last_baked_tile_count : 0;
+}
+
 void NavMeshGenerator3D::cleanup() {
 	MutexLock baking_navmesh_lock(baking_navmesh_mutex);
 	{
@@ -141,6 +181,13 @@ void NavMeshGenerator3D::cleanup() {
 		}
 		generator_tasks.clear();
 
+		tile_cache_mutex.lock();
+		for (KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+			memdelete(E.value);
+		}
+		tile_caches.clear();
+		tile_cache_mutex.unlock();
+
 		generator_parsers_rwlock.write_lock();
 		generator_parsers.clear();
 		generator_parsers_rwlock.write_unlock();
@@ -330,12 +377,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		generator_bake_tiled(p_generator_task, source_geometry_vertices, source_geometry_indices, projected_obstructions);
+		return;
+	}
+	_free_tile_cache(p_navigation_mesh->get_instance_id());
 
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
 
@@ -348,52 +394,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 	rcCalcBounds(verts, nverts, bmin, bmax);
 
 	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
-
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
-	if (p_navigation_mesh->get_border_size() > 0.0) {
-		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
-	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
-
-	if (p_navigation_mesh->get_border_size() > 0.0 && !Math::is_zero_approx(Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()))) {
-		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
-		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
-		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
-		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
-		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
-		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
-		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
-		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
-	}
-	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
-		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
-	}
+	generator_configure(p_navigation_mesh, cfg);
 
 	cfg.bmin[0] = bmin[0];
 	cfg.bmin[1] = bmin[1];
@@ -427,48 +428,117 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+
+	if (!generator_bake_recast_mesh(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, p_generator_task->bake_state, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+}
+
+void NavMeshGenerator3D::generator_configure(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg) {
+	memset(&r_cfg, 0, sizeof(r_cfg));
+
+	r_cfg.cs = p_navigation_mesh->get_cell_size();
+	r_cfg.ch = p_navigation_mesh->get_cell_height();
+	if (p_navigation_mesh->get_border_size() > 0.0) {
+		r_cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / r_cfg.cs);
+	}
+	r_cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	r_cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+
+	if (p_navigation_mesh->get_border_size() > 0.0 && !Math::is_zero_approx(Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()))) {
+		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableHeight * r_cfg.ch, p_navigation_mesh->get_agent_height())) {
+		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableClimb * r_cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableRadius * r_cfg.cs, p_navigation_mesh->get_agent_radius())) {
+		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.maxEdgeLen * r_cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
+	}
+	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
+		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
+	}
+}
+
+bool NavMeshGenerator3D::generator_bake_recast_mesh(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState &r_bake_state, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
+
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
+	r_bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -483,13 +553,13 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
+	r_bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -504,43 +574,40 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
+	r_bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
 	rcFreeContourSet(cset);
 	cset = nullptr;
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
-
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
 
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
@@ -554,7 +621,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -578,19 +645,455 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+	r_bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
 
 	rcFreePolyMesh(poly_mesh);
 	poly_mesh = nullptr;
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
+	return true;
+}
+
+struct NavMeshGenerator3D::NavMeshTileBakeJob3D {
+	struct Tile {
+		rcConfig cfg;
+		LocalVector<int> tris;
+		Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+		NavMeshTile3D *result = nullptr;
+	};
+
+	Ref<NavigationMesh> navigation_mesh;
+	const float *verts = nullptr;
+	int nverts = 0;
+	LocalVector<Tile> dirty_tiles;
+};
+
+void NavMeshGenerator3D::generator_bake_tile(void *p_userdata, uint32_t p_index) {
+	NavMeshTileBakeJob3D *job = static_cast<NavMeshTileBakeJob3D *>(p_userdata);
+	NavMeshTileBakeJob3D::Tile &tile = job->dirty_tiles[p_index];
+
+	tile.result->vertices.clear();
+	tile.result->polygons.clear();
+
+	if (tile.tris.is_empty()) {
+		tile.result->baked = true;
+		return;
+	}
+
+	// Tiles are baked in parallel, so they do not report their progress to the generator task.
+	NavMeshBakeState bake_state = NavMeshBakeState::BAKE_STATE_NONE;
+	tile.result->baked = generator_bake_recast_mesh(job->navigation_mesh, tile.cfg, job->verts, job->nverts, tile.tris.ptr(), tile.tris.size() / 3, tile.projected_obstructions, bake_state, tile.result->vertices, tile.result->polygons);
+	if (!tile.result->baked) {
+		tile.result->vertices.clear();
+		tile.result->polygons.clear();
+	}
+}
+
+void NavMeshGenerator3D::generator_bake_tiled(NavMeshGeneratorTask3D *p_generator_task, const Vector<float> &p_vertices, const Vector<int> &p_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions) {
+	Ref<NavigationMesh> p_navigation_mesh = p_generator_task->navigation_mesh;
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
+
+	const float *verts = p_vertices.ptr();
+	const int nverts = p_vertices.size() / 3;
+	const int *tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	rcConfig cfg;
+	generator_configure(p_navigation_mesh, cfg);
+
+	// The border keeps the erosion by the agent radius from shrinking the tile edges, so that neighboring tiles line up.
+	cfg.borderSize = MAX(cfg.borderSize, cfg.walkableRadius + 3);
+	cfg.tileSize = MAX(1, (int)Math::ceil(p_navigation_mesh->get_tile_size() / cfg.cs));
+	cfg.width = cfg.tileSize + cfg.borderSize * 2;
+	cfg.height = cfg.tileSize + cfg.borderSize * 2;
+
+	const float tile_world_size = cfg.tileSize * cfg.cs;
+	const float border_world_size = cfg.borderSize * cfg.cs;
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(verts, nverts, bmin, bmax);
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	const bool use_baking_aabb = baking_aabb.has_volume();
+	if (use_baking_aabb) {
+		baking_aabb.position += p_navigation_mesh->get_filter_baking_aabb_offset();
+		for (int i = 0; i < 3; i++) {
+			bmin[i] = baking_aabb.position[i];
+			bmax[i] = baking_aabb.position[i] + baking_aabb.size[i];
+		}
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
+
+	// Only a single tile is rasterized at a time, so the crash prevention check applies to the tile size.
+	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nNavigationMesh baking process would likely crash the engine."
+					 "\nTile Size is suspiciously big for the current Cell Size in the NavMesh Resource bake settings."
+					 "\nIt is advised to decrease Tile Size or increase Cell Size in the NavMesh Resource bake settings."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+		return;
+	}
+
+	// Tiles are aligned to the world origin so that their keys stay valid when the source geometry bounds change.
+	const Vector2i tile_min((int)Math::floor(bmin[0] / tile_world_size), (int)Math::floor(bmin[2] / tile_world_size));
+	const Vector2i tile_max((int)Math::floor(bmax[0] / tile_world_size), (int)Math::floor(bmax[2] / tile_world_size));
+	const Vector2i tile_count = tile_max - tile_min + Vector2i(1, 1);
+
+	LocalVector<LocalVector<int>> tile_triangles;
+	tile_triangles.resize(tile_count.x * tile_count.y);
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &verts[tris[i * 3 + 0] * 3];
+		const float *v1 = &verts[tris[i * 3 + 1] * 3];
+		const float *v2 = &verts[tris[i * 3 + 2] * 3];
+		const int from_x = MAX((int)Math::floor((MIN(v0[0], MIN(v1[0], v2[0])) - border_world_size) / tile_world_size), tile_min.x);
+		const int to_x = MIN((int)Math::floor((MAX(v0[0], MAX(v1[0], v2[0])) + border_world_size) / tile_world_size), tile_max.x);
+		const int from_z = MAX((int)Math::floor((MIN(v0[2], MIN(v1[2], v2[2])) - border_world_size) / tile_world_size), tile_min.y);
+		const int to_z = MIN((int)Math::floor((MAX(v0[2], MAX(v1[2], v2[2])) + border_world_size) / tile_world_size), tile_max.y);
+		for (int z = from_z; z <= to_z; z++) {
+			for (int x = from_x; x <= to_x; x++) {
+				tile_triangles[(z - tile_min.y) * tile_count.x + (x - tile_min.x)].push_back(i);
+			}
+		}
+	}
+
+	uint32_t settings_hash = hash_murmur3_one_32(cfg.tileSize);
+	settings_hash = hash_murmur3_one_32(cfg.borderSize, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.walkableHeight, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.walkableClimb, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.walkableRadius, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.maxEdgeLen, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.minRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.mergeRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.maxVertsPerPoly, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.cs, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.ch, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.walkableSlopeAngle, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.maxSimplificationError, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.detailSampleDist, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.detailSampleMaxError, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+	if (use_baking_aabb) {
+		settings_hash = hash_murmur3_one_float(bmin[1], settings_hash);
+		settings_hash = hash_murmur3_one_float(bmax[1], settings_hash);
+	}
+	settings_hash = hash_fmix32(settings_hash);
+
+	NavMeshTileCache3D *tile_cache = nullptr;
+	{
+		MutexLock tile_cache_lock(tile_cache_mutex);
+
+		NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+		if (tile_cache_ptr) {
+			tile_cache = *tile_cache_ptr;
+		} else {
+			tile_cache = memnew(NavMeshTileCache3D);
+			tile_caches.insert(p_navigation_mesh->get_instance_id(), tile_cache);
+		}
+	}
+
+	if (tile_cache->settings_hash != settings_hash) {
+		tile_cache->tiles.clear();
+		tile_cache->settings_hash = settings_hash;
+	}
+
+	LocalVector<Vector2i> outside_tiles;
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : tile_cache->tiles) {
+		if (E.key.x < tile_min.x || E.key.y < tile_min.y || E.key.x > tile_max.x || E.key.y > tile_max.y) {
+			outside_tiles.push_back(E.key);
+		}
+	}
+	for (const Vector2i &tile_coords : outside_tiles) {
+		tile_cache->tiles.erase(tile_coords);
+	}
+
+	// The obstructions are checked against every tile, so their bounds and hashes are only computed once.
+	struct ObstructionBounds {
+		float min_x = FLT_MAX;
+		float min_z = FLT_MAX;
+		float max_x = -FLT_MAX;
+		float max_z = -FLT_MAX;
+		uint32_t hash_a = 0;
+		uint32_t hash_b = 0;
+	};
+	LocalVector<ObstructionBounds> obstruction_bounds;
+	obstruction_bounds.resize(p_projected_obstructions.size());
+	for (int obstruction_index = 0; obstruction_index < p_projected_obstructions.size(); obstruction_index++) {
+		const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction = p_projected_obstructions[obstruction_index];
+		ObstructionBounds &bounds = obstruction_bounds[obstruction_index];
+		if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+			continue;
+		}
+		const float *obstruction_verts = projected_obstruction.vertices.ptr();
+		bounds.hash_a = hash_murmur3_one_32(projected_obstruction.vertices.size(), TILE_HASH_SEED_A);
+		bounds.hash_b = hash_murmur3_one_32(projected_obstruction.vertices.size(), TILE_HASH_SEED_B);
+		for (int i = 0; i < projected_obstruction.vertices.size(); i += 3) {
+			bounds.min_x = MIN(bounds.min_x, obstruction_verts[i]);
+			bounds.max_x = MAX(bounds.max_x, obstruction_verts[i]);
+			bounds.min_z = MIN(bounds.min_z, obstruction_verts[i + 2]);
+			bounds.max_z = MAX(bounds.max_z, obstruction_verts[i + 2]);
+		}
+		for (int i = 0; i < projected_obstruction.vertices.size(); i++) {
+			bounds.hash_a = hash_murmur3_one_float(obstruction_verts[i], bounds.hash_a);
+			bounds.hash_b = hash_murmur3_one_float(obstruction_verts[i], bounds.hash_b);
+		}
+		bounds.hash_a = hash_murmur3_one_float(projected_obstruction.elevation, bounds.hash_a);
+		bounds.hash_b = hash_murmur3_one_float(projected_obstruction.elevation, bounds.hash_b);
+		bounds.hash_a = hash_murmur3_one_float(projected_obstruction.height, bounds.hash_a);
+		bounds.hash_b = hash_murmur3_one_float(projected_obstruction.height, bounds.hash_b);
+		bounds.hash_a = hash_murmur3_one_32(projected_obstruction.carve, bounds.hash_a);
+		bounds.hash_b = hash_murmur3_one_32(projected_obstruction.carve, bounds.hash_b);
+	}
+
+	NavMeshTileBakeJob3D job;
+	job.navigation_mesh = p_navigation_mesh;
+	job.verts = verts;
+	job.nverts = nverts;
+
+	for (int z = tile_min.y; z <= tile_max.y; z++) {
+		for (int x = tile_min.x; x <= tile_max.x; x++) {
+			const LocalVector<int> &triangles = tile_triangles[(z - tile_min.y) * tile_count.x + (x - tile_min.x)];
+
+			float tile_bmin[3], tile_bmax[3];
+			tile_bmin[0] = x * tile_world_size - border_world_size;
+			tile_bmin[2] = z * tile_world_size - border_world_size;
+			tile_bmax[0] = (x + 1) * tile_world_size + border_world_size;
+			tile_bmax[2] = (z + 1) * tile_world_size + border_world_size;
+
+			if (use_baking_aabb) {
+				tile_bmin[1] = bmin[1];
+				tile_bmax[1] = bmax[1];
+			} else {
+				// Snap the bottom to the cell height so that all tiles sample heights on the same grid.
+				float min_y = FLT_MAX;
+				float max_y = -FLT_MAX;
+				for (int triangle : triangles) {
+					for (int i = 0; i < 3; i++) {
+						const float y = verts[tris[triangle * 3 + i] * 3 + 1];
+						min_y = MIN(min_y, y);
+						max_y = MAX(max_y, y);
+					}
+				}
+				tile_bmin[1] = triangles.is_empty() ? 0.0f : Math::floor(min_y / cfg.ch) * cfg.ch;
+				tile_bmax[1] = triangles.is_empty() ? 0.0f : max_y;
+			}
+
+			// Two 32-bit hashes with different seeds, so that a changed tile is practically never mistaken for an unchanged one.
+			uint32_t tile_hash_a = hash_murmur3_one_32(triangles.size(), hash_murmur3_one_32(settings_hash, TILE_HASH_SEED_A));
+			uint32_t tile_hash_b = hash_murmur3_one_32(triangles.size(), hash_murmur3_one_32(settings_hash, TILE_HASH_SEED_B));
+			for (int triangle : triangles) {
+				for (int i = 0; i < 3; i++) {
+					const float *v = &verts[tris[triangle * 3 + i] * 3];
+					for (int axis = 0; axis < 3; axis++) {
+						tile_hash_a = hash_murmur3_one_float(v[axis], tile_hash_a);
+						tile_hash_b = hash_murmur3_one_float(v[axis], tile_hash_b);
+					}
+				}
+			}
+
+			Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> tile_projected_obstructions;
+			for (int obstruction_index = 0; obstruction_index < p_projected_obstructions.size(); obstruction_index++) {
+				const ObstructionBounds &bounds = obstruction_bounds[obstruction_index];
+				if (bounds.max_x < tile_bmin[0] || bounds.min_x > tile_bmax[0] || bounds.max_z < tile_bmin[2] || bounds.min_z > tile_bmax[2]) {
+					continue;
+				}
+
+				tile_projected_obstructions.push_back(p_projected_obstructions[obstruction_index]);
+				tile_hash_a = hash_murmur3_one_32(bounds.hash_a, tile_hash_a);
+				tile_hash_b = hash_murmur3_one_32(bounds.hash_b, tile_hash_b);
+			}
+			const uint64_t tile_hash = (uint64_t(hash_fmix32(tile_hash_a)) << 32) | hash_fmix32(tile_hash_b);
+
+			const Vector2i tile_coords(x, z);
+			NavMeshTile3D *tile = tile_cache->tiles.getptr(tile_coords);
+			if (!tile) {
+				tile = &tile_cache->tiles.insert(tile_coords, NavMeshTile3D())->value;
+			}
+			if (tile->baked && tile->hash == tile_hash) {
+				continue;
+			}
+			tile->hash = tile_hash;
+			tile->baked = false;
+
+			NavMeshTileBakeJob3D::Tile dirty_tile;
+			dirty_tile.cfg = cfg;
+			for (int i = 0; i < 3; i++) {
+				dirty_tile.cfg.bmin[i] = tile_bmin[i];
+				dirty_tile.cfg.bmax[i] = tile_bmax[i];
+			}
+			dirty_tile.tris.resize(triangles.size() * 3);
+			for (uint32_t i = 0; i < triangles.size(); i++) {
+				dirty_tile.tris[i * 3 + 0] = tris[triangles[i] * 3 + 0];
+				dirty_tile.tris[i * 3 + 1] = tris[triangles[i] * 3 + 1];
+				dirty_tile.tris[i * 3 + 2] = tris[triangles[i] * 3 + 2];
+			}
+			dirty_tile.projected_obstructions = tile_projected_obstructions;
+			dirty_tile.result = tile;
+			job.dirty_tiles.push_back(dirty_tile);
+		}
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+
+	tile_cache_mutex.lock();
+	tile_cache->last_baked_tile_count = job.dirty_tiles.size();
+	tile_cache_mutex.unlock();
+	if (use_threads && job.dirty_tiles.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_bake_tile, &job, job.dirty_tiles.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < job.dirty_tiles.size(); i++) {
+			generator_bake_tile(&job, i);
+		}
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
+
+	// Weld the vertices that neighboring tiles share on their seams.
+	const float weld_xz = cfg.cs * 0.1f;
+	const float weld_y = cfg.ch * 0.1f;
+
+	Vector<Vector3> nav_vertices;
+	LocalVector<LocalVector<int>> tile_polygons;
+	HashMap<Vector3i, int> weld_key_to_native_index;
+
+	for (int z = tile_min.y; z <= tile_max.y; z++) {
+		for (int x = tile_min.x; x <= tile_max.x; x++) {
+			const NavMeshTile3D *tile = tile_cache->tiles.getptr(Vector2i(x, z));
+			if (!tile || tile->polygons.is_empty()) {
+				continue;
+			}
+
+			LocalVector<int> tile_index_to_native_index;
+			tile_index_to_native_index.resize(tile->vertices.size());
+			for (int i = 0; i < tile->vertices.size(); i++) {
+				const Vector3 &vertex = tile->vertices[i];
+				const Vector3i weld_key(Math::round(vertex.x / weld_xz), Math::round(vertex.y / weld_y), Math::round(vertex.z / weld_xz));
+				// Two vertices within the weld distance can round to neighboring keys, so look in those too.
+				int native_index = -1;
+				for (int offset = 0; offset < 27 && native_index == -1; offset++) {
+					// Start with the key of the vertex itself, at offset 13.
+					const int neighbor = (offset + 13) % 27;
+					const int *existing_index_ptr = weld_key_to_native_index.getptr(weld_key + Vector3i(neighbor % 3 - 1, (neighbor / 3) % 3 - 1, neighbor / 9 - 1));
+					if (!existing_index_ptr) {
+						continue;
+					}
+					const Vector3 &existing_vertex = nav_vertices[*existing_index_ptr];
+					if (Math::abs(existing_vertex.x - vertex.x) <= weld_xz && Math::abs(existing_vertex.y - vertex.y) <= weld_y && Math::abs(existing_vertex.z - vertex.z) <= weld_xz) {
+						native_index = *existing_index_ptr;
+					}
+				}
+				if (native_index == -1) {
+					native_index = nav_vertices.size();
+					weld_key_to_native_index.insert(weld_key, native_index);
+					nav_vertices.push_back(vertex);
+				}
+				tile_index_to_native_index[i] = native_index;
+			}
+
+			for (const Vector<int> &tile_polygon : tile->polygons) {
+				LocalVector<int> polygon;
+				for (int index : tile_polygon) {
+					const int native_index = tile_index_to_native_index[index];
+					if (polygon.is_empty() || polygon[polygon.size() - 1] != native_index) {
+						polygon.push_back(native_index);
+					}
+				}
+				if (polygon.size() > 1 && polygon[0] == polygon[polygon.size() - 1]) {
+					polygon.remove_at(polygon.size() - 1);
+				}
+				if (polygon.size() >= 3) {
+					tile_polygons.push_back(polygon);
+				}
+			}
+		}
+	}
+
+	// Each tile places the vertices on its edges on its own, so an edge on a seam can span several edges of the neighboring tile.
+	// Split those edges at the neighbor's vertices so that both sides of a seam share the same edges and get connected.
+	const float seam_margin = cfg.cs * 0.1f;
+	const float seam_height_margin = MAX(cfg.walkableClimb, 1) * cfg.ch;
+
+	auto get_seam = [&](const Vector3 &p_vertex, int p_axis, int &r_seam) -> bool {
+		const float coordinate = p_axis == 0 ? p_vertex.x : p_vertex.z;
+		const float seam = Math::round(coordinate / tile_world_size);
+		r_seam = (int)seam;
+		return Math::abs(coordinate - seam * tile_world_size) <= seam_margin;
+	};
+
+	HashMap<int, LocalVector<int>> seam_vertices[2];
+	for (int i = 0; i < nav_vertices.size(); i++) {
+		for (int axis = 0; axis < 2; axis++) {
+			int seam;
+			if (get_seam(nav_vertices[i], axis, seam)) {
+				seam_vertices[axis][seam].push_back(i);
+			}
+		}
+	}
+
+	Vector<Vector<int>> nav_polygons;
+	nav_polygons.resize(tile_polygons.size());
+	LocalVector<Pair<float, int>> edge_splits;
+
+	for (uint32_t polygon_index = 0; polygon_index < tile_polygons.size(); polygon_index++) {
+		const LocalVector<int> &polygon = tile_polygons[polygon_index];
+		Vector<int> &nav_polygon = nav_polygons.write[polygon_index];
+
+		for (uint32_t i = 0; i < polygon.size(); i++) {
+			const int index_a = polygon[i];
+			const int index_b = polygon[(i + 1) % polygon.size()];
+			nav_polygon.push_back(index_a);
+
+			const Vector3 &a = nav_vertices[index_a];
+			const Vector3 &b = nav_vertices[index_b];
+			for (int axis = 0; axis < 2; axis++) {
+				int seam_a;
+				int seam_b;
+				if (!get_seam(a, axis, seam_a) || !get_seam(b, axis, seam_b) || seam_a != seam_b) {
+					continue;
+				}
+
+				const float from = axis == 0 ? a.z : a.x;
+				const float length = (axis == 0 ? b.z : b.x) - from;
+				if (Math::abs(length) <= seam_margin) {
+					continue;
+				}
+
+				edge_splits.clear();
+				for (int index_c : seam_vertices[axis][seam_a]) {
+					if (index_c == index_a || index_c == index_b) {
+						continue;
+					}
+					const Vector3 &c = nav_vertices[index_c];
+					const float t = ((axis == 0 ? c.z : c.x) - from) / length;
+					if (t * Math::abs(length) <= seam_margin || (1.0f - t) * Math::abs(length) <= seam_margin) {
+						continue;
+					}
+					if (Math::abs(c.y - (a.y + (b.y - a.y) * t)) > seam_height_margin) {
+						continue;
+					}
+					edge_splits.push_back(Pair<float, int>(t, index_c));
+				}
+				edge_splits.sort();
+				for (const Pair<float, int> &edge_split : edge_splits) {
+					nav_polygon.push_back(edge_split.second);
+				}
+				break;
+			}
+		}
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
 }
 
@@ -46,6 +46,7 @@
 class Node;
 class NavigationMesh;
 class NavigationMeshSourceGeometryData3D;
+struct rcConfig;
 
 class NavMeshGenerator3D : public Object {
 	static NavMeshGenerator3D *singleton;
@@ -103,9 +104,38 @@ private:
 
 	static HashMap<Ref<NavigationMesh>, NavMeshGeneratorTask3D *> baking_navmeshes;
 
+	// Baked tiles of navigation meshes that use tiled baking, kept to skip tiles whose source geometry did not change.
+	struct NavMeshTile3D {
+		uint64_t hash = 0;
+		bool baked = false;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	struct NavMeshTileCache3D {
+		uint32_t settings_hash = 0;
+		uint32_t last_baked_tile_count = 0;
+		HashMap<Vector2i, NavMeshTile3D> tiles;
+	};
+
+	static constexpr uint32_t TILE_HASH_SEED_A = 0x7f4a7c15;
+	static constexpr uint32_t TILE_HASH_SEED_B = 0x1b873593;
+
+	struct NavMeshTileBakeJob3D;
+
+	static Mutex tile_cache_mutex;
+	static HashMap<ObjectID, NavMeshTileCache3D *> tile_caches;
+
+	static void _prune_tile_caches();
+	static void _free_tile_cache(ObjectID p_navigation_mesh_id);
+
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task);
+	static void generator_bake_tiled(NavMeshGeneratorTask3D *p_generator_task, const Vector<float> &p_vertices, const Vector<int> &p_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions);
+	static void generator_bake_tile(void *p_userdata, uint32_t p_index);
+	static void generator_configure(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg);
+	static bool generator_bake_recast_mesh(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState &r_bake_state, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
 
 	static bool generator_emit_callback(const Callable &p_callback);
 
@@ -123,6 +153,8 @@ public:
 	static void bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
 	static String get_baking_state_msg(Ref<NavigationMesh> p_navigation_mesh);
+	/// Number of tiles that the last tiled bake of the navigation mesh had to bake, the other tiles were reused.
+	static uint32_t get_last_baked_tile_count(const Ref<NavigationMesh> &p_navigation_mesh);
 
 	NavMeshGenerator3D();
 	~NavMeshGenerator3D();
@@ -154,18 +154,10 @@ void NavMeshQueries3D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
-void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
-	ERR_FAIL_NULL(map);
-	ERR_FAIL_COND(p_query_parameters.is_null());
-	ERR_FAIL_COND(p_query_result.is_null());
-
-	using namespace NavigationUtilities;
-
-	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
+void NavMeshQueries3D::_query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
+	p_query_task.start_position = p_query_parameters->get_start_position();
+	p_query_task.target_position = p_query_parameters->get_target_position();
+	p_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -173,56 +165,68 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	p_query_task.exclude_regions = _excluded_region_count > 0;
+	p_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
+	if (p_query_task.exclude_regions) {
+		p_query_task.excluded_regions.resize(_excluded_region_count);
 		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
+			p_query_task.excluded_regions[i] = _excluded_regions[i];
 		}
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
+	if (p_query_task.include_regions) {
+		p_query_task.included_regions.resize(_included_region_count);
 		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
+			p_query_task.included_regions[i] = _included_regions[i];
 		}
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
-	query_task.path_return_max_length = p_query_parameters->get_path_return_max_length();
-	query_task.path_return_max_radius = p_query_parameters->get_path_return_max_radius();
-	query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
-	query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
+	p_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	p_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	p_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	p_query_task.path_return_max_length = p_query_parameters->get_path_return_max_length();
+	p_query_task.path_return_max_radius = p_query_parameters->get_path_return_max_radius();
+	p_query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
+	p_query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
+}
+
+void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	using namespace NavigationUtilities;
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	_query_task_set_parameters(query_task, p_query_parameters);
+	query_task.callback = p_callback;
 	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
 
 	map->query_path(query_task);
@@ -243,6 +247,53 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	}
 }
 
+void NavMeshQueries3D::map_query_path_batch(NavMap3D *map, const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryBatchResult3D> p_query_result) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	const uint32_t query_count = p_query_parameters.size();
+
+	NavMeshPathQueryBatch3D batch;
+	batch.query_tasks.resize(query_count);
+	batch.path_ranges.resize(query_count);
+
+	for (uint32_t i = 0; i < query_count; i++) {
+		const Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		ERR_FAIL_COND_MSG(query_parameters.is_null(), vformat("Path query parameters at index %d are null.", i));
+		ERR_FAIL_COND_MSG(query_parameters->get_map() != map->get_self(), vformat("Path query at index %d does not use the same map as the other queries of the batch.", i));
+
+		NavMeshPathQueryTask3D &query_task = batch.query_tasks[i];
+		_query_task_set_parameters(query_task, query_parameters);
+		// The batch result only holds the path points.
+		query_task.metadata_flags = 0;
+		query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+	}
+
+	map->query_path_batch(batch);
+
+	uint32_t point_count = 0;
+	for (const NavMeshPathQueryBatch3D::PathRange &path_range : batch.path_ranges) {
+		point_count += path_range.count;
+	}
+
+	Vector3 *path_points = nullptr;
+	int32_t *path_offsets = nullptr;
+	float *path_lengths = nullptr;
+	p_query_result->resize(query_count, point_count, &path_points, &path_offsets, &path_lengths);
+
+	uint32_t point_index = 0;
+	for (uint32_t i = 0; i < query_count; i++) {
+		const NavMeshPathQueryBatch3D::PathRange &path_range = batch.path_ranges[i];
+		path_offsets[i] = point_index;
+		path_lengths[i] = path_range.length;
+		if (path_range.count > 0) {
+			memcpy(path_points + point_index, batch.workers[path_range.worker].path_points.ptr() + path_range.offset, path_range.count * sizeof(Vector3));
+			point_index += path_range.count;
+		}
+	}
+	path_offsets[query_count] = point_index;
+}
+
 void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
@@ -293,6 +344,13 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 		return;
 	}
 
+	if (p_query_task.cluster_corridor && connection_owner != p_least_cost_poly.poly->owner) {
+		const uint32_t *cluster_index = p_query_task.cluster_graph->owner_to_cluster.getptr(connection_owner);
+		if (cluster_index && !p_query_task.cluster_corridor[*cluster_index]) {
+			return;
+		}
+	}
+
 	Heap<NavigationPoly *, NavPolyTravelCostGreaterThan, NavPolyHeapIndexer>
 			&traversable_polys = p_query_task.path_query_slot->traversable_polys;
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
@@ -303,8 +361,13 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	real_t new_traveled_distance = p_least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + p_poly_enter_cost + p_least_cost_poly.traveled_distance;
 
 	// Check if the neighbor polygon has already been processed.
-	NavigationPoly &neighbor_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[p_connection.polygon]];
+	const uint32_t neighbor_poly_id = p_query_task.path_query_slot->poly_to_id[p_connection.polygon];
+	NavigationPoly &neighbor_poly = navigation_polys[neighbor_poly_id];
 	if (new_traveled_distance < neighbor_poly.traveled_distance) {
+		if (neighbor_poly.traveled_distance == FLT_MAX) {
+			p_query_task.path_query_slot->touched_polys.push_back(neighbor_poly_id);
+		}
+
 		// Add the polygon to the heap of polygons to traverse next.
 		neighbor_poly.back_navigation_poly_id = p_least_cost_id;
 		neighbor_poly.back_navigation_edge = p_connection.edge;
@@ -325,6 +388,104 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	}
 }
 
+void NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const NavMapClusterGraph3D &graph = p_map_iteration.cluster_graph;
+	PathQuerySlot *path_query_slot = p_query_task.path_query_slot;
+
+	p_query_task.cluster_graph = &graph;
+	p_query_task.cluster_corridor = nullptr;
+	p_query_task.cluster_corridor_failed = false;
+
+	const uint32_t *begin_cluster_ptr = graph.owner_to_cluster.getptr(p_query_task.begin_polygon->owner);
+	const uint32_t *end_cluster_ptr = graph.owner_to_cluster.getptr(p_query_task.end_polygon->owner);
+	if (!begin_cluster_ptr || !end_cluster_ptr || *begin_cluster_ptr == *end_cluster_ptr) {
+		// Nothing to gain over a regular search.
+		return;
+	}
+	const uint32_t begin_cluster = *begin_cluster_ptr;
+	const uint32_t end_cluster = *end_cluster_ptr;
+
+	LocalVector<real_t> &portal_costs = path_query_slot->portal_costs;
+	LocalVector<uint32_t> &portal_back = path_query_slot->portal_back;
+	LocalVector<uint8_t> &cluster_usable = path_query_slot->cluster_usable;
+	Heap<ClusterSearchEntry, ClusterSearchEntryGreaterThan> &portal_heap = path_query_slot->portal_heap;
+
+	for (real_t &cost : portal_costs) {
+		cost = FLT_MAX;
+	}
+	for (uint8_t &usable : cluster_usable) {
+		usable = 0;
+	}
+	portal_heap.clear();
+
+	auto is_cluster_usable = [&](uint32_t p_cluster) -> bool {
+		if (cluster_usable[p_cluster] == 0) {
+			cluster_usable[p_cluster] = _query_task_is_connection_owner_usable(p_query_task, graph.clusters[p_cluster].owner) ? 1 : 2;
+		}
+		return cluster_usable[p_cluster] == 1;
+	};
+
+	// This is an implementation of the A* algorithm over the portals between clusters.
+	const Vector3 &begin_position = p_query_task.begin_position;
+	const Vector3 &end_position = p_query_task.end_position;
+	const NavMapClusterGraph3D::Cluster &start = graph.clusters[begin_cluster];
+	for (uint32_t portal_index = start.portals_begin; portal_index < start.portals_end; portal_index++) {
+		const NavMapClusterGraph3D::Portal &portal = graph.portals[portal_index];
+		if (!is_cluster_usable(portal.to_cluster)) {
+			continue;
+		}
+		const real_t cost = begin_position.distance_to(portal.position) * start.owner->get_travel_cost() + graph.clusters[portal.to_cluster].owner->get_enter_cost();
+		portal_costs[portal_index] = cost;
+		portal_back[portal_index] = UINT32_MAX;
+		portal_heap.push({ cost + portal.position.distance_to(end_position), cost, portal_index });
+	}
+
+	uint32_t end_portal = UINT32_MAX;
+	while (!portal_heap.is_empty()) {
+		const ClusterSearchEntry entry = portal_heap.pop();
+		if (entry.traveled > portal_costs[entry.index]) {
+			// Outdated entry, the portal was reached with a lower cost in the meantime.
+			continue;
+		}
+
+		const NavMapClusterGraph3D::Portal &portal = graph.portals[entry.index];
+		if (portal.to_cluster == end_cluster) {
+			end_portal = entry.index;
+			break;
+		}
+
+		for (uint32_t edge_index = portal.edges_begin; edge_index < portal.edges_end; edge_index++) {
+			const NavMapClusterGraph3D::Edge &edge = graph.edges[edge_index];
+			const NavMapClusterGraph3D::Portal &next_portal = graph.portals[edge.portal];
+			if (!is_cluster_usable(next_portal.to_cluster)) {
+				continue;
+			}
+			const real_t cost = entry.traveled + edge.cost;
+			if (cost < portal_costs[edge.portal]) {
+				portal_costs[edge.portal] = cost;
+				portal_back[edge.portal] = entry.index;
+				portal_heap.push({ cost + next_portal.position.distance_to(end_position), cost, edge.portal });
+			}
+		}
+	}
+
+	if (end_portal == UINT32_MAX) {
+		// No abstract path, let the regular search handle the unreachable end.
+		return;
+	}
+
+	LocalVector<uint8_t> &cluster_corridor = path_query_slot->cluster_corridor;
+	for (uint8_t &in_corridor : cluster_corridor) {
+		in_corridor = 0;
+	}
+	cluster_corridor[begin_cluster] = 1;
+	for (uint32_t portal_index = end_portal; portal_index != UINT32_MAX; portal_index = portal_back[portal_index]) {
+		cluster_corridor[graph.portals[portal_index].to_cluster] = 1;
+	}
+
+	p_query_task.cluster_corridor = cluster_corridor.ptr();
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
@@ -337,12 +498,16 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 			&traversable_polys = p_query_task.path_query_slot->traversable_polys;
 	traversable_polys.clear();
 
+	// Only the polygons touched by the previous query need to be reset.
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
-	for (NavigationPoly &polygon : navigation_polys) {
-		polygon.reset();
+	LocalVector<uint32_t> &touched_polys = p_query_task.path_query_slot->touched_polys;
+	for (uint32_t touched_poly_id : touched_polys) {
+		navigation_polys[touched_poly_id].reset();
 	}
+	touched_polys.clear();
 
 	// Initialize the matching navigation polygon.
+	touched_polys.push_back(p_query_task.path_query_slot->poly_to_id[begin_poly]);
 	NavigationPoly &begin_navigation_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[begin_poly]];
 	begin_navigation_poly.poly = begin_poly;
 	begin_navigation_poly.entry = begin_point;
@@ -409,6 +574,12 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_query_task.cluster_corridor && is_reachable && !path_search_max_reached) {
+				// The end is not reachable inside the cluster corridor, let the caller search the whole map.
+				p_query_task.cluster_corridor_failed = true;
+				return;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -455,9 +626,9 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 				return;
 			}
 
-			for (NavigationPoly &nav_poly : navigation_polys) {
-				nav_poly.poly = nullptr;
-				nav_poly.traveled_distance = FLT_MAX;
+			for (uint32_t touched_poly_id : touched_polys) {
+				navigation_polys[touched_poly_id].poly = nullptr;
+				navigation_polys[touched_poly_id].traveled_distance = FLT_MAX;
 			}
 			uint32_t _bp_id = p_query_task.path_query_slot->poly_to_id[begin_poly];
 			navigation_polys[_bp_id].poly = begin_poly;
@@ -539,8 +710,19 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
+	if (!p_map_iteration.cluster_graph.is_empty()) {
+		_query_task_build_cluster_corridor(p_query_task, p_map_iteration);
+	}
+
 	_query_task_build_path_corridor(p_query_task, p_map_iteration);
 
+	if (p_query_task.cluster_corridor_failed) {
+		// The abstract path is only an approximation, fall back to a search over the whole map.
+		p_query_task.cluster_corridor = nullptr;
+		p_query_task.cluster_corridor_failed = false;
+		_query_task_build_path_corridor(p_query_task, p_map_iteration);
+	}
+
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		_query_task_process_path_result_limits(p_query_task);
 		return;
@@ -1103,6 +1285,305 @@ Vector3 NavMeshQueries3D::map_iteration_get_random_point(const NavMapIteration3D
 	}
 }
 
+Vector3 NavMeshQueries3D::map_iteration_get_flow_direction(const NavMapIteration3D &p_map_iteration, const Vector3 &p_target_position, const Vector3 &p_position, uint32_t p_navigation_layers, FlowFieldHint *r_hint, real_t p_hint_height) {
+	_flow_field_index_polygons(p_map_iteration);
+
+	const bool hint_valid = r_hint && r_hint->iteration_id == p_map_iteration.iteration_id && r_hint->navigation_layers == p_navigation_layers;
+
+	FlowFieldClosestPolygon closest[2];
+	closest[0].point = p_target_position;
+	closest[1].point = p_position;
+
+	uint32_t target_polygon = UINT32_MAX;
+	if (hint_valid && r_hint->target_polygon != UINT32_MAX && r_hint->target_position == p_target_position) {
+		target_polygon = r_hint->target_polygon;
+	} else {
+		// Without a usable hint both points are looked up in the same pass over the map.
+		_flow_field_get_closest_polygons(p_map_iteration, p_navigation_layers, closest, hint_valid ? 1 : 2);
+		target_polygon = closest[0].polygon;
+	}
+	if (target_polygon == UINT32_MAX) {
+		return Vector3();
+	}
+
+	Ref<NavMapFlowField3D> flow_field = _flow_field_get(p_map_iteration, target_polygon, p_navigation_layers);
+	const LocalVector<NavMapFlowField3D::PolygonFlow> &polygon_flows = flow_field->polygon_flows;
+
+	// Agents usually stay in the polygon of their last sample or move on to the next one along the flow.
+	uint32_t polygon = closest[1].polygon;
+	Vector3 point = closest[1].closest_point;
+	if (hint_valid && r_hint->polygon != UINT32_MAX) {
+		if (_flow_field_polygon_has_point(p_map_iteration, r_hint->polygon, p_position, p_hint_height, point)) {
+			polygon = r_hint->polygon;
+		} else {
+			const uint32_t next_polygon = polygon_flows[r_hint->polygon].next;
+			if (next_polygon != UINT32_MAX && _flow_field_polygon_has_point(p_map_iteration, next_polygon, p_position, p_hint_height, point)) {
+				polygon = next_polygon;
+			}
+		}
+	}
+	if (polygon == UINT32_MAX) {
+		_flow_field_get_closest_polygons(p_map_iteration, p_navigation_layers, &closest[1], 1);
+		polygon = closest[1].polygon;
+		point = closest[1].closest_point;
+	}
+
+	if (r_hint) {
+		r_hint->iteration_id = p_map_iteration.iteration_id;
+		r_hint->navigation_layers = p_navigation_layers;
+		r_hint->target_position = p_target_position;
+		r_hint->target_polygon = target_polygon;
+		r_hint->polygon = polygon;
+	}
+
+	if (polygon == UINT32_MAX) {
+		return Vector3();
+	}
+
+	Vector3 direction;
+	uint32_t flow_polygon = polygon;
+	// When standing on the pathway to the next polygon, follow the flow of that polygon instead.
+	for (int i = 0; i < 2 && direction.is_zero_approx(); i++) {
+		if (flow_polygon == target_polygon) {
+			direction = p_target_position - point;
+			break;
+		}
+		const NavMapFlowField3D::PolygonFlow &polygon_flow = polygon_flows[flow_polygon];
+		if (polygon_flow.next == UINT32_MAX) {
+			// The target is not reachable from here.
+			return Vector3();
+		}
+		direction = Geometry3D::get_closest_point_to_segment(point, polygon_flow.pathway_start, polygon_flow.pathway_end) - point;
+		flow_polygon = polygon_flow.next;
+	}
+
+	return direction.normalized();
+}
+
+void NavMeshQueries3D::_flow_field_index_polygons(const NavMapIteration3D &p_map_iteration) {
+	NavMapFlowFieldCache3D &cache = p_map_iteration.flow_field_cache;
+	if (likely(cache.polygons_indexed.is_set())) {
+		return;
+	}
+
+	MutexLock lock(cache.index_mutex);
+	if (cache.polygons_indexed.is_set()) {
+		return; // Indexed by another thread while waiting for the lock.
+	}
+
+	for (const Ref<NavRegionIteration3D> &region : p_map_iteration.region_iterations) {
+		for (const Polygon &polygon : region->get_navmesh_polygons()) {
+			cache.polygon_to_id[&polygon] = cache.polygons.size();
+			cache.polygons.push_back(&polygon);
+		}
+	}
+	for (const Polygon &polygon : p_map_iteration.navlink_polygons) {
+		cache.polygon_to_id[&polygon] = cache.polygons.size();
+		cache.polygons.push_back(&polygon);
+	}
+
+	cache.polygon_centers.resize(cache.polygons.size());
+	cache.incoming_connections.resize(cache.polygons.size());
+
+	for (uint32_t polygon_id = 0; polygon_id < cache.polygons.size(); polygon_id++) {
+		const Polygon *polygon = cache.polygons[polygon_id];
+
+		Vector3 center;
+		for (const Vector3 &vertex : polygon->vertices) {
+			center += vertex;
+		}
+		if (polygon->vertices.size() > 0) {
+			center /= polygon->vertices.size();
+		}
+		cache.polygon_centers[polygon_id] = center;
+
+		// The flow is computed backward from the target, so store every connection on the polygon it leads to.
+		const LocalVector<LocalVector<Connection>> &internal_connections = polygon->owner->get_internal_connections();
+		if (polygon->id < internal_connections.size()) {
+			for (const Connection &connection : internal_connections[polygon->id]) {
+				const uint32_t *to_polygon_id = cache.polygon_to_id.getptr(connection.polygon);
+				if (to_polygon_id) {
+					cache.incoming_connections[*to_polygon_id].push_back({ polygon_id, connection.pathway_start, connection.pathway_end });
+				}
+			}
+		}
+
+		const LocalVector<LocalVector<Connection>> *external_connections = p_map_iteration.navbases_polygons_external_connections.getptr(polygon->owner);
+		if (external_connections && polygon->id < external_connections->size()) {
+			for (const Connection &connection : (*external_connections)[polygon->id]) {
+				const uint32_t *to_polygon_id = cache.polygon_to_id.getptr(connection.polygon);
+				if (to_polygon_id) {
+					cache.incoming_connections[*to_polygon_id].push_back({ polygon_id, connection.pathway_start, connection.pathway_end });
+				}
+			}
+		}
+	}
+
+	cache.polygons_indexed.set();
+}
+
+void NavMeshQueries3D::_flow_field_get_closest_polygons(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, FlowFieldClosestPolygon *r_closest, uint32_t p_closest_count) {
+	const NavMapFlowFieldCache3D &cache = p_map_iteration.flow_field_cache;
+
+	// Visit the regions closest to the first point first, so that the regions further away than
+	// the polygons found so far can be skipped by their bounds alone.
+	struct RegionDistance {
+		const NavRegionIteration3D *region = nullptr;
+		real_t distance = 0.0;
+
+		bool operator<(const RegionDistance &p_other) const {
+			return distance < p_other.distance;
+		}
+	};
+	LocalVector<RegionDistance> regions;
+	regions.reserve(p_map_iteration.region_iterations.size());
+	for (const Ref<NavRegionIteration3D> &region : p_map_iteration.region_iterations) {
+		if (!region->get_enabled() || (p_navigation_layers & region->get_navigation_layers()) == 0) {
+			continue;
+		}
+		const AABB bounds = region->get_bounds();
+		regions.push_back({ region.ptr(), r_closest[0].point.distance_squared_to(r_closest[0].point.clamp(bounds.position, bounds.get_end())) });
+	}
+	regions.sort();
+
+	const Polygon *closest_polygons[2] = { nullptr, nullptr };
+	DEV_ASSERT(p_closest_count <= 2);
+
+	for (const RegionDistance &region_distance : regions) {
+		const AABB bounds = region_distance.region->get_bounds();
+		bool region_needed = false;
+		for (uint32_t i = 0; i < p_closest_count; i++) {
+			const Vector3 &point = r_closest[i].point;
+			if (point.distance_squared_to(point.clamp(bounds.position, bounds.get_end())) < r_closest[i].distance) {
+				region_needed = true;
+				break;
+			}
+		}
+		if (!region_needed) {
+			continue;
+		}
+
+		for (const Polygon &polygon : region_distance.region->get_navmesh_polygons()) {
+			for (uint32_t point_id = 2; point_id < polygon.vertices.size(); point_id++) {
+				const Face3 face(polygon.vertices[0], polygon.vertices[point_id - 1], polygon.vertices[point_id]);
+				for (uint32_t i = 0; i < p_closest_count; i++) {
+					FlowFieldClosestPolygon &closest = r_closest[i];
+					const Vector3 point = face.get_closest_point_to(closest.point);
+					const real_t distance = point.distance_squared_to(closest.point);
+					if (distance < closest.distance) {
+						closest.distance = distance;
+						closest.closest_point = point;
+						closest_polygons[i] = &polygon;
+					}
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < p_closest_count; i++) {
+		r_closest[i].polygon = closest_polygons[i] ? cache.polygon_to_id[closest_polygons[i]] : UINT32_MAX;
+	}
+}
+
+bool NavMeshQueries3D::_flow_field_polygon_has_point(const NavMapIteration3D &p_map_iteration, uint32_t p_polygon, const Vector3 &p_point, real_t p_max_height, Vector3 &r_closest_point) {
+	const Polygon *polygon = p_map_iteration.flow_field_cache.polygons[p_polygon];
+
+	real_t closest_distance = FLT_MAX;
+	for (uint32_t point_id = 2; point_id < polygon->vertices.size(); point_id++) {
+		const Face3 face(polygon->vertices[0], polygon->vertices[point_id - 1], polygon->vertices[point_id]);
+		const Vector3 point = face.get_closest_point_to(p_point);
+		const real_t distance = point.distance_squared_to(p_point);
+		if (distance < closest_distance) {
+			closest_distance = distance;
+			r_closest_point = point;
+		}
+	}
+	if (closest_distance == FLT_MAX) {
+		return false;
+	}
+
+	// The point must be above or below the polygon surface (within 1 cm horizontally), within the height limit.
+	const Vector3 offset = p_point - r_closest_point;
+	const real_t height = offset.dot(p_map_iteration.map_up);
+	const Vector3 horizontal_offset = offset - p_map_iteration.map_up * height;
+	return horizontal_offset.length_squared() < 0.0001 && Math::abs(height) <= p_max_height;
+}
+
+Ref<NavMapFlowField3D> NavMeshQueries3D::_flow_field_get(const NavMapIteration3D &p_map_iteration, uint32_t p_target_polygon, uint32_t p_navigation_layers) {
+	NavMapFlowFieldCache3D &cache = p_map_iteration.flow_field_cache;
+
+	NavMapFlowFieldCache3D::Key key;
+	key.target_polygon = p_target_polygon;
+	key.navigation_layers = p_navigation_layers;
+
+	{
+		RWLockRead read_lock(cache.flow_fields_rwlock);
+		const Ref<NavMapFlowField3D> *cached_flow_field = cache.flow_fields.getptr(key);
+		if (cached_flow_field) {
+			return *cached_flow_field;
+		}
+	}
+
+	// Dijkstra search from the target over the reversed polygon connections.
+	Ref<NavMapFlowField3D> flow_field;
+	flow_field.instantiate();
+	flow_field->target_polygon = p_target_polygon;
+
+	LocalVector<NavMapFlowField3D::PolygonFlow> &polygon_flows = flow_field->polygon_flows;
+	polygon_flows.resize(cache.polygons.size());
+	polygon_flows[p_target_polygon].cost = 0.0;
+
+	Heap<ClusterSearchEntry, ClusterSearchEntryGreaterThan> polygon_heap;
+	polygon_heap.push({ 0.0, 0.0, p_target_polygon });
+
+	while (!polygon_heap.is_empty()) {
+		const ClusterSearchEntry entry = polygon_heap.pop();
+		if (entry.traveled > polygon_flows[entry.index].cost) {
+			// Outdated entry, the polygon was reached with a lower cost in the meantime.
+			continue;
+		}
+
+		const Polygon *to_polygon = cache.polygons[entry.index];
+		const Vector3 &to_center = cache.polygon_centers[entry.index];
+
+		for (const NavMapFlowFieldCache3D::IncomingConnection &connection : cache.incoming_connections[entry.index]) {
+			const NavBaseIteration3D *from_owner = cache.polygons[connection.polygon]->owner;
+			if (!from_owner->get_enabled() || (p_navigation_layers & from_owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+
+			const Vector3 pathway_middle = (connection.pathway_start + connection.pathway_end) * 0.5;
+			real_t cost = entry.traveled +
+					cache.polygon_centers[connection.polygon].distance_to(pathway_middle) * from_owner->get_travel_cost() +
+					pathway_middle.distance_to(to_center) * to_polygon->owner->get_travel_cost();
+			if (from_owner != to_polygon->owner) {
+				cost += to_polygon->owner->get_enter_cost();
+			}
+
+			NavMapFlowField3D::PolygonFlow &polygon_flow = polygon_flows[connection.polygon];
+			if (cost < polygon_flow.cost) {
+				polygon_flow.cost = cost;
+				polygon_flow.next = entry.index;
+				polygon_flow.pathway_start = connection.pathway_start;
+				polygon_flow.pathway_end = connection.pathway_end;
+				polygon_heap.push({ cost, cost, connection.polygon });
+			}
+		}
+	}
+
+	RWLockWrite write_lock(cache.flow_fields_rwlock);
+	const Ref<NavMapFlowField3D> *cached_flow_field = cache.flow_fields.getptr(key);
+	if (cached_flow_field) {
+		// Another thread computed the same flow field in the meantime.
+		return *cached_flow_field;
+	}
+	if (cache.flow_fields.size() >= NavMapFlowFieldCache3D::MAX_FLOW_FIELDS) {
+		cache.flow_fields.remove(cache.flow_fields.begin());
+	}
+	cache.flow_fields.insert(key, flow_field);
+	return flow_field;
+}
+
 Vector3 NavMeshQueries3D::polygons_get_closest_point_to_segment(const LocalVector<Polygon> &p_polygons, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) {
 	bool use_collision = p_use_collision;
 	Vector3 closest_point;
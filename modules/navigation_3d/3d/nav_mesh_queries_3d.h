@@ -41,8 +41,10 @@
 #include "../nav_utils_3d.h"
 
 #include "core/templates/a_hash_map.h"
+#include "core/templates/safe_refcount.h"
 
 #include "servers/navigation/navigation_globals.h"
+#include "servers/navigation/navigation_path_query_batch_result_3d.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
 #include "servers/navigation/navigation_path_query_result_3d.h"
 #include "servers/navigation/navigation_utilities.h"
@@ -51,6 +53,8 @@ using namespace NavigationUtilities;
 
 class NavMap3D;
 struct NavMapIteration3D;
+struct NavMapClusterGraph3D;
+class NavMapFlowField3D;
 
 class NavMeshQueries3D {
 public:
@@ -60,6 +64,27 @@ public:
 		bool in_use = false;
 		uint32_t slot_index = 0;
 		AHashMap<const Nav3D::Polygon *, uint32_t> poly_to_id;
+		/// Ids of the `path_corridor` polygons modified by the last query, so that only those need to be reset.
+		LocalVector<uint32_t> touched_polys;
+
+		/// @name Hierarchical Pathfinding
+		/// @{
+		LocalVector<real_t> portal_costs;
+		LocalVector<uint32_t> portal_back;
+		Heap<Nav3D::ClusterSearchEntry, Nav3D::ClusterSearchEntryGreaterThan> portal_heap;
+		/// Per cluster, 0 when not checked yet, 1 when usable by the query, 2 when not.
+		LocalVector<uint8_t> cluster_usable;
+		/// Per cluster, 1 when the cluster is part of the corridor the polygon search is restricted to.
+		LocalVector<uint8_t> cluster_corridor;
+		/// @}
+
+		/// Bytes allocated by the scratch arrays, which keep their capacity between queries.
+		uint64_t get_memory_usage() const {
+			return uint64_t(path_corridor.get_capacity()) * sizeof(Nav3D::NavigationPoly) + uint64_t(traversable_polys.get_capacity()) * sizeof(Nav3D::NavigationPoly *) +
+					uint64_t(poly_to_id.get_capacity()) * (sizeof(HashMapData) + sizeof(KeyValue<const Nav3D::Polygon *, uint32_t>)) + uint64_t(touched_polys.get_capacity()) * sizeof(uint32_t) +
+					uint64_t(portal_costs.get_capacity()) * sizeof(real_t) + uint64_t(portal_back.get_capacity()) * sizeof(uint32_t) +
+					uint64_t(portal_heap.get_capacity()) * sizeof(Nav3D::ClusterSearchEntry) + uint64_t(cluster_usable.get_capacity()) + uint64_t(cluster_corridor.get_capacity());
+		}
 	};
 
 	struct NavMeshPathQueryTask3D {
@@ -107,6 +132,14 @@ public:
 		NavMap3D *map = nullptr;
 		PathQuerySlot *path_query_slot = nullptr;
 		/// @}
+		/// @name Hierarchical Pathfinding
+		/// @{
+		const NavMapClusterGraph3D *cluster_graph = nullptr;
+		/// When set, the polygon search only enters the clusters marked in this mask.
+		const uint8_t *cluster_corridor = nullptr;
+		/// Set when the polygon search could not reach the end inside the cluster corridor.
+		bool cluster_corridor_failed = false;
+		/// @}
 		/// @name Path Points
 		/// @{
 		LocalVector<Vector3> path_points;
@@ -136,6 +169,37 @@ public:
 		}
 	};
 
+	/// Many path queries run together against the same map iteration, see NavMap3D::query_path_batch().
+	struct NavMeshPathQueryBatch3D {
+		struct PathRange {
+			uint32_t worker = 0;
+			uint32_t offset = 0;
+			uint32_t count = 0;
+			float length = 0.0;
+		};
+
+		/// Each worker runs its queries with a single path query slot, and appends all their points to its own buffer.
+		struct Worker {
+			LocalVector<Vector3> path_points;
+			/// Reused by every query of the worker as its path buffer.
+			LocalVector<Vector3> query_path_points;
+		};
+
+		LocalVector<NavMeshPathQueryTask3D> query_tasks;
+		LocalVector<PathRange> path_ranges;
+		LocalVector<Worker> workers;
+		SafeNumeric<uint32_t> next_query_index;
+		NavMapIteration3D *map_iteration = nullptr;
+	};
+
+	/// A point looked up on the map by _flow_field_get_closest_polygons().
+	struct FlowFieldClosestPolygon {
+		Vector3 point;
+		real_t distance = FLT_MAX;
+		uint32_t polygon = UINT32_MAX;
+		Vector3 closest_point;
+	};
+
 	static bool emit_callback(const Callable &p_callback);
 
 	static Vector3 polygons_get_random_point(const LocalVector<Nav3D::Polygon> &p_polygons, uint32_t p_navigation_layers, bool p_uniformly);
@@ -152,12 +216,21 @@ public:
 	static RID map_iteration_get_closest_point_owner(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Nav3D::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
+	static Vector3 map_iteration_get_flow_direction(const NavMapIteration3D &p_map_iteration, const Vector3 &p_target_position, const Vector3 &p_position, uint32_t p_navigation_layers, Nav3D::FlowFieldHint *r_hint = nullptr, real_t p_hint_height = 0.0);
+
+	static void _flow_field_index_polygons(const NavMapIteration3D &p_map_iteration);
+	static void _flow_field_get_closest_polygons(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, FlowFieldClosestPolygon *r_closest, uint32_t p_closest_count);
+	static bool _flow_field_polygon_has_point(const NavMapIteration3D &p_map_iteration, uint32_t p_polygon, const Vector3 &p_point, real_t p_max_height, Vector3 &r_closest_point);
+	static Ref<NavMapFlowField3D> _flow_field_get(const NavMapIteration3D &p_map_iteration, uint32_t p_target_polygon, uint32_t p_navigation_layers);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
+	static void map_query_path_batch(NavMap3D *map, const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryBatchResult3D> p_query_result);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static void _query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static void _query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
@@ -264,6 +264,22 @@ void NavAgent3D::set_target_position(const Vector3 p_target_position) {
 	target_position = p_target_position;
 }
 
+Vector3 NavAgent3D::get_flow_direction(const Vector3 &p_target_position, uint32_t p_navigation_layers) {
+	ERR_FAIL_NULL_V(map, Vector3());
+
+	flow_field_hint_mutex.lock();
+	Nav3D::FlowFieldHint hint = flow_field_hint;
+	flow_field_hint_mutex.unlock();
+
+	const Vector3 direction = map->get_flow_direction(p_target_position, position, p_navigation_layers, &hint, height);
+
+	flow_field_hint_mutex.lock();
+	flow_field_hint = hint;
+	flow_field_hint_mutex.unlock();
+
+	return direction;
+}
+
 void NavAgent3D::set_velocity(const Vector3 p_velocity) {
 	velocity = p_velocity;
 	if (avoidance_enabled) {
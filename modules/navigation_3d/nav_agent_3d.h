@@ -39,8 +39,10 @@
  */
 
 #include "nav_rid_3d.h"
+#include "nav_utils_3d.h"
 
 #include "core/object/class_db.h"
+#include "core/os/mutex.h"
 #include "core/templates/self_list.h"
 #include "servers/navigation/navigation_globals.h"
 
@@ -79,6 +81,11 @@ class NavAgent3D : public NavRid3D {
 
 	bool agent_dirty = true;
 
+	// Remembers the polygon of the last flow field sample so the next one can skip the polygon search.
+	// Samples can be taken from several threads at once, so the hint is only copied in and out under the mutex.
+	Nav3D::FlowFieldHint flow_field_hint;
+	mutable BinaryMutex flow_field_hint_mutex;
+
 	uint32_t last_map_iteration_id = 0;
 	bool paused = false;
 
@@ -134,6 +141,8 @@ public:
 	void set_target_position(const Vector3 p_target_position);
 	const Vector3 &get_target_position() const { return target_position; }
 
+	Vector3 get_flow_direction(const Vector3 &p_target_position, uint32_t p_navigation_layers);
+
 	/// Sets the "wanted" velocity for an agent as a suggestion
 	/// This velocity is not guaranteed, RVO simulation will only try to fulfill it
 	void set_velocity(const Vector3 p_velocity);
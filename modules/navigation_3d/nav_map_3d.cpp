@@ -118,6 +118,23 @@ void NavMap3D::set_use_edge_connections(bool p_enabled) {
 	iteration_dirty = true;
 }
 
+void NavMap3D::set_use_packed_avoidance(bool p_enabled) {
+	if (use_packed_avoidance == p_enabled) {
+		return;
+	}
+	use_packed_avoidance = p_enabled;
+	// The RVO agent tree is not maintained while the packed solver is in use.
+	agents_dirty = true;
+}
+
+void NavMap3D::set_use_hierarchical_pathfinding(bool p_enabled) {
+	if (use_hierarchical_pathfinding == p_enabled) {
+		return;
+	}
+	use_hierarchical_pathfinding = p_enabled;
+	iteration_dirty = true;
+}
+
 void NavMap3D::set_edge_connection_margin(real_t p_edge_connection_margin) {
 	if (edge_connection_margin == p_edge_connection_margin) {
 		return;
@@ -151,41 +168,129 @@ PointKey NavMap3D::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
-void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
-	if (iteration_id == 0) {
-		return;
-	}
-
-	GET_MAP_ITERATION();
+NavMeshQueries3D::PathQuerySlot *NavMap3D::_acquire_path_query_slot(NavMapIteration3D &r_map_iteration) {
+	r_map_iteration.path_query_slots_semaphore.wait();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+	r_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : r_map_iteration.path_query_slots) {
 		if (!p_path_query_slot.in_use) {
 			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+			path_query_slot = &p_path_query_slot;
 			break;
 		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
+	r_map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		r_map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_NULL_V_MSG(path_query_slot, nullptr, "No unused NavMap3D path query slot found! This should never happen :(.");
+	}
+
+	return path_query_slot;
+}
+
+void NavMap3D::_release_path_query_slot(NavMapIteration3D &r_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot) {
+	r_map_iteration.path_query_slots_mutex.lock();
+	r_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	r_map_iteration.path_query_slots_mutex.unlock();
+
+	r_map_iteration.path_query_slots_semaphore.post();
+}
+
+void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
+	if (iteration_id == 0) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
 
+	p_query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
 	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+		return;
 	}
 
 	p_query_task.map_up = map_iteration.map_up;
 
 	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
+	_release_path_query_slot(map_iteration, p_query_task.path_query_slot);
 	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+}
+
+void NavMap3D::_query_path_batch_worker(void *p_userdata, uint32_t p_worker_index) {
+	NavMeshQueries3D::NavMeshPathQueryBatch3D *batch = static_cast<NavMeshQueries3D::NavMeshPathQueryBatch3D *>(p_userdata);
+	NavMapIteration3D &map_iteration = *batch->map_iteration;
+	NavMeshQueries3D::NavMeshPathQueryBatch3D::Worker &worker = batch->workers[p_worker_index];
+
+	// A single slot is used for all the queries of this worker so its heap and corridor are reused.
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = _acquire_path_query_slot(map_iteration);
+	if (path_query_slot == nullptr) {
+		return;
+	}
+
+	const uint32_t query_count = batch->query_tasks.size();
+	while (true) {
+		const uint32_t query_index = batch->next_query_index.postincrement();
+		if (query_index >= query_count) {
+			break;
+		}
 
-	map_iteration.path_query_slots_semaphore.post();
+		NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = batch->query_tasks[query_index];
+		query_task.path_query_slot = path_query_slot;
+		query_task.map_up = map_iteration.map_up;
+		query_task.path_points = std::move(worker.query_path_points);
+
+		NavMeshQueries3D::query_task_map_iteration_get_path(query_task, map_iteration);
+
+		NavMeshQueries3D::NavMeshPathQueryBatch3D::PathRange &path_range = batch->path_ranges[query_index];
+		path_range.worker = p_worker_index;
+		path_range.offset = worker.path_points.size();
+		path_range.count = query_task.path_points.size();
+		path_range.length = query_task.path_length;
+		for (const Vector3 &path_point : query_task.path_points) {
+			worker.path_points.push_back(path_point);
+		}
+
+		query_task.path_points.clear();
+		worker.query_path_points = std::move(query_task.path_points);
+		query_task.path_query_slot = nullptr;
+	}
+
+	_release_path_query_slot(map_iteration, path_query_slot);
+}
+
+void NavMap3D::_query_path_batch_worker_offset(void *p_userdata, uint32_t p_worker_index) {
+	// Worker 0 is the thread that called query_path_batch().
+	_query_path_batch_worker(p_userdata, p_worker_index + 1);
+}
+
+void NavMap3D::query_path_batch(NavMeshQueries3D::NavMeshPathQueryBatch3D &p_batch) {
+	if (iteration_id == 0 || p_batch.query_tasks.is_empty()) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	p_batch.map_iteration = &map_iteration;
+	p_batch.next_query_index.set(0);
+
+	const uint32_t worker_count = MIN(map_iteration.path_query_slots.size(), p_batch.query_tasks.size());
+	p_batch.workers.resize(worker_count);
+
+	// This call blocks until the whole batch is done, so the calling thread takes
+	// the first share of the queries instead of idling while the pool works.
+	WorkerThreadPool::GroupID group_task = -1;
+	if (worker_count > 1) {
+		group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMap3D::_query_path_batch_worker_offset, &p_batch, worker_count - 1, worker_count - 1, true, SNAME("NavMap3DQueryPathBatch"));
+	}
+	_query_path_batch_worker(&p_batch, 0);
+	if (group_task != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	p_batch.map_iteration = nullptr;
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -342,6 +447,17 @@ Vector3 NavMap3D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries3D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+Vector3 NavMap3D::get_flow_direction(const Vector3 &p_target_position, const Vector3 &p_position, uint32_t p_navigation_layers, Nav3D::FlowFieldHint *r_hint, real_t p_hint_height) const {
+	if (iteration_id == 0) {
+		NAVMAP_ITERATION_ZERO_ERROR_MSG();
+		return Vector3();
+	}
+
+	GET_MAP_ITERATION_CONST();
+
+	return NavMeshQueries3D::map_iteration_get_flow_direction(map_iteration, p_target_position, p_position, p_navigation_layers, r_hint, p_hint_height);
+}
+
 void NavMap3D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
@@ -374,6 +490,7 @@ void NavMap3D::_build_iteration() {
 
 	iteration_build.merge_rasterizer_cell_size = get_merge_rasterizer_cell_size();
 	iteration_build.use_edge_connections = get_use_edge_connections();
+	iteration_build.use_hierarchical_pathfinding = get_use_hierarchical_pathfinding();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
 
@@ -428,6 +545,7 @@ void NavMap3D::_sync_iteration() {
 	// Finally ping-pong switch the iteration slot.
 	iteration_slot_rwlock.write_lock();
 	uint32_t next_iteration_slot_index = (iteration_slot_index + 1) % 2;
+	iteration_slots[next_iteration_slot_index].iteration_id = iteration_id;
 	iteration_slot_index = next_iteration_slot_index;
 	iteration_slot_rwlock.write_unlock();
 
@@ -595,7 +713,9 @@ void NavMap3D::_update_rvo_simulation() {
 		_update_rvo_obstacles_tree_2d();
 	}
 	if (agents_dirty) {
-		_update_rvo_agents_tree_2d();
+		if (!use_packed_avoidance) {
+			_update_rvo_agents_tree_2d();
+		}
 		_update_rvo_agents_tree_3d();
 	}
 }
@@ -618,7 +738,9 @@ void NavMap3D::step(double p_delta_time) {
 	rvo_simulation_2d.setTimeStep(float(p_delta_time));
 	rvo_simulation_3d.setTimeStep(float(p_delta_time));
 
-	if (active_2d_avoidance_agents.size() > 0) {
+	if (active_2d_avoidance_agents.size() > 0 && use_packed_avoidance) {
+		avoidance_solver.step(active_2d_avoidance_agents, rvo_simulation_2d, float(p_delta_time), use_threads && avoidance_use_multiple_threads, avoidance_use_high_priority_threads);
+	} else if (active_2d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
@@ -663,6 +785,21 @@ void NavMap3D::_update_merge_rasterizer_cell_dimensions() {
 	merge_rasterizer_cell_size.z = cell_size * merge_rasterizer_cell_scale;
 }
 
+uint64_t NavMap3D::get_pathfinding_memory_usage() const {
+	GET_MAP_ITERATION_CONST();
+
+	uint64_t memory_usage = map_iteration.cluster_graph.get_memory_usage();
+
+	MutexLock path_query_slots_lock(map_iteration.path_query_slots_mutex);
+	memory_usage += uint64_t(map_iteration.path_query_slots.get_capacity()) * sizeof(NavMeshQueries3D::PathQuerySlot);
+	for (const NavMeshQueries3D::PathQuerySlot &path_query_slot : map_iteration.path_query_slots) {
+		if (!path_query_slot.in_use) {
+			memory_usage += path_query_slot.get_memory_usage();
+		}
+	}
+	return memory_usage;
+}
+
 int NavMap3D::get_region_connections_count(NavRegion3D *p_region) const {
 	ERR_FAIL_NULL_V(p_region, 0);
 
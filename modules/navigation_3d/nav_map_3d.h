@@ -38,6 +38,7 @@
  * [Add any documentation that applies to the entire file here!]
  */
 
+#include "3d/nav_avoidance_solver_3d.h"
 #include "3d/nav_map_iteration_3d.h"
 #include "3d/nav_mesh_queries_3d.h"
 #include "nav_rid_3d.h"
@@ -73,6 +74,8 @@ class NavMap3D : public NavRid3D {
 	float merge_rasterizer_cell_scale = 0.1;
 
 	bool use_edge_connections = true;
+	/// When enabled, path queries first search an abstract graph of the regions and links to restrict the polygon search.
+	bool use_hierarchical_pathfinding = false;
 	/// This value is used to detect the near edges to connect.
 	real_t edge_connection_margin = NavigationDefaults3D::EDGE_CONNECTION_MARGIN;
 
@@ -91,6 +94,9 @@ class NavMap3D : public NavRid3D {
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
 	RVO3D::RVOSimulator3D rvo_simulation_3d;
 
+	/// Solves the 2D avoidance agents when packed avoidance is used.
+	NavAvoidanceSolver3D avoidance_solver;
+
 	/// avoidance controlled agents
 	LocalVector<NavAgent3D *> active_2d_avoidance_agents;
 	LocalVector<NavAgent3D *> active_3d_avoidance_agents;
@@ -113,6 +119,8 @@ class NavMap3D : public NavRid3D {
 	bool use_threads = true;
 	bool avoidance_use_multiple_threads = true;
 	bool avoidance_use_high_priority_threads = true;
+	/// When enabled, the agents that use 2D avoidance are solved with packed agent data instead of the RVO2 agents.
+	bool use_packed_avoidance = false;
 
 	/// Performance Monitor
 	Nav3D::PerformanceData performance_data;
@@ -155,6 +163,11 @@ class NavMap3D : public NavRid3D {
 	WorkerThreadPool::TaskID iteration_build_thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
 	static void _build_iteration_threaded(void *p_arg);
 
+	static NavMeshQueries3D::PathQuerySlot *_acquire_path_query_slot(NavMapIteration3D &r_map_iteration);
+	static void _release_path_query_slot(NavMapIteration3D &r_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot);
+	static void _query_path_batch_worker(void *p_userdata, uint32_t p_worker_index);
+	static void _query_path_batch_worker_offset(void *p_userdata, uint32_t p_worker_index);
+
 	bool iteration_dirty = true;
 	bool iteration_building = false;
 	bool iteration_ready = false;
@@ -167,6 +180,9 @@ public:
 	~NavMap3D();
 
 	uint32_t get_iteration_id() const { return iteration_id; }
+	/// Bytes used by the cluster graph and the path query slots of the current iteration.
+	/// Slots in use by a running query are not counted.
+	uint64_t get_pathfinding_memory_usage() const;
 
 	void set_up(Vector3 p_up);
 	Vector3 get_up() const {
@@ -191,6 +207,16 @@ public:
 		return use_edge_connections;
 	}
 
+	void set_use_packed_avoidance(bool p_enabled);
+	bool get_use_packed_avoidance() const {
+		return use_packed_avoidance;
+	}
+
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const {
+		return use_hierarchical_pathfinding;
+	}
+
 	void set_edge_connection_margin(real_t p_edge_connection_margin);
 	real_t get_edge_connection_margin() const {
 		return edge_connection_margin;
@@ -205,6 +231,8 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	// Blocks until all the queries of the batch are done, the calling thread runs its share of them.
+	void query_path_batch(NavMeshQueries3D::NavMeshPathQueryBatch3D &p_batch);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -243,6 +271,10 @@ public:
 
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
 
+	/// Returns the normalized direction at p_position that follows the shortest paths toward p_target_position.
+	/// All queries toward the same target share a flow field that is cached with the current map iteration.
+	Vector3 get_flow_direction(const Vector3 &p_target_position, const Vector3 &p_position, uint32_t p_navigation_layers, Nav3D::FlowFieldHint *r_hint = nullptr, real_t p_hint_height = 0.0) const;
+
 	void sync();
 	void step(double p_delta_time);
 	void dispatch_callbacks();
@@ -179,6 +179,30 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+/// Entry of the heaps used by the hierarchical pathfinding searches, over the polygons of a cluster or over portals.
+struct ClusterSearchEntry {
+	/// The cost used to order the heap.
+	real_t cost = 0.0;
+	/// The cost traveled to reach the polygon or portal, used to detect outdated entries.
+	real_t traveled = 0.0;
+	uint32_t index = 0;
+};
+
+struct ClusterSearchEntryGreaterThan {
+	bool operator()(const ClusterSearchEntry &p_a, const ClusterSearchEntry &p_b) const {
+		return p_a.cost > p_b.cost;
+	}
+};
+
+/// Remembers where a flow field was last sampled, so that the next sample close by is found without searching the map.
+struct FlowFieldHint {
+	uint32_t iteration_id = 0;
+	uint32_t navigation_layers = 0;
+	Vector3 target_position;
+	uint32_t target_polygon = UINT32_MAX;
+	uint32_t polygon = UINT32_MAX;
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
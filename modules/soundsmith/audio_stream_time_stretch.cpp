@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*  audio_stream_time_stretch.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file audio_stream_time_stretch.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "audio_stream_time_stretch.h"
+
+#include "servers/audio_server.h"
+
+void AudioStreamTimeStretch::set_stream(const Ref<AudioStream> &p_stream) {
+	AudioServer::get_singleton()->lock();
+	stream = p_stream;
+	AudioServer::get_singleton()->unlock();
+}
+
+Ref<AudioStream> AudioStreamTimeStretch::get_stream() const {
+	return stream;
+}
+
+void AudioStreamTimeStretch::set_tempo(float p_tempo) {
+	tempo = CLAMP(p_tempo, MIN_TEMPO, MAX_TEMPO);
+}
+
+float AudioStreamTimeStretch::get_tempo() const {
+	return tempo;
+}
+
+void AudioStreamTimeStretch::set_pitch_scale(float p_pitch_scale) {
+	ERR_FAIL_COND(!(p_pitch_scale > 0.0f));
+	pitch_scale = p_pitch_scale;
+}
+
+float AudioStreamTimeStretch::get_pitch_scale() const {
+	return pitch_scale;
+}
+
+Ref<AudioStreamPlayback> AudioStreamTimeStretch::instantiate_playback() {
+	ERR_FAIL_COND_V_MSG(stream.is_null(), Ref<AudioStreamPlayback>(), "AudioStreamTimeStretch has no stream to play.");
+
+	Ref<AudioStreamPlaybackTimeStretch> playback_stretch;
+	playback_stretch.instantiate();
+	playback_stretch->time_stretch = Ref<AudioStreamTimeStretch>(this);
+	playback_stretch->playback = stream->instantiate_playback();
+	ERR_FAIL_COND_V(playback_stretch->playback.is_null(), Ref<AudioStreamPlayback>());
+
+	// Everything the mix thread needs is allocated here. Splitting the computation
+	// spreads the spectral work evenly over the mix calls instead of spiking once per interval.
+	playback_stretch->stretch.presetDefault(2, AudioServer::get_singleton()->get_mix_rate(), true);
+	playback_stretch->source_buffer.resize(AudioStreamPlaybackTimeStretch::MAX_INPUT_CHUNK);
+	for (int c = 0; c < 2; c++) {
+		playback_stretch->input_buffer[c].resize(AudioStreamPlaybackTimeStretch::MAX_INPUT_CHUNK);
+		playback_stretch->output_buffer[c].resize(AudioStreamPlaybackTimeStretch::MIX_CHUNK);
+	}
+
+	return playback_stretch;
+}
+
+String AudioStreamTimeStretch::get_stream_name() const {
+	return stream.is_valid() ? stream->get_stream_name() : String();
+}
+
+double AudioStreamTimeStretch::get_length() const {
+	return stream.is_valid() ? stream->get_length() / tempo : 0.0;
+}
+
+bool AudioStreamTimeStretch::is_monophonic() const {
+	return stream.is_valid() && stream->is_monophonic();
+}
+
+void AudioStreamTimeStretch::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_stream", "stream"), &AudioStreamTimeStretch::set_stream);
+	ClassDB::bind_method(D_METHOD("get_stream"), &AudioStreamTimeStretch::get_stream);
+
+	ClassDB::bind_method(D_METHOD("set_tempo", "tempo"), &AudioStreamTimeStretch::set_tempo);
+	ClassDB::bind_method(D_METHOD("get_tempo"), &AudioStreamTimeStretch::get_tempo);
+
+	ClassDB::bind_method(D_METHOD("set_pitch_scale", "pitch_scale"), &AudioStreamTimeStretch::set_pitch_scale);
+	ClassDB::bind_method(D_METHOD("get_pitch_scale"), &AudioStreamTimeStretch::get_pitch_scale);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "stream", PROPERTY_HINT_RESOURCE_TYPE, "AudioStream"), "set_stream", "get_stream");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "tempo", PROPERTY_HINT_RANGE, "0.25,4,0.01"), "set_tempo", "get_tempo");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "pitch_scale", PROPERTY_HINT_RANGE, "0.25,4,0.01,or_greater"), "set_pitch_scale", "get_pitch_scale");
+}
+
+/////////////////////////////////////////////
+
+void AudioStreamPlaybackTimeStretch::start(double p_from_pos) {
+	playback->start(p_from_pos);
+	stretch.reset();
+	current_pitch_scale = time_stretch->pitch_scale;
+	stretch.setTransposeFactor(current_pitch_scale);
+	tail_frames = 0;
+	source_finished = false;
+	active = true;
+}
+
+void AudioStreamPlaybackTimeStretch::stop() {
+	playback->stop();
+	active = false;
+}
+
+bool AudioStreamPlaybackTimeStretch::is_playing() const {
+	return active;
+}
+
+int AudioStreamPlaybackTimeStretch::get_loop_count() const {
+	return playback->get_loop_count();
+}
+
+double AudioStreamPlaybackTimeStretch::get_playback_position() const {
+	return playback->get_playback_position();
+}
+
+void AudioStreamPlaybackTimeStretch::seek(double p_time) {
+	if (source_finished) {
+		// The source stops at its end, so seeking while the tail is flushed has to start it again.
+		playback->start(p_time);
+	} else {
+		playback->seek(p_time);
+	}
+	stretch.reset();
+	tail_frames = 0;
+	source_finished = false;
+}
+
+int AudioStreamPlaybackTimeStretch::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
+	if (!active) {
+		for (int i = 0; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+		return 0;
+	}
+
+	const float tempo = time_stretch->tempo;
+	if (time_stretch->pitch_scale != current_pitch_scale) {
+		current_pitch_scale = time_stretch->pitch_scale;
+		stretch.setTransposeFactor(current_pitch_scale);
+	}
+
+	float *inputs[2] = { input_buffer[0].ptr(), input_buffer[1].ptr() };
+	float *outputs[2] = { output_buffer[0].ptr(), output_buffer[1].ptr() };
+
+	int mixed = 0;
+	while (mixed < p_frames) {
+		if (source_finished && tail_frames <= 0) {
+			active = false;
+			break;
+		}
+
+		int output_frames = MIN(MIX_CHUNK, p_frames - mixed);
+		if (source_finished) {
+			output_frames = MIN(output_frames, tail_frames);
+			tail_frames -= output_frames;
+		}
+		const int input_frames = CLAMP((int)Math::round(output_frames * tempo), 0, MAX_INPUT_CHUNK);
+
+		int source_frames = 0;
+		if (!source_finished) {
+			source_frames = playback->mix(source_buffer.ptr(), p_rate_scale, input_frames);
+			if (!playback->is_playing()) {
+				// Keep feeding silence until what the stretcher holds has come out.
+				source_finished = true;
+				tail_frames = int((stretch.inputLatency() / tempo) + stretch.outputLatency());
+			}
+		}
+
+		for (int i = 0; i < source_frames; i++) {
+			inputs[0][i] = source_buffer[i].left;
+			inputs[1][i] = source_buffer[i].right;
+		}
+		for (int i = source_frames; i < input_frames; i++) {
+			inputs[0][i] = 0.0f;
+			inputs[1][i] = 0.0f;
+		}
+
+		stretch.process(inputs, input_frames, outputs, output_frames);
+
+		for (int i = 0; i < output_frames; i++) {
+			p_buffer[mixed + i] = AudioFrame(outputs[0][i], outputs[1][i]);
+		}
+		mixed += output_frames;
+	}
+
+	for (int i = mixed; i < p_frames; i++) {
+		p_buffer[i] = AudioFrame(0, 0);
+	}
+
+	return mixed;
+}
+
+void AudioStreamPlaybackTimeStretch::tag_used_streams() {
+	playback->tag_used_streams();
+	time_stretch->tag_used(get_playback_position());
+}
@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  audio_stream_time_stretch.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file audio_stream_time_stretch.h
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "core/templates/local_vector.h"
+#include "servers/audio/audio_stream.h"
+#include "signalsmith-stretch/signalsmith-stretch.h"
+#include <random>
+
+class AudioStreamPlaybackTimeStretch;
+
+class AudioStreamTimeStretch : public AudioStream {
+	GDCLASS(AudioStreamTimeStretch, AudioStream);
+	friend class AudioStreamPlaybackTimeStretch;
+
+	Ref<AudioStream> stream;
+	float tempo = 1.0f;
+	float pitch_scale = 1.0f;
+
+protected:
+	static void _bind_methods();
+
+public:
+	static constexpr float MIN_TEMPO = 0.25f;
+	static constexpr float MAX_TEMPO = 4.0f;
+
+	void set_stream(const Ref<AudioStream> &p_stream);
+	Ref<AudioStream> get_stream() const;
+
+	void set_tempo(float p_tempo);
+	float get_tempo() const;
+
+	void set_pitch_scale(float p_pitch_scale);
+	float get_pitch_scale() const;
+
+	virtual Ref<AudioStreamPlayback> instantiate_playback() override;
+	virtual String get_stream_name() const override;
+
+	virtual double get_length() const override;
+	virtual bool is_monophonic() const override;
+};
+
+class AudioStreamPlaybackTimeStretch : public AudioStreamPlayback {
+	GDCLASS(AudioStreamPlaybackTimeStretch, AudioStreamPlayback);
+	friend class AudioStreamTimeStretch;
+
+	// Frames stretched per pass, all buffers are sized for it up front so mixing never allocates.
+	static constexpr int MIX_CHUNK = 512;
+	static constexpr int MAX_INPUT_CHUNK = int(MIX_CHUNK * AudioStreamTimeStretch::MAX_TEMPO) + 1;
+
+	Ref<AudioStreamTimeStretch> time_stretch;
+	Ref<AudioStreamPlayback> playback;
+
+	signalsmith::stretch::SignalsmithStretch<float, std::mt19937> stretch;
+	LocalVector<AudioFrame> source_buffer;
+	LocalVector<float> input_buffer[2];
+	LocalVector<float> output_buffer[2];
+
+	float current_pitch_scale = 1.0f;
+	int tail_frames = 0; // Output frames left to flush out of the stretcher once the source ended.
+	bool source_finished = false;
+	bool active = false;
+
+public:
+	virtual void start(double p_from_pos = 0.0) override;
+	virtual void stop() override;
+	virtual bool is_playing() const override;
+
+	virtual int get_loop_count() const override; ///< Number of times it looped
+
+	virtual double get_playback_position() const override;
+	virtual void seek(double p_time) override;
+
+	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
+
+	virtual void tag_used_streams() override;
+};
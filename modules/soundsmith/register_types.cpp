@@ -37,6 +37,7 @@
  */
 
 #include "register_types.h"
+#include "audio_stream_time_stretch.h"
 #include "core/object/class_db.h"
 #include "soundsmith_module.h"
 
@@ -46,6 +47,8 @@ void initialize_soundsmith_module(ModuleInitializationLevel p_level) {
 	}
 
 	ClassDB::register_class<SoundSmith>();
+	ClassDB::register_class<AudioStreamTimeStretch>();
+	ClassDB::register_class<AudioStreamPlaybackTimeStretch>();
 }
 
 void uninitialize_soundsmith_module(ModuleInitializationLevel p_level) {
@@ -47,7 +47,6 @@
 #include "servers/audio_server.h"
 
 #include <cmath>
-#include <vector>
 
 void SoundSmith::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_sample_rate", "rate"), &SoundSmith::set_sample_rate);
@@ -113,6 +112,22 @@ void SoundSmith::reset() {
 	stretch.reset();
 }
 
+void SoundSmith::_reserve_buffers(int p_input_frames, int p_output_frames) {
+	if (input_buffer.size() < (uint32_t)(p_input_frames * channels)) {
+		input_buffer.resize(p_input_frames * channels);
+	}
+	if (output_buffer.size() < (uint32_t)(p_output_frames * channels)) {
+		output_buffer.resize(p_output_frames * channels);
+	}
+
+	input_ptrs.resize(channels);
+	output_ptrs.resize(channels);
+	for (int c = 0; c < channels; c++) {
+		input_ptrs[c] = input_buffer.ptr() + c * p_input_frames;
+		output_ptrs[c] = output_buffer.ptr() + c * p_output_frames;
+	}
+}
+
 PackedFloat32Array SoundSmith::process(const PackedFloat32Array &input) {
 	PackedFloat32Array output;
 
@@ -143,42 +158,21 @@ PackedFloat32Array SoundSmith::process(const PackedFloat32Array &input) {
 		output_frames = 0;
 	}
 
-	// Deinterleave
-	std::vector<std::vector<float>> in_ch;
-	in_ch.resize((size_t)channels);
-
-	for (int c = 0; c < channels; c++) {
-		in_ch[(size_t)c].resize((size_t)input_frames);
-	}
+	_reserve_buffers(input_frames, output_frames);
 
+	// Deinterleave
 	const float *src = input.ptr();
 
 	for (int i = 0; i < input_frames; i++) {
 		const int base = i * channels;
 
 		for (int c = 0; c < channels; c++) {
-			in_ch[(size_t)c][(size_t)i] = src[base + c];
+			input_ptrs[c][i] = src[base + c];
 		}
 	}
 
-	// Output buffers
-	std::vector<std::vector<float>> out_ch;
-	out_ch.resize((size_t)channels);
-
-	for (int c = 0; c < channels; c++) {
-		out_ch[(size_t)c].assign((size_t)output_frames, 0.0f);
-	}
-
-	std::vector<float *> in_ptrs((size_t)channels, nullptr);
-	std::vector<float *> out_ptrs((size_t)channels, nullptr);
-
-	for (int c = 0; c < channels; c++) {
-		in_ptrs[(size_t)c] = in_ch[(size_t)c].data();
-		out_ptrs[(size_t)c] = out_ch[(size_t)c].data();
-	}
-
 	// Process: (inputs, inputSamples, outputs, outputSamples)
-	stretch.process(in_ptrs.data(), input_frames, out_ptrs.data(), output_frames);
+	stretch.process(input_ptrs.ptr(), input_frames, output_ptrs.ptr(), output_frames);
 
 	// Interleave
 	output.resize(output_frames * channels);
@@ -188,7 +182,7 @@ PackedFloat32Array SoundSmith::process(const PackedFloat32Array &input) {
 		const int base = i * channels;
 
 		for (int c = 0; c < channels; c++) {
-			dst[base + c] = out_ch[(size_t)c][(size_t)i];
+			dst[base + c] = output_ptrs[c][i];
 		}
 	}
 
@@ -210,68 +204,74 @@ Ref<AudioStreamWAV> SoundSmith::change_tempo(const String &path, float p_tempo,
 
 	pb->start(0.0);
 
-	const int channels = mp3->is_monophonic() ? 1 : 2;
-	const int sample_rate = AudioServer::get_singleton()->get_mix_rate();
+	const int stream_channels = mp3->is_monophonic() ? 1 : 2;
+	const int stream_sample_rate = AudioServer::get_singleton()->get_mix_rate();
 
-	Vector<AudioFrame> frames;
+	set_sample_rate(stream_sample_rate);
+	set_channels(stream_channels);
+	set_tempo(p_tempo);
+	set_pitch(p_pitch);
+
+	reset();
+
+	// Stretch block by block as the MP3 decodes, rather than decoding the whole file first.
 	const int block = 1024;
+	LocalVector<AudioFrame> frames;
+	frames.resize(block);
+	_reserve_buffers(block, (int)std::ceil(block / tempo) + 1);
 
-	while (true) {
-		int old = frames.size();
-		frames.resize(old + block);
-		int mixed = pb->mix(frames.ptrw() + old, 1.0f, block);
+	PackedByteArray pcm16;
+	int64_t pcm16_size = 0;
+	int64_t total_input_frames = 0;
+	int64_t total_output_frames = 0;
+
+	while (pb->is_playing()) {
+		const int mixed = pb->mix(frames.ptr(), 1.0f, block);
 
 		if (mixed <= 0) {
-			frames.resize(old + mixed);
 			break;
 		}
-	}
-
-	ERR_FAIL_COND_V(frames.is_empty(), out);
-
-	// Convert AudioFrame to float PCM
-	PackedFloat32Array input;
-	input.resize(frames.size() * channels);
-	float *input_w = input.ptrw();
 
-	for (int i = 0; i < frames.size(); i++) {
-		if (channels == 2) {
-			input_w[i * 2 + 0] = frames[i].left;
-			input_w[i * 2 + 1] = frames[i].right;
-		} else {
-			input_w[i] = frames[i].left;
+		for (int i = 0; i < mixed; i++) {
+			input_ptrs[0][i] = frames[i].left;
+			if (stream_channels == 2) {
+				input_ptrs[1][i] = frames[i].right;
+			}
 		}
-	}
-
-	set_sample_rate(sample_rate);
-	set_channels(channels);
-	set_tempo(p_tempo);
-	set_pitch(p_pitch);
-
-	reset();
 
-	PackedFloat32Array processed = process(input);
-	ERR_FAIL_COND_V(processed.is_empty(), out);
+		// Derive each block's output size from the running totals so rounding doesn't drift.
+		total_input_frames += mixed;
+		const int output_frames = (int)(std::llround((double)total_input_frames / (double)tempo) - total_output_frames);
+		total_output_frames += output_frames;
 
-	// convert float pcm to pcm16
-	PackedByteArray pcm16;
-	pcm16.resize(processed.size() * 2);
-	uint8_t *pcm_w = pcm16.ptrw();
+		stretch.process(input_ptrs.ptr(), mixed, output_ptrs.ptr(), output_frames);
 
-	const float *proc_r = processed.ptr();
+		// Convert float PCM to PCM16.
+		const int64_t samples = (int64_t)output_frames * stream_channels;
+		if (pcm16.size() < (pcm16_size + samples) * 2) {
+			pcm16.resize(next_power_of_2(uint64_t((pcm16_size + samples) * 2)));
+		}
+		uint8_t *pcm_w = pcm16.ptrw() + pcm16_size * 2;
 
-	for (int i = 0; i < processed.size(); i++) {
-		float s = CLAMP(proc_r[i], -1.0f, 1.0f);
-		int16_t v = int16_t(s * 32767.0f);
+		for (int i = 0; i < output_frames; i++) {
+			for (int c = 0; c < stream_channels; c++) {
+				float s = CLAMP(output_ptrs[c][i], -1.0f, 1.0f);
+				int16_t v = int16_t(s * 32767.0f);
 
-		pcm_w[i * 2 + 0] = uint8_t(v & 0xff);
-		pcm_w[i * 2 + 1] = uint8_t((v >> 8) & 0xff);
+				*pcm_w++ = uint8_t(v & 0xff);
+				*pcm_w++ = uint8_t((v >> 8) & 0xff);
+			}
+		}
+		pcm16_size += samples;
 	}
 
+	ERR_FAIL_COND_V(pcm16_size == 0, out);
+	pcm16.resize(pcm16_size * 2);
+
 	// Builds a streamable WAV
 	out.instantiate();
-	out->set_mix_rate(sample_rate);
-	out->set_stereo(channels == 2);
+	out->set_mix_rate(stream_sample_rate);
+	out->set_stereo(stream_channels == 2);
 	out->set_format(AudioStreamWAV::FORMAT_16_BITS);
 	out->set_data(pcm16);
 
@@ -40,6 +40,7 @@
 
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "scene/resources/audio_stream_wav.h"
 #include "signalsmith-stretch/signalsmith-stretch.h"
 #include <random>
@@ -53,6 +54,14 @@ private:
 	int channels = 2;
 	float tempo = 1.0f;
 
+	// Planar channel buffers, kept between calls so processing only allocates when a block outgrows them.
+	LocalVector<float> input_buffer;
+	LocalVector<float> output_buffer;
+	LocalVector<float *> input_ptrs;
+	LocalVector<float *> output_ptrs;
+
+	void _reserve_buffers(int p_input_frames, int p_output_frames);
+
 protected:
 	static void _bind_methods();
 
@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*  test_audio_stream_time_stretch.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file test_audio_stream_time_stretch.h
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "../audio_stream_time_stretch.h"
+
+#include "core/io/marshalls.h"
+#include "core/math/math_funcs.h"
+#include "scene/resources/audio_stream_wav.h"
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStreamTimeStretch {
+
+// A 440 Hz mono sine at the mix rate, so the source itself is never resampled.
+static Ref<AudioStreamWAV> make_sine_stream(float p_seconds) {
+	const float mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	const int frames = int(mix_rate * p_seconds);
+
+	Vector<uint8_t> data;
+	data.resize(frames * 2);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < frames; i++) {
+		const float sample = Math::sin(Math::TAU * 440.0f * i / mix_rate) * 0.5f;
+		encode_uint16(uint16_t(int16_t(sample * INT16_MAX)), w + i * 2);
+	}
+
+	Ref<AudioStreamWAV> wav;
+	wav.instantiate();
+	wav->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	wav->set_mix_rate(mix_rate);
+	wav->set_stereo(false);
+	wav->set_data(data);
+	return wav;
+}
+
+// Mixes until the playback stops, returns the number of frames it produced.
+static int mix_until_stopped(const Ref<AudioStreamPlayback> &p_playback, LocalVector<AudioFrame> *r_output = nullptr) {
+	const int chunk = 256;
+	AudioFrame buffer[chunk];
+	int total = 0;
+	// Bounded, so a playback that never ends fails instead of hanging.
+	for (int i = 0; i < 10000 && p_playback->is_playing(); i++) {
+		const int mixed = p_playback->mix(buffer, 1.0f, chunk);
+		for (int j = 0; r_output && j < mixed; j++) {
+			r_output->push_back(buffer[j]);
+		}
+		total += mixed;
+	}
+	return total;
+}
+
+TEST_CASE("[Modules][Audio][AudioStreamTimeStretch] Tempo changes the length but not the pitch") {
+	const float mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	Ref<AudioStreamWAV> wav = make_sine_stream(1.0f);
+
+	Ref<AudioStreamTimeStretch> stretch;
+	stretch.instantiate();
+	stretch->set_stream(wav);
+	stretch->set_tempo(2.0f);
+	CHECK(stretch->get_length() == doctest::Approx(wav->get_length() / 2.0));
+
+	Ref<AudioStreamPlayback> playback = stretch->instantiate_playback();
+	REQUIRE(playback.is_valid());
+	playback->start();
+
+	LocalVector<AudioFrame> output;
+	const int total = mix_until_stopped(playback, &output);
+	CHECK_FALSE(playback->is_playing());
+
+	// Half the source, plus what the stretcher still held when the source ended.
+	const int expected = int(mix_rate / 2.0f);
+	CHECK(total >= expected);
+	CHECK(total <= expected + int(mix_rate * 0.5f));
+
+	// Away from the latency at both ends, the sine must still be at 440 Hz.
+	const int from = total / 4;
+	const int to = total - total / 4;
+	int crossings = 0;
+	for (int i = from + 1; i < to; i++) {
+		if ((output[i - 1].left < 0.0f) != (output[i].left < 0.0f)) {
+			crossings++;
+		}
+	}
+	const float frequency = crossings / 2.0f / ((to - from) / mix_rate);
+	CHECK(frequency == doctest::Approx(440.0f).epsilon(0.05));
+}
+
+TEST_CASE("[Modules][Audio][AudioStreamTimeStretch] Seeking while the tail is flushed plays the source again") {
+	const float mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	Ref<AudioStreamWAV> wav = make_sine_stream(0.25f);
+	const int source_frames = int(mix_rate * 0.25f);
+
+	Ref<AudioStreamTimeStretch> stretch;
+	stretch.instantiate();
+	stretch->set_stream(wav);
+
+	Ref<AudioStreamPlayback> playback = stretch->instantiate_playback();
+	REQUIRE(playback.is_valid());
+	playback->start();
+
+	// At the original tempo, this reads the whole source. The stretcher's latency keeps it playing.
+	LocalVector<AudioFrame> buffer;
+	buffer.resize(source_frames + 512);
+	playback->mix(buffer.ptr(), 1.0f, buffer.size());
+	REQUIRE(playback->is_playing());
+
+	playback->seek(0.0);
+	CHECK(mix_until_stopped(playback) >= source_frames);
+}
+
+TEST_CASE("[Modules][Audio][AudioStreamTimeStretch] Playback stops once the source and the tail are done") {
+	const float mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	Ref<AudioStreamTimeStretch> stretch;
+	stretch.instantiate();
+	stretch->set_stream(make_sine_stream(0.1f));
+	stretch->set_tempo(0.5f);
+
+	Ref<AudioStreamPlayback> playback = stretch->instantiate_playback();
+	REQUIRE(playback.is_valid());
+	playback->start();
+
+	const int total = mix_until_stopped(playback);
+	CHECK_FALSE(playback->is_playing());
+	CHECK(total >= int(mix_rate * 0.2f));
+	CHECK(total <= int(mix_rate * 0.2f) + int(mix_rate * 0.5f));
+
+	// A stopped playback only outputs silence.
+	AudioFrame buffer[64];
+	CHECK(playback->mix(buffer, 1.0f, 64) == 0);
+	for (const AudioFrame &frame : buffer) {
+		CHECK(frame.left == 0.0f);
+		CHECK(frame.right == 0.0f);
+	}
+}
+
+} // namespace TestAudioStreamTimeStretch
@@ -52,9 +52,15 @@ static Ref<Image> _webp_mem_loader_func(const uint8_t *p_webp_data, int p_size)
 }
 
 Error ImageLoaderWebP::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale) {
-	Vector<uint8_t> src_image;
 	uint64_t src_image_len = f->get_length();
 	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
+
+	Span<uint8_t> view = f->get_buffer_view(src_image_len);
+	if (!view.is_empty()) {
+		return WebPCommon::webp_load_image_from_buffer(p_image.ptr(), view.ptr(), src_image_len);
+	}
+
+	Vector<uint8_t> src_image;
 	src_image.resize(src_image_len);
 
 	uint8_t *w = src_image.ptrw();
@@ -75,4 +81,5 @@ ImageLoaderWebP::ImageLoaderWebP() {
 	Image::webp_lossy_packer = WebPCommon::_webp_lossy_pack;
 	Image::webp_lossless_packer = WebPCommon::_webp_lossless_pack;
 	Image::webp_unpacker = WebPCommon::_webp_unpack;
+	Image::_webp_mem_unpacker_func = WebPCommon::_webp_unpack_mem;
 }
@@ -49,6 +49,7 @@ Vector<uint8_t> _webp_lossless_pack(const Ref<Image> &p_image);
 Vector<uint8_t> _webp_packer(const Ref<Image> &p_image, float p_quality, bool p_lossless);
 /// Given a WebP file, unpack it into an image.
 Ref<Image> _webp_unpack(const Vector<uint8_t> &p_buffer);
+Ref<Image> _webp_unpack_mem(const uint8_t *p_buffer, int p_size);
 Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len);
 /// Given a WebP file, unpack it into image frames.
 Error webp_load_image_frames_from_buffer(ImageFrames *p_frames, const uint8_t *p_buffer, int p_buffer_len, int p_max_frames);
@@ -64,6 +64,9 @@ void WebSocketMultiplayerPeer::_clear() {
 	unique_id = 0;
 	peers_map.clear();
 	tcp_server.unref();
+	poller.unref();
+	peer_sockets.clear();
+	ready_peers.clear();
 	pending_peers.clear();
 	tls_server_options.unref();
 	if (current_packet.data != nullptr) {
@@ -196,6 +199,8 @@ Error WebSocketMultiplayerPeer::create_server(int p_port, IPAddress p_bind_ip, R
 		tcp_server.unref();
 		return err;
 	}
+	poller = NetSocketPoller::create();
+	poller->add_socket(tcp_server->get_socket(), LISTENER_POLL_ID, NetSocketPoller::EVENT_IN);
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	tls_server_options = p_options;
@@ -287,13 +292,28 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	ERR_FAIL_COND(connection_status != CONNECTION_CONNECTED); // Bug.
 	ERR_FAIL_COND(tcp_server.is_null() || !tcp_server->is_listening()); // Bug.
 
+	// Collect activity on the listening socket and on every connected peer with a single call.
+	bool connection_available = false;
+	ready_peers.clear();
+	if (poller->wait(0, poller_events) == OK) {
+		for (const NetSocketPoller::Event &ev : poller_events) {
+			if (ev.id == LISTENER_POLL_ID) {
+				connection_available = true;
+			} else {
+				ready_peers.insert((int)ev.id);
+			}
+		}
+	}
+
 	// Accept new connections.
-	if (!is_refusing_new_connections() && tcp_server->is_connection_available()) {
+	if (connection_available && !is_refusing_new_connections()) {
 		PendingPeer peer;
 		peer.time = OS::get_singleton()->get_ticks_msec();
 		peer.tcp = tcp_server->take_connection();
-		peer.connection = peer.tcp;
-		pending_peers[generate_unique_id()] = peer;
+		if (peer.tcp.is_valid()) {
+			peer.connection = peer.tcp;
+			pending_peers[generate_unique_id()] = peer;
+		}
 	}
 
 	// Process pending peers.
@@ -322,6 +342,13 @@ void WebSocketMultiplayerPeer::_poll_server() {
 				Error err = peer.ws->put_packet((const uint8_t *)&peer_id, sizeof(peer_id));
 				if (err == OK) {
 					peers_map[id] = peer.ws;
+					if (peer.connection == peer.tcp) {
+						// TLS peers are always polled, as they can buffer data the socket no longer reports.
+						Ref<NetSocket> sock = peer.tcp->get_socket();
+						if (poller->add_socket(sock, id, NetSocketPoller::EVENT_IN) == OK) {
+							peer_sockets[id] = sock;
+						}
+					}
 					emit_signal("peer_connected", id);
 				} else {
 					ERR_PRINT("Failed to send ID to newly connected peer.");
@@ -377,7 +404,9 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	for (KeyValue<int, Ref<WebSocketPeer>> &E : peers_map) {
 		Ref<WebSocketPeer> ws = E.value;
 		int id = E.key;
-		ws->poll();
+		if (!peer_sockets.has(id) || ready_peers.has(id) || ws->is_poll_needed()) {
+			ws->poll();
+		}
 		if (ws->get_ready_state() != WebSocketPeer::STATE_OPEN) {
 			to_remove.insert(id); // Disconnected.
 			continue;
@@ -404,10 +433,22 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	// Remove disconnected peers.
 	for (const int &pid : to_remove) {
 		emit_signal(SNAME("peer_disconnected"), pid);
+		_remove_peer_socket(pid);
 		peers_map.erase(pid);
 	}
 }
 
+void WebSocketMultiplayerPeer::_remove_peer_socket(int p_peer_id) {
+	HashMap<int, Ref<NetSocket>>::Iterator E = peer_sockets.find(p_peer_id);
+	if (!E) {
+		return;
+	}
+	if (poller.is_valid()) {
+		poller->remove_socket(E->value);
+	}
+	peer_sockets.remove(E);
+}
+
 void WebSocketMultiplayerPeer::poll() {
 	if (connection_status == CONNECTION_DISCONNECTED) {
 		return;
@@ -491,6 +532,7 @@ void WebSocketMultiplayerPeer::disconnect_peer(int p_peer_id, bool p_force) {
 	ERR_FAIL_COND(!peers_map.has(p_peer_id));
 	peers_map[p_peer_id]->close();
 	if (p_force) {
+		_remove_peer_socket(p_peer_id);
 		peers_map.erase(p_peer_id);
 		if (!is_server()) {
 			_clear();
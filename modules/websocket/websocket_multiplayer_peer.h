@@ -40,6 +40,7 @@
 
 #include "websocket_peer.h"
 
+#include "core/io/net_socket_poller.h"
 #include "core/io/tcp_server.h"
 #include "core/templates/list.h"
 #include "scene/main/multiplayer_peer.h"
@@ -60,6 +61,8 @@ protected:
 		PROTO_SIZE = 9
 	};
 
+	static constexpr uint64_t LISTENER_POLL_ID = 0; // Peer IDs are always positive.
+
 	struct Packet {
 		int source = 0;
 		uint8_t *data = nullptr;
@@ -79,6 +82,12 @@ protected:
 	Ref<TCPServer> tcp_server;
 	Ref<TLSOptions> tls_server_options;
 
+	// Server only, lets idle peers be skipped instead of polling every socket each frame.
+	Ref<NetSocketPoller> poller;
+	HashMap<int, Ref<NetSocket>> peer_sockets;
+	HashSet<int> ready_peers;
+	LocalVector<NetSocketPoller::Event> poller_events;
+
 	ConnectionStatus connection_status = CONNECTION_DISCONNECTED;
 
 	List<Packet> incoming_packets;
@@ -92,6 +101,7 @@ protected:
 
 	void _poll_client();
 	void _poll_server();
+	void _remove_peer_socket(int p_peer_id);
 	void _clear();
 
 public:
@@ -103,6 +103,8 @@ public:
 	virtual String get_requested_url() const = 0;
 
 	virtual void poll() = 0;
+	/// Whether poll() has work to do even when the underlying socket reported no activity (handshakes, queued data, heartbeats).
+	virtual bool is_poll_needed() const { return true; }
 	virtual State get_ready_state() const = 0;
 	virtual int get_close_code() const = 0;
 	virtual String get_close_reason() const = 0;
@@ -786,6 +786,17 @@ void WSLPeer::poll() {
 	}
 }
 
+bool WSLPeer::is_poll_needed() const {
+	// TLS may hold decrypted data that the socket no longer reports as readable.
+	if (ready_state != STATE_OPEN || !wsl_ctx || connection != tcp) {
+		return true;
+	}
+	if (wslay_event_want_write(wsl_ctx)) {
+		return true;
+	}
+	return heartbeat_interval_msec != 0 && OS::get_singleton()->get_ticks_msec() - last_heartbeat > heartbeat_interval_msec;
+}
+
 Error WSLPeer::_send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_opcode) {
 	ERR_FAIL_COND_V(ready_state != STATE_OPEN, FAILED);
 	ERR_FAIL_COND_V(wslay_event_get_queued_msg_count(wsl_ctx) >= (uint32_t)max_queued_packets, ERR_OUT_OF_MEMORY);
@@ -164,6 +164,7 @@ public:
 	virtual Error accept_stream(Ref<StreamPeer> p_stream) override;
 	virtual void close(int p_code = 1000, String p_reason = "") override;
 	virtual void poll() override;
+	virtual bool is_poll_needed() const override;
 
 	virtual State get_ready_state() const override { return ready_state; }
 	virtual int get_close_code() const override { return close_code; }
@@ -52,7 +52,7 @@
 #include "scene/resources/packed_scene.h"
 #include "viewport.h"
 
-int Node::orphan_node_count = 0;
+SafeNumeric<int> Node::orphan_node_count;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
 
@@ -173,7 +173,7 @@ void Node::_notification(int p_notification) {
 			}
 
 			data.tree->nodes_in_tree_count++;
-			orphan_node_count--;
+			orphan_node_count.decrement();
 
 		} break;
 
@@ -201,7 +201,7 @@ void Node::_notification(int p_notification) {
 			}
 
 			data.tree->nodes_in_tree_count--;
-			orphan_node_count++;
+			orphan_node_count.increment();
 
 			if (data.input) {
 				remove_from_group("_vp_input" + itos(get_viewport()->get_instance_id()));
@@ -902,35 +902,6 @@ bool Node::can_process() const {
 	return !data.tree->is_suspended() && _can_process(data.tree->is_paused());
 }
 
-bool Node::_can_process(bool p_paused) const {
-	ProcessMode process_mode;
-
-	if (data.process_mode == PROCESS_MODE_INHERIT) {
-		if (!data.process_owner) {
-			process_mode = PROCESS_MODE_PAUSABLE;
-		} else {
-			process_mode = data.process_owner->data.process_mode;
-		}
-	} else {
-		process_mode = data.process_mode;
-	}
-
-	// The owner can't be set to inherit, must be a bug.
-	ERR_FAIL_COND_V(process_mode == PROCESS_MODE_INHERIT, false);
-
-	if (process_mode == PROCESS_MODE_DISABLED) {
-		return false;
-	} else if (process_mode == PROCESS_MODE_ALWAYS) {
-		return true;
-	}
-
-	if (p_paused) {
-		return process_mode == PROCESS_MODE_WHEN_PAUSED;
-	} else {
-		return process_mode == PROCESS_MODE_PAUSABLE;
-	}
-}
-
 void Node::set_physics_interpolation_mode(PhysicsInterpolationMode p_mode) {
 	ERR_THREAD_GUARD
 	if (data.physics_interpolation_mode == p_mode) {
@@ -4121,7 +4092,7 @@ String Node::_get_name_num_separator() {
 }
 
 Node::Node() {
-	orphan_node_count++;
+	orphan_node_count.increment();
 
 	// Default member initializer for bitfield is a C++20 extension, so:
 
@@ -4170,7 +4141,7 @@ Node::~Node() {
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children_cache.size());
 
-	orphan_node_count--;
+	orphan_node_count.decrement();
 }
 
 ////////////////////////////////
@@ -136,7 +136,7 @@ public:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->is_greater_than(p_a); }
 	};
 
-	static int orphan_node_count;
+	static SafeNumeric<int> orphan_node_count; ///< Nodes can be created on any thread while outside of the tree.
 
 	void _update_process(bool p_enable, bool p_for_children);
 
@@ -366,6 +366,16 @@ protected:
 
 	virtual void _physics_interpolated_changed();
 
+	/// Native classes with many processing instances can return a function handling
+	/// NOTIFICATION_PROCESS (or NOTIFICATION_PHYSICS_PROCESS if `p_physics` is true) for a
+	/// batch of nodes. Nodes that are adjacent in process order and return the same callback
+	/// are then processed with a single call instead of a notification each, see
+	/// SceneTree::_process_group(). Nodes with a script or GDExtension instance attached, or
+	/// with internal processing enabled, keep receiving the notification. Whether each node can
+	/// process is checked right before the call, the callback itself must handle nodes that
+	/// stop processing or leave the tree while the batch is running.
+	virtual SceneTree::ProcessBatchCallback _get_process_batch_callback(bool p_physics) const { return nullptr; }
+
 	virtual void add_child_notify(Node *p_child);
 	virtual void remove_child_notify(Node *p_child);
 	virtual void move_child_notify(Node *p_child);
@@ -888,6 +898,36 @@ public:
 	~Node();
 };
 
+// Inlined in SceneTree::_process_group(), which calls it for every processed node.
+_FORCE_INLINE_ bool Node::_can_process(bool p_paused) const {
+	ProcessMode process_mode;
+
+	if (data.process_mode == PROCESS_MODE_INHERIT) {
+		if (!data.process_owner) {
+			process_mode = PROCESS_MODE_PAUSABLE;
+		} else {
+			process_mode = data.process_owner->data.process_mode;
+		}
+	} else {
+		process_mode = data.process_mode;
+	}
+
+	// The owner can't be set to inherit, must be a bug.
+	ERR_FAIL_COND_V(process_mode == PROCESS_MODE_INHERIT, false);
+
+	if (process_mode == PROCESS_MODE_DISABLED) {
+		return false;
+	} else if (process_mode == PROCESS_MODE_ALWAYS) {
+		return true;
+	}
+
+	if (p_paused) {
+		return process_mode == PROCESS_MODE_WHEN_PAUSED;
+	} else {
+		return process_mode == PROCESS_MODE_PAUSABLE;
+	}
+}
+
 VARIANT_ENUM_CAST(Node::DuplicateFlags);
 VARIANT_ENUM_CAST(Node::ProcessMode);
 VARIANT_ENUM_CAST(Node::ProcessThreadGroup);
@@ -0,0 +1,294 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file scene_pool.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "scene_pool.h"
+
+#include "core/io/resource.h"
+#include "scene/main/scene_tree.h"
+
+Node *ScenePool::_create_instance() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "No scene set for this pool.");
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+	if (!reset_captured) {
+		_capture_reset_state(node);
+	}
+	return node;
+}
+
+void ScenePool::_capture_reset_state(Node *p_instance) {
+	reset_nodes.clear();
+	reset_captured = true;
+
+	Ref<SceneState> state = scene->get_state();
+	for (int i = 0; i < state->get_node_count(); i++) {
+		ResetNode reset_node;
+		reset_node.path = state->get_node_path(i);
+		Node *node = p_instance->get_node_or_null(reset_node.path);
+		if (!node) {
+			continue;
+		}
+
+		List<PropertyInfo> properties;
+		node->get_property_list(&properties);
+		for (const PropertyInfo &E : properties) {
+			if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringName(script)) {
+				continue;
+			}
+			Variant value = node->get(E.name);
+			if (value.get_type() == Variant::OBJECT) {
+				// References to other nodes and resources made unique to this instance can't be shared with the others.
+				Object *obj = value;
+				if (Object::cast_to<Node>(obj)) {
+					continue;
+				}
+				Resource *res = Object::cast_to<Resource>(obj);
+				if (obj && (!res || res->is_local_to_scene())) {
+					continue;
+				}
+			}
+			reset_node.properties.push_back({ E.name, value });
+		}
+
+		if (!reset_node.properties.is_empty()) {
+			reset_nodes.push_back(reset_node);
+		}
+	}
+}
+
+void ScenePool::_reset(Node *p_node) {
+	for (const ResetNode &reset_node : reset_nodes) {
+		Node *node = p_node->get_node_or_null(reset_node.path);
+		if (!node) {
+			continue;
+		}
+		for (const ResetProperty &property : reset_node.properties) {
+			bool valid = false;
+			const Variant current = node->get(property.name, &valid);
+			if (valid && current != property.value) {
+				node->set(property.name, property.value);
+			}
+		}
+	}
+}
+
+void ScenePool::_recycle(Node *p_node) {
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+
+	if ((int)available.size() >= max_size) {
+		memdelete(p_node);
+		return;
+	}
+
+	_reset(p_node);
+	available.push_back(p_node->get_instance_id());
+}
+
+void ScenePool::_recycle_queued(Node *p_node) {
+	if (!recycling.erase(p_node->get_instance_id())) {
+		// Released before the scene changed, it can't be reused for the new one.
+		memdelete(p_node);
+		return;
+	}
+	_recycle(p_node);
+}
+
+Node *ScenePool::_pop_available() {
+	while (!available.is_empty()) {
+		const ObjectID id = available[available.size() - 1];
+		available.resize(available.size() - 1);
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			return node;
+		}
+	}
+	return nullptr;
+}
+
+void ScenePool::_prune_available() {
+	// Pooled nodes may have been freed through a reference kept from before they were released.
+	for (uint32_t i = 0; i < available.size();) {
+		if (ObjectDB::get_instance(available[i])) {
+			i++;
+		} else {
+			available.remove_at(i);
+		}
+	}
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+
+	// Instances of the previous scene can't come back to the pool, so they are freed like with queue_free().
+	for (const ObjectID &id : active) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (!node) {
+			continue;
+		}
+		if (node->is_inside_tree()) {
+			node->queue_free();
+		} else {
+			memdelete(node);
+		}
+	}
+	active.clear();
+	recycling.clear();
+	reset_nodes.clear();
+	reset_captured = false;
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+	_prune_available();
+	while ((int)available.size() > max_size) {
+		memdelete(_pop_available());
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	const int target = MIN(p_count, max_size);
+	_prune_available();
+	while ((int)available.size() < target) {
+		Node *node = _create_instance();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+	}
+}
+
+Node *ScenePool::acquire(Node *p_parent) {
+	Node *node = _pop_available();
+	if (node) {
+		// Behave like a fresh instance when entering the tree again.
+		node->request_ready();
+	} else {
+		node = _create_instance();
+		ERR_FAIL_NULL_V(node, nullptr);
+	}
+
+	active.insert(node->get_instance_id());
+	if (p_parent) {
+		p_parent->add_child(node);
+	}
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(!active.erase(p_node->get_instance_id()), "Node was not acquired from this pool, or was already released.");
+
+	if (p_node->is_inside_tree()) {
+		// Like queue_free(), leave the tree at the end of the frame rather than in the middle of processing.
+		recycling.insert(p_node->get_instance_id());
+		p_node->get_tree()->queue_recycle(p_node, this);
+	} else {
+		_recycle(p_node);
+	}
+}
+
+bool ScenePool::is_active(Node *p_node) const {
+	ERR_FAIL_NULL_V(p_node, false);
+	return active.has(p_node->get_instance_id());
+}
+
+int ScenePool::get_available_count() {
+	_prune_available();
+	return available.size();
+}
+
+int ScenePool::get_active_count() {
+	// Acquired nodes may have been freed instead of released.
+	LocalVector<ObjectID> freed;
+	for (const ObjectID &id : active) {
+		if (!ObjectDB::get_instance(id)) {
+			freed.push_back(id);
+		}
+	}
+	for (const ObjectID &id : freed) {
+		active.erase(id);
+	}
+	return active.size();
+}
+
+void ScenePool::clear() {
+	for (const ObjectID &id : available) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+	available.clear();
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("acquire", "parent"), &ScenePool::acquire, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("is_active", "node"), &ScenePool::is_active);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("get_active_count"), &ScenePool::get_active_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
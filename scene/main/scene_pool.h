@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  scene_pool.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file scene_pool.h
+ *
+ * Recycles instances of a PackedScene instead of freeing and re-instantiating them.
+ */
+
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "scene/resources/packed_scene.h"
+
+class ScenePool : public RefCounted {
+	GDCLASS(ScenePool, RefCounted);
+
+	struct ResetProperty {
+		StringName name;
+		Variant value;
+	};
+
+	/// Stored properties of one node of the scene, as they are right after instantiation.
+	struct ResetNode {
+		NodePath path;
+		LocalVector<ResetProperty> properties;
+	};
+
+	Ref<PackedScene> scene;
+	int max_size = 64;
+
+	// Nodes are tracked by ID, they can be freed by user code while acquired or waiting in the pool.
+	LocalVector<ObjectID> available;
+	HashSet<ObjectID> active;
+	HashSet<ObjectID> recycling; ///< Released from the tree, waiting for the end of the frame.
+	LocalVector<ResetNode> reset_nodes;
+	bool reset_captured = false;
+
+	Node *_create_instance();
+	void _capture_reset_state(Node *p_instance);
+	void _reset(Node *p_node);
+	void _recycle(Node *p_node);
+	void _recycle_queued(Node *p_node);
+	Node *_pop_available();
+	void _prune_available();
+
+	friend class SceneTree;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_size(int p_max_size);
+	int get_max_size() const;
+
+	void prewarm(int p_count);
+	Node *acquire(Node *p_parent = nullptr);
+	void release(Node *p_node);
+	bool is_active(Node *p_node) const;
+
+	int get_available_count();
+	int get_active_count();
+	void clear();
+
+	~ScenePool();
+};
@@ -39,6 +39,7 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/input/input.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
@@ -50,6 +51,7 @@
 #include "scene/debugger/scene_debugger.h"
 #include "scene/gui/control.h"
 #include "scene/main/multiplayer_api.h"
+#include "scene/main/scene_pool.h"
 #include "scene/main/viewport.h"
 #include "scene/main/window.h"
 #include "scene/resources/environment.h"
@@ -628,6 +630,8 @@ void SceneTree::iteration_prepare() {
 }
 
 bool SceneTree::physics_process(double p_time) {
+	TRACE_ZONE("SceneTree::physics_process");
+
 	current_frame++;
 
 	flush_transform_notifications();
@@ -677,6 +681,8 @@ void SceneTree::iteration_end() {
 }
 
 bool SceneTree::process(double p_time) {
+	TRACE_ZONE("SceneTree::process");
+
 	// First pass of scene tree fixed timestep interpolation.
 	if (get_scene_tree_fti().is_enabled()) {
 		// Special, we need to ensure RenderingServer is up to date
@@ -1150,6 +1156,38 @@ bool SceneTree::is_suspended() const {
 	return suspended;
 }
 
+void SceneTree::_update_process_batch_callbacks(const Vector<Node *> &p_nodes, Vector<ProcessBatchCallback> &r_callbacks, bool p_physics) {
+	r_callbacks.resize(p_nodes.size());
+	ProcessBatchCallback *callbacks_ptr = r_callbacks.ptrw();
+	bool has_callbacks = false;
+	for (int i = 0; i < p_nodes.size(); i++) {
+		callbacks_ptr[i] = p_nodes[i]->_get_process_batch_callback(p_physics);
+		has_callbacks = has_callbacks || callbacks_ptr[i];
+	}
+	if (!has_callbacks) {
+		r_callbacks.clear();
+	}
+}
+
+void SceneTree::_flush_process_batch(ProcessGroup *p_group, ProcessBatchCallback p_callback, double p_delta, bool p_physics) {
+	LocalVector<Node *> &batch = p_group->batch;
+	// Checked again right before the call, like the per-node path does before each notification.
+	uint32_t count = 0;
+	for (Node *n : batch) {
+		if (nodes_removed_on_group_call.has(n) || !n->is_inside_tree() || !n->_can_process(paused)) {
+			continue;
+		}
+		if (p_physics ? !n->data.physics_process : !n->data.process) {
+			continue;
+		}
+		batch[count++] = n;
+	}
+	if (count > 0) {
+		p_callback(batch.ptr(), count, p_delta);
+	}
+	batch.clear();
+}
+
 void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	p_group->call_queue.flush(); // Flush messages before processing.
 
@@ -1158,23 +1196,37 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 		return;
 	}
 
+	Vector<ProcessBatchCallback> &batch_callbacks = p_physics ? p_group->physics_batch_callbacks : p_group->batch_callbacks;
 	if (p_physics) {
 		if (p_group->physics_node_order_dirty) {
 			nodes.sort_custom<Node::ComparatorWithPhysicsPriority>();
+			_update_process_batch_callbacks(nodes, batch_callbacks, true);
 			p_group->physics_node_order_dirty = false;
 		}
 	} else {
 		if (p_group->node_order_dirty) {
 			nodes.sort_custom<Node::ComparatorWithPriority>();
+			_update_process_batch_callbacks(nodes, batch_callbacks, false);
 			p_group->node_order_dirty = false;
 		}
 	}
 
-	// Make a copy, so if nodes are added/removed from process, this does not break
+	if (suspended) {
+		p_group->call_queue.flush();
+		return;
+	}
+
+	// Make a copy, so if nodes are added/removed from process, this does not break.
+	// Both arrays are only written to when nodes change, so this is usually just a reference.
 	Vector<Node *> nodes_copy = nodes;
+	Vector<ProcessBatchCallback> batch_callbacks_copy = batch_callbacks;
 
 	uint32_t node_count = nodes_copy.size();
 	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+	const ProcessBatchCallback *callbacks_ptr = batch_callbacks_copy.is_empty() ? nullptr : batch_callbacks_copy.ptr();
+
+	const double delta = p_physics ? physics_process_time : process_time;
+	ProcessBatchCallback batch_callback = nullptr;
 
 	for (uint32_t i = 0; i < node_count; i++) {
 		Node *n = nodes_ptr[i];
@@ -1184,27 +1236,53 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			continue;
 		}
 
-		if (!n->can_process() || !n->is_inside_tree()) {
+		if (!n->is_inside_tree() || !n->_can_process(paused)) {
 			continue;
 		}
 
+		// Nodes with internal processing aren't batched, so that every node still gets its internal
+		// notification right before its process one, and nothing else runs while a batch is gathered.
+		ProcessBatchCallback callback = nullptr;
+		if (callbacks_ptr && callbacks_ptr[i] && !n->get_script_instance() && !n->_get_extension() &&
+				!(p_physics ? n->data.physics_process_internal : n->data.process_internal)) {
+			callback = callbacks_ptr[i];
+		}
+		if (callback != batch_callback) {
+			if (batch_callback) {
+				_flush_process_batch(p_group, batch_callback, delta, p_physics);
+			}
+			batch_callback = callback;
+		}
+
 		if (p_physics) {
-			if (n->is_physics_processing_internal()) {
+			if (n->data.physics_process_internal) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 			}
-			if (n->is_physics_processing()) {
-				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
+			if (n->data.physics_process) {
+				if (callback) {
+					p_group->batch.push_back(n);
+				} else {
+					n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
+				}
 			}
 		} else {
-			if (n->is_processing_internal()) {
+			if (n->data.process_internal) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
 			}
-			if (n->is_processing()) {
-				n->notification(Node::NOTIFICATION_PROCESS);
+			if (n->data.process) {
+				if (callback) {
+					p_group->batch.push_back(n);
+				} else {
+					n->notification(Node::NOTIFICATION_PROCESS);
+				}
 			}
 		}
 	}
 
+	if (batch_callback) {
+		_flush_process_batch(p_group, batch_callback, delta, p_physics);
+	}
+
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
@@ -1375,13 +1453,22 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		bool found = pg->nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		int64_t index = pg->nodes.find(p_node);
+		ERR_FAIL_COND(index < 0);
+		pg->nodes.remove_at(index);
+		// Keep the batch callbacks in sync, as the order doesn't change.
+		if (!pg->node_order_dirty && !pg->batch_callbacks.is_empty()) {
+			pg->batch_callbacks.remove_at(index);
+		}
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		bool found = pg->physics_nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		int64_t index = pg->physics_nodes.find(p_node);
+		ERR_FAIL_COND(index < 0);
+		pg->physics_nodes.remove_at(index);
+		if (!pg->physics_node_order_dirty && !pg->physics_batch_callbacks.is_empty()) {
+			pg->physics_batch_callbacks.remove_at(index);
+		}
 	}
 }
 
@@ -1604,6 +1691,22 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 void SceneTree::_flush_delete_queue() {
 	_THREAD_SAFE_METHOD_
 
+	// Recycled nodes go first, so they leave the tree at the same point as deleted ones.
+	while (recycle_queue.size()) {
+		const RecycleRequest request = recycle_queue.front()->get();
+		recycle_queue.pop_front();
+		Node *node = ObjectDB::get_instance<Node>(request.node);
+		if (!node) {
+			continue;
+		}
+		ScenePool *pool = ObjectDB::get_instance<ScenePool>(request.pool);
+		if (pool) {
+			pool->_recycle_queued(node);
+		} else {
+			memdelete(node);
+		}
+	}
+
 	while (delete_queue.size()) {
 		Object *obj = ObjectDB::get_instance(delete_queue.front()->get());
 		if (obj) {
@@ -1620,6 +1723,13 @@ void SceneTree::queue_delete(Object *p_object) {
 	delete_queue.push_back(p_object->get_instance_id());
 }
 
+void SceneTree::queue_recycle(Node *p_node, ScenePool *p_pool) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_NULL(p_pool);
+	recycle_queue.push_back({ p_node->get_instance_id(), p_pool->get_instance_id() });
+}
+
 int SceneTree::get_node_count() const {
 	return nodes_in_tree_count;
 }
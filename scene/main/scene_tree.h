@@ -54,6 +54,7 @@ class Node;
 #ifndef _3D_DISABLED
 class Node3D;
 #endif
+class ScenePool;
 class Window;
 class Material;
 class Mesh;
@@ -96,6 +97,7 @@ class SceneTree : public MainLoop {
 
 public:
 	typedef void (*IdleCallback)();
+	typedef void (*ProcessBatchCallback)(Node *const *p_nodes, uint32_t p_count, double p_delta);
 
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
@@ -104,6 +106,11 @@ private:
 		CallQueue call_queue;
 		Vector<Node *> nodes;
 		Vector<Node *> physics_nodes;
+		/// Batch callbacks of `nodes` and `physics_nodes`, index for index, rebuilt when they are sorted.
+		/// Empty when none of the nodes has one.
+		Vector<ProcessBatchCallback> batch_callbacks;
+		Vector<ProcessBatchCallback> physics_batch_callbacks;
+		LocalVector<Node *> batch; ///< Nodes gathered for the current batch callback.
 		bool node_order_dirty = true;
 		bool physics_node_order_dirty = true;
 		bool removed = false;
@@ -196,6 +203,12 @@ private:
 
 	List<ObjectID> delete_queue;
 
+	struct RecycleRequest {
+		ObjectID node;
+		ObjectID pool;
+	};
+	List<RecycleRequest> recycle_queue;
+
 	uint64_t accessibility_upd_per_sec = 0;
 	bool accessibility_force_update = true;
 	HashSet<ObjectID> accessibility_change_queue;
@@ -249,6 +262,8 @@ private:
 	/// When reading this function, keep in mind that this code must work in a way where
 	/// if any node is removed, this needs to continue working.
 	void _process_group(ProcessGroup *p_group, bool p_physics);
+	void _update_process_batch_callbacks(const Vector<Node *> &p_nodes, Vector<ProcessBatchCallback> &r_callbacks, bool p_physics);
+	void _flush_process_batch(ProcessGroup *p_group, ProcessBatchCallback p_callback, double p_delta, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
 
@@ -421,6 +436,7 @@ public:
 	int get_node_count() const;
 
 	void queue_delete(Object *p_object);
+	void queue_recycle(Node *p_node, ScenePool *p_pool);
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
 	Node *get_first_node_in_group(const StringName &p_group);
@@ -43,6 +43,7 @@
 #include "thirdparty/misc/qoa.h"
 
 class AudioStreamWAV;
+class FileAccess;
 
 class AudioStreamPlaybackWAV : public AudioStreamPlaybackResampled {
 	GDCLASS(AudioStreamPlaybackWAV, AudioStreamPlaybackResampled);
@@ -135,6 +136,8 @@ private:
 
 	Dictionary tags;
 
+	static Ref<AudioStreamWAV> _load_from_file_access(const Ref<FileAccess> &p_file, const Dictionary &p_options);
+
 protected:
 	static void _bind_methods();
 
@@ -329,18 +329,29 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
+			Ref<Image> img;
+			Span<uint8_t> view;
+			const ImageMemLoadFunc mem_unpacker = data_format == DATA_FORMAT_PNG ? Image::_png_mem_unpacker_func : Image::_webp_mem_unpacker_func;
+			if (mem_unpacker) {
+				// Decode straight out of the file when it is memory-mapped.
+				view = f->get_buffer_view(size);
 			}
 
-			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			if (!view.is_empty()) {
+				img = mem_unpacker(view.ptr(), size);
+			} else {
+				Vector<uint8_t> pv;
+				pv.resize(size);
+				{
+					uint8_t *wr = pv.ptrw();
+					f->get_buffer(wr, size);
+				}
+
+				if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+					img = Image::png_unpacker(pv);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+					img = Image::webp_unpacker(pv);
+				}
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -41,6 +41,7 @@
 #include "core/config/engine.h"
 #include "core/io/missing_resource.h"
 #include "core/io/resource_loader.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "scene/2d/node_2d.h"
 #include "scene/gui/control.h"
@@ -132,7 +133,67 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
-Node *SceneState::instantiate(GenEditState p_edit_state) const {
+struct SubSceneInstance {
+	Ref<PackedScene> scene;
+	int node = -1;
+	Node *result = nullptr;
+};
+
+static void _instantiate_sub_scene(void *p_userdata, uint32_t p_index) {
+	SubSceneInstance &instance = (*static_cast<LocalVector<SubSceneInstance> *>(p_userdata))[p_index];
+	instance.result = instance.scene->instantiate();
+}
+
+Node *SceneState::instantiate(GenEditState p_edit_state, bool p_parallel) const {
+	// Only at runtime, the editor states rely on instantiating everything in order (e.g. to fill `node_path_cache`).
+	// Waiting for other tasks from a pool thread could also run out of threads.
+	if (!p_parallel || p_edit_state != GEN_EDIT_STATE_DISABLED || WorkerThreadPool::get_singleton()->get_thread_index() != -1) {
+		return _instantiate(p_edit_state, nullptr);
+	}
+
+	// Nested scene instances don't depend on the nodes around them, they are built on the pool as separate
+	// subtrees, not inside any tree, and only attached to their parent by the usual serial pass.
+	LocalVector<SubSceneInstance> sub_scenes;
+	const NodeData *nd = nodes.ptr();
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nd[i];
+		if (n.instance < 0 || (n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) || (i == 0 && base_scene_idx >= 0) || (n.instance & FLAG_MASK) >= variants.size()) {
+			continue;
+		}
+		Ref<PackedScene> scene = variants[n.instance & FLAG_MASK];
+		if (scene.is_valid()) {
+			SubSceneInstance instance;
+			instance.scene = scene;
+			instance.node = i;
+			sub_scenes.push_back(instance);
+		}
+	}
+
+	if (sub_scenes.size() < uint32_t(PARALLEL_MIN_SUB_SCENES)) {
+		return _instantiate(p_edit_state, nullptr);
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_instantiate_sub_scene, &sub_scenes, sub_scenes.size(), -1, true, SNAME("InstantiateSubScenes"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	LocalVector<Node *> prebuilt;
+	prebuilt.resize_initialized(nodes.size());
+	for (const SubSceneInstance &instance : sub_scenes) {
+		prebuilt[instance.node] = instance.result;
+	}
+
+	Node *root = _instantiate(p_edit_state, &prebuilt);
+
+	// Instances left over when instantiation fails midway.
+	for (Node *node : prebuilt) {
+		if (node) {
+			memdelete(node);
+		}
+	}
+	return root;
+}
+
+Node *SceneState::_instantiate(GenEditState p_edit_state, LocalVector<Node *> *r_prebuilt) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
 
@@ -237,7 +298,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			} else {
 				Ref<Resource> res = props[n.instance & FLAG_MASK];
 				Ref<PackedScene> sdata = res;
-				if (sdata.is_valid()) {
+				if (r_prebuilt && (*r_prebuilt)[i]) {
+					node = (*r_prebuilt)[i];
+					(*r_prebuilt)[i] = nullptr;
+				} else if (sdata.is_valid()) {
 					node = sdata->instantiate(p_edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
 					ERR_FAIL_NULL_V_MSG(node, nullptr, vformat("Failed to load scene dependency: \"%s\". Make sure the required scene is valid.", sdata->get_path()));
 				} else if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
@@ -2213,12 +2277,12 @@ bool PackedScene::can_instantiate() const {
 	return state->can_instantiate();
 }
 
-Node *PackedScene::instantiate(GenEditState p_edit_state) const {
+Node *PackedScene::_instantiate(GenEditState p_edit_state, bool p_parallel) const {
 #ifndef TOOLS_ENABLED
 	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, nullptr, "Edit state is only for editors, does not work without tools compiled.");
 #endif
 
-	Node *s = state->instantiate((SceneState::GenEditState)p_edit_state);
+	Node *s = state->instantiate((SceneState::GenEditState)p_edit_state, p_parallel);
 	if (!s) {
 		return nullptr;
 	}
@@ -2236,6 +2300,14 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+Node *PackedScene::instantiate(GenEditState p_edit_state) const {
+	return _instantiate(p_edit_state, false);
+}
+
+Node *PackedScene::instantiate_parallel() const {
+	return _instantiate(GEN_EDIT_STATE_DISABLED, true);
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2322,6 +2394,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_parallel"), &PackedScene::instantiate_parallel);
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
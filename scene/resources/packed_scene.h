@@ -39,6 +39,7 @@
  */
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -141,6 +142,13 @@ public:
 		GEN_EDIT_STATE_MAIN_INHERITED,
 	};
 
+private:
+	/// `r_prebuilt` holds nested scene instances already created for some node indices, which are taken from it when used.
+	static constexpr int PARALLEL_MIN_SUB_SCENES = 2;
+
+	Node *_instantiate(GenEditState p_edit_state, LocalVector<Node *> *r_prebuilt) const;
+
+public:
 	struct PackState {
 		Ref<SceneState> state;
 		int node = -1;
@@ -166,7 +174,7 @@ public:
 	Error copy_from(const Ref<SceneState> &p_scene_state);
 
 	bool can_instantiate() const;
-	Node *instantiate(GenEditState p_edit_state) const;
+	Node *instantiate(GenEditState p_edit_state, bool p_parallel = false) const;
 
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_sub_scene, Node *node, const StringName sname, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_scene, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Dictionary setup_resources_in_dictionary(Dictionary &p_dictionary_to_scan, const SceneState::NodeData &p_n, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -264,12 +272,18 @@ public:
 		GEN_EDIT_STATE_MAIN_INHERITED,
 	};
 
+private:
+	Node *_instantiate(GenEditState p_edit_state, bool p_parallel) const;
+
+public:
 	Error pack(Node *p_scene);
 
 	void clear();
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	/// Same as `instantiate()`, creating the nested scene instances on the WorkerThreadPool.
+	Node *instantiate_parallel() const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -65,6 +65,10 @@ public:
 		return _buffer.size();
 	}
 
+	uint32_t get_capacity() const {
+		return _buffer.get_capacity();
+	}
+
 	bool is_empty() const {
 		return _buffer.is_empty();
 	}
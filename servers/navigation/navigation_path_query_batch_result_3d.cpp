@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*  navigation_path_query_batch_result_3d.cpp                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+/**
+ * @file navigation_path_query_batch_result_3d.cpp
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "navigation_path_query_batch_result_3d.h"
+
+void NavigationPathQueryBatchResult3D::set_path_points(const Vector<Vector3> &p_path_points) {
+	path_points = p_path_points;
+}
+
+const Vector<Vector3> &NavigationPathQueryBatchResult3D::get_path_points() const {
+	return path_points;
+}
+
+void NavigationPathQueryBatchResult3D::set_path_offsets(const Vector<int32_t> &p_path_offsets) {
+	path_offsets = p_path_offsets;
+}
+
+const Vector<int32_t> &NavigationPathQueryBatchResult3D::get_path_offsets() const {
+	return path_offsets;
+}
+
+void NavigationPathQueryBatchResult3D::set_path_lengths(const Vector<float> &p_path_lengths) {
+	path_lengths = p_path_lengths;
+}
+
+const Vector<float> &NavigationPathQueryBatchResult3D::get_path_lengths() const {
+	return path_lengths;
+}
+
+int NavigationPathQueryBatchResult3D::get_path_count() const {
+	return path_lengths.size();
+}
+
+Vector<Vector3> NavigationPathQueryBatchResult3D::get_path(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, get_path_count(), Vector<Vector3>());
+	ERR_FAIL_COND_V(path_offsets.size() != path_lengths.size() + 1, Vector<Vector3>());
+
+	const int32_t begin = path_offsets[p_index];
+	const int32_t end = path_offsets[p_index + 1];
+	ERR_FAIL_COND_V(begin < 0 || end < begin || end > path_points.size(), Vector<Vector3>());
+
+	return path_points.slice(begin, end);
+}
+
+float NavigationPathQueryBatchResult3D::get_path_length(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, get_path_count(), 0.0);
+	return path_lengths[p_index];
+}
+
+void NavigationPathQueryBatchResult3D::reset() {
+	path_points.clear();
+	path_offsets.clear();
+	path_lengths.clear();
+}
+
+void NavigationPathQueryBatchResult3D::resize(uint32_t p_path_count, uint32_t p_point_count, Vector3 **r_path_points, int32_t **r_path_offsets, float **r_path_lengths) {
+	path_points.resize(p_point_count);
+	path_offsets.resize(p_path_count + 1);
+	path_lengths.resize(p_path_count);
+
+	*r_path_points = path_points.ptrw();
+	*r_path_offsets = path_offsets.ptrw();
+	*r_path_lengths = path_lengths.ptrw();
+}
+
+void NavigationPathQueryBatchResult3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_path_points", "path_points"), &NavigationPathQueryBatchResult3D::set_path_points);
+	ClassDB::bind_method(D_METHOD("get_path_points"), &NavigationPathQueryBatchResult3D::get_path_points);
+
+	ClassDB::bind_method(D_METHOD("set_path_offsets", "path_offsets"), &NavigationPathQueryBatchResult3D::set_path_offsets);
+	ClassDB::bind_method(D_METHOD("get_path_offsets"), &NavigationPathQueryBatchResult3D::get_path_offsets);
+
+	ClassDB::bind_method(D_METHOD("set_path_lengths", "path_lengths"), &NavigationPathQueryBatchResult3D::set_path_lengths);
+	ClassDB::bind_method(D_METHOD("get_path_lengths"), &NavigationPathQueryBatchResult3D::get_path_lengths);
+
+	ClassDB::bind_method(D_METHOD("get_path_count"), &NavigationPathQueryBatchResult3D::get_path_count);
+	ClassDB::bind_method(D_METHOD("get_path", "index"), &NavigationPathQueryBatchResult3D::get_path);
+	ClassDB::bind_method(D_METHOD("get_path_length", "index"), &NavigationPathQueryBatchResult3D::get_path_length);
+
+	ClassDB::bind_method(D_METHOD("reset"), &NavigationPathQueryBatchResult3D::reset);
+
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR3_ARRAY, "path_points"), "set_path_points", "get_path_points");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "path_offsets"), "set_path_offsets", "get_path_offsets");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "path_lengths"), "set_path_lengths", "get_path_lengths");
+}
@@ -0,0 +1,73 @@
+/**************************************************************************/
+/*  navigation_path_query_batch_result_3d.h                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+/**
+ * @file navigation_path_query_batch_result_3d.h
+ *
+ * [Add any documentation that applies to the entire file here!]
+ */
+
+#include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+
+class NavigationPathQueryBatchResult3D : public RefCounted {
+	GDCLASS(NavigationPathQueryBatchResult3D, RefCounted);
+
+	// The points of all paths one after another, path `i` covers `path_offsets[i]` to `path_offsets[i + 1]`.
+	Vector<Vector3> path_points;
+	Vector<int32_t> path_offsets;
+	Vector<float> path_lengths;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_path_points(const Vector<Vector3> &p_path_points);
+	const Vector<Vector3> &get_path_points() const;
+
+	void set_path_offsets(const Vector<int32_t> &p_path_offsets);
+	const Vector<int32_t> &get_path_offsets() const;
+
+	void set_path_lengths(const Vector<float> &p_path_lengths);
+	const Vector<float> &get_path_lengths() const;
+
+	int get_path_count() const;
+	Vector<Vector3> get_path(int p_index) const;
+	float get_path_length(int p_index) const;
+
+	void reset();
+
+	/// Resizes the buffers for `p_path_count` paths with `p_point_count` points in total, to be filled through the pointers.
+	void resize(uint32_t p_path_count, uint32_t p_point_count, Vector3 **r_path_points, int32_t **r_path_offsets, float **r_path_lengths);
+};
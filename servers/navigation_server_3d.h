@@ -43,6 +43,7 @@
 
 #include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
 #include "scene/resources/navigation_mesh.h"
+#include "servers/navigation/navigation_path_query_batch_result_3d.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
 #include "servers/navigation/navigation_path_query_result_3d.h"
 
@@ -87,6 +88,12 @@ public:
 	virtual void map_set_use_edge_connections(RID p_map, bool p_enabled) = 0;
 	virtual bool map_get_use_edge_connections(RID p_map) const = 0;
 
+	virtual void map_set_use_hierarchical_pathfinding(RID p_map, bool p_enabled) = 0;
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const = 0;
+
+	virtual void map_set_use_packed_avoidance(RID p_map, bool p_enabled) = 0;
+	virtual bool map_get_use_packed_avoidance(RID p_map) const = 0;
+
 	virtual void map_set_edge_connection_margin(RID p_map, real_t p_connection_margin) = 0;
 	virtual real_t map_get_edge_connection_margin(RID p_map) const = 0;
 
@@ -113,6 +120,8 @@ public:
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
 
+	virtual Vector3 map_get_flow_direction(RID p_map, const Vector3 &p_target_position, const Vector3 &p_position, uint32_t p_navigation_layers = 1) const = 0;
+
 	/// @}
 	/// @name REGION API
 	/// @{
@@ -249,6 +258,8 @@ public:
 
 	virtual bool agent_is_map_changed(RID p_agent) const = 0;
 
+	virtual Vector3 agent_get_flow_direction(RID p_agent, const Vector3 &p_target_position, uint32_t p_navigation_layers = 1) const = 0;
+
 	virtual void agent_set_avoidance_callback(RID p_agent, Callable p_callback) = 0;
 	virtual bool agent_has_avoidance_callback(RID p_agent) const = 0;
 
@@ -297,6 +308,9 @@ public:
 	/// @{
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	/// Runs all queries against the same map iteration at once, spread over the worker threads.
+	/// Blocks the calling thread until every query is done, so it takes no callback.
+	virtual void query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryBatchResult3D> p_query_result) = 0;
 
 	/// @}
 	/// @name NAVMESH BAKE API
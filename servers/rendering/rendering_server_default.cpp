@@ -38,6 +38,7 @@
 
 #include "rendering_server_default.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/os/os.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
@@ -72,6 +73,8 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	TRACE_ZONE("RenderingServer::draw");
+
 	RSG::rasterizer->begin_frame(frame_step);
 
 	TIMESTAMP_BEGIN()
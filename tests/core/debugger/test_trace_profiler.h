@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*  test_trace_profiler.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/debugger/trace_profiler.h"
+#include "core/io/json.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTraceProfiler {
+
+static void record_zones(uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		TraceProfiler::Zone outer("TestTraceProfiler::outer");
+		TraceProfiler::Zone inner("TestTraceProfiler::inner");
+	}
+}
+
+TEST_CASE("[TraceProfiler] Zones are only recorded while enabled") {
+	TraceProfiler::clear();
+	LocalVector<TraceProfiler::Event> events;
+
+	record_zones(1);
+	TraceProfiler::get_events(events, Thread::get_caller_id());
+	CHECK(events.is_empty());
+
+	TraceProfiler::set_enabled(true);
+	record_zones(1);
+	TraceProfiler::set_enabled(false);
+
+	TraceProfiler::get_events(events, Thread::get_caller_id());
+	REQUIRE(events.size() == 2);
+	// Events are stored as zones close, so the inner one comes first.
+	CHECK(String(events[0].name) == "TestTraceProfiler::inner");
+	CHECK(String(events[1].name) == "TestTraceProfiler::outer");
+	CHECK(events[1].begin_usec <= events[0].begin_usec);
+	CHECK(events[0].end_usec <= events[1].end_usec);
+
+	TraceProfiler::finalize();
+}
+
+TEST_CASE("[TraceProfiler] Ring buffer keeps the most recent events") {
+	const uint32_t previous_capacity = TraceProfiler::get_buffer_capacity();
+	TraceProfiler::finalize(); // New buffers pick up the capacity.
+	TraceProfiler::set_buffer_capacity(8);
+	TraceProfiler::set_enabled(true);
+
+	record_zones(10);
+	{
+		TraceProfiler::Zone last("TestTraceProfiler::last");
+	}
+	TraceProfiler::set_enabled(false);
+
+	LocalVector<TraceProfiler::Event> events;
+	TraceProfiler::get_events(events, Thread::get_caller_id());
+	REQUIRE(events.size() == 8);
+	CHECK(String(events[7].name) == "TestTraceProfiler::last");
+
+	TraceProfiler::finalize();
+	TraceProfiler::set_buffer_capacity(previous_capacity);
+}
+
+#ifdef THREADS_ENABLED
+static void record_thread_zones(void *p_userdata) {
+	TraceProfiler::set_thread_name("TestTraceProfiler thread");
+	record_zones(4);
+}
+#endif // THREADS_ENABLED
+
+TEST_CASE("[TraceProfiler] Zones closed after finalizing are dropped") {
+	TraceProfiler::finalize();
+	TraceProfiler::set_enabled(true);
+	{
+		TraceProfiler::Zone zone("TestTraceProfiler::finalized");
+		TraceProfiler::finalize();
+	}
+
+	TraceProfiler::set_enabled(false);
+
+	// Closing the zone must not have allocated a new buffer for the thread, which would be leaked
+	// when it happens after the last finalize() on shutdown. Every buffer exports its thread name.
+	CHECK_FALSE(TraceProfiler::get_chrome_trace().contains("thread_name"));
+}
+
+TEST_CASE("[TraceProfiler] Chrome trace export is valid JSON") {
+	TraceProfiler::finalize();
+	TraceProfiler::set_enabled(true);
+	record_zones(2);
+#ifdef THREADS_ENABLED
+	Thread thread;
+	thread.start(record_thread_zones, nullptr);
+	thread.wait_to_finish();
+#endif // THREADS_ENABLED
+	TraceProfiler::set_enabled(false);
+
+	JSON json;
+	REQUIRE(json.parse(TraceProfiler::get_chrome_trace()) == OK);
+	const Dictionary trace = json.get_data();
+	const Array trace_events = trace["traceEvents"];
+
+	// Other threads, such as the pool's workers, may record zones while tracing is enabled,
+	// so only the zones emitted by this test are counted.
+	int zone_count = 0;
+	int thread_name_count = 0;
+	for (int i = 0; i < trace_events.size(); i++) {
+		const Dictionary event = trace_events[i];
+		const String phase = event["ph"];
+		if (phase == "X") {
+			if (String(event["name"]).begins_with("TestTraceProfiler::")) {
+				zone_count++;
+			}
+			CHECK(double(event["dur"]) >= 0);
+		} else if (phase == "M" && String(Dictionary(event["args"])["name"]) == "TestTraceProfiler thread") {
+			thread_name_count++;
+		}
+	}
+#ifdef THREADS_ENABLED
+	CHECK(zone_count == 12);
+	CHECK(thread_name_count == 1);
+#else
+	CHECK(zone_count == 4);
+#endif // THREADS_ENABLED
+
+	TraceProfiler::finalize();
+}
+
+} // namespace TestTraceProfiler
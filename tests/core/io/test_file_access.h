@@ -33,6 +33,8 @@
 #pragma once
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -222,4 +224,136 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Compressed with dictionary") {
+	const String file_path = TestUtils::get_data_path("compressed_dictionary_new.bin");
+
+	// Many blocks of similar text, the kind of content a dictionary helps with.
+	const String line = "[sub_resource type=\"StyleBoxFlat\" id=\"StyleBoxFlat_%d\"]\nbg_color = Color(0.1, 0.2, 0.3, 1)\n";
+	String text;
+	for (int i = 0; i < 2000; i++) {
+		text += vformat(line, i);
+	}
+	const CharString reference = text.utf8();
+	const Vector<uint8_t> dictionary = vformat(line, 0).to_utf8_buffer();
+
+	Ref<FileAccessCompressed> fw;
+	fw.instantiate();
+	fw->configure("GCPF", Compression::MODE_ZSTD, 1024);
+	fw->set_dictionary(dictionary);
+	REQUIRE(fw->open_internal(file_path, FileAccess::WRITE) == OK);
+	fw->store_buffer((const uint8_t *)reference.get_data(), reference.length());
+	fw->close();
+
+	Ref<FileAccessCompressed> f;
+	f.instantiate();
+	f->configure("GCPF");
+	REQUIRE(f->open_internal(file_path, FileAccess::READ) == OK);
+	CHECK(f->get_length() == (uint64_t)reference.length());
+
+	// Sequential reads go through the read-ahead blocks.
+	Vector<uint8_t> data;
+	data.resize(reference.length());
+	for (int64_t ofs = 0; ofs < data.size(); ofs += 100) {
+		f->get_buffer(data.ptrw() + ofs, MIN(100, data.size() - ofs));
+	}
+	CHECK(memcmp(data.ptr(), reference.get_data(), reference.length()) == 0);
+
+	// Seeking back drops out of sequential mode and must still return the right block.
+	f->seek(5000);
+	CHECK(f->get_8() == (uint8_t)reference[5000]);
+	f->seek(100);
+	CHECK(f->get_8() == (uint8_t)reference[100]);
+
+	f->close();
+	DirAccess::remove_file_or_error(file_path);
+}
+
+TEST_CASE("[FileAccess] Buffer views") {
+	SUBCASE("Memory file") {
+		const uint8_t bytes[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		Ref<FileAccessMemory> f;
+		f.instantiate();
+		REQUIRE(f->open_custom(bytes, sizeof(bytes)) == OK);
+
+		Span<uint8_t> view = f->get_buffer_view(3);
+		REQUIRE(view.size() == 3);
+		CHECK(view.ptr() == &bytes[0]);
+		CHECK(f->get_position() == 3);
+
+		// Requests past the end fail without moving the position.
+		CHECK(f->get_buffer_view(6).is_empty());
+		CHECK(f->get_position() == 3);
+
+		view = f->get_buffer_view(5);
+		REQUIRE(view.size() == 5);
+		CHECK(view[4] == 8);
+	}
+
+	SUBCASE("Memory-mapped file") {
+		const String file_path = TestUtils::get_data_path("memory_mapped_new.bin");
+
+		// Large enough to be mapped rather than read through stdio.
+		PackedByteArray reference;
+		reference.resize(256 * 1024);
+		for (int64_t i = 0; i < reference.size(); i++) {
+			reference.write[i] = i % 251;
+		}
+
+		Ref<FileAccess> fw = FileAccess::open(file_path, FileAccess::WRITE);
+		REQUIRE(fw.is_valid());
+		fw->store_buffer(reference);
+		fw->close();
+
+		FileAccess::set_memory_mapping_enabled(true);
+		Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+		FileAccess::set_memory_mapping_enabled(false);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == (uint64_t)reference.size());
+
+		// Regular reads must behave the same whether the file is mapped or not.
+		f->seek(1000);
+		CHECK(f->get_8() == 1000 % 251);
+		CHECK(f->get_position() == 1001);
+
+		Span<uint8_t> view = f->get_buffer_view(4096);
+#ifdef UNIX_ENABLED
+		// Regular files above the mapping threshold are always mapped by FileAccessUnix.
+		REQUIRE_FALSE(view.is_empty());
+#endif
+		if (!view.is_empty()) {
+			CHECK(memcmp(view.ptr(), reference.ptr() + 1001, 4096) == 0);
+			CHECK(f->get_position() == 1001 + 4096);
+
+			// A view reaching the end of the file leaves EOF and the position like get_buffer() does.
+			f->seek(0);
+			f->get_buffer(reference.size());
+			const bool buffer_eof = f->eof_reached();
+			const uint64_t buffer_position = f->get_position();
+			f->seek(0);
+			view = f->get_buffer_view(reference.size());
+			CHECK(view.size() == (uint64_t)reference.size());
+			CHECK(f->eof_reached() == buffer_eof);
+			CHECK(f->get_position() == buffer_position);
+
+			// Past the end, a view is refused and leaves both untouched.
+			f->seek_end(-10);
+			CHECK(f->get_buffer_view(20).is_empty());
+			CHECK(f->get_position() == (uint64_t)reference.size() - 10);
+			CHECK_FALSE(f->eof_reached());
+		}
+
+		f->seek_end(-10);
+		const Vector<uint8_t> tail = f->get_buffer(20);
+		CHECK(tail.size() == 10);
+		CHECK(f->eof_reached());
+
+		f->seek(0);
+		CHECK(!f->eof_reached());
+		CHECK(f->get_buffer(reference.size()) == reference);
+
+		f->close();
+		DirAccess::remove_file_or_error(file_path);
+	}
+}
+
 } // namespace TestFileAccess
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/io/json.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -403,4 +404,106 @@ TEST_CASE("[JSON] Serialization") {
 		}
 	}
 }
+
+static void check_utf8_parity(const String &p_json) {
+	Ref<JSON> string_json;
+	string_json.instantiate();
+	Ref<JSON> utf8_json;
+	utf8_json.instantiate();
+
+	ERR_PRINT_OFF;
+	const Error string_error = string_json->parse(p_json);
+	const Error utf8_error = utf8_json->parse_utf8(p_json.to_utf8_buffer());
+	ERR_PRINT_ON;
+
+	CHECK_MESSAGE(string_error == utf8_error, vformat("Both parsers should return the same error for: %s", p_json));
+	CHECK_MESSAGE(string_json->get_error_line() == utf8_json->get_error_line(), vformat("Both parsers should report the same error line for: %s", p_json));
+	CHECK_MESSAGE(string_json->get_error_message() == utf8_json->get_error_message(), vformat("Both parsers should report the same error message for: %s", p_json));
+	CHECK_MESSAGE(string_json->get_data() == utf8_json->get_data(), vformat("Both parsers should produce the same data for: %s", p_json));
+}
+
+TEST_CASE("[JSON] Parsing UTF-8 bytes") {
+	check_utf8_parity("{\"name\": \"Redot\", \"values\": [1, -2, 3.5, 1e3, -0.25e-2, 12345678901234567890], \"nested\": {\"ok\": true, \"no\": false, \"none\": null}}");
+	check_utf8_parity("[\"plain\", \"\\\"quoted\\\"\", \"tab\\tnew\\nline\", \"\\u00e9\\u4e2d\\ud83d\\ude00\", \"\\/slash\"]");
+	check_utf8_parity(String::utf8("[\"héllo wörld, long enough to span several words\", \"中文\", \"😀\"]"));
+	check_utf8_parity("[{\"key\": 1, \"other\": 2}, {\"key\": 3, \"other\": 4}, {\"key\": 5}]");
+	check_utf8_parity("[1, 2, 3,]");
+	check_utf8_parity("  \n\t 42 \n ");
+	check_utf8_parity("\"multi\nline\nstring\"");
+
+	// Errors.
+	check_utf8_parity("");
+	check_utf8_parity("[1, 2");
+	check_utf8_parity("[1 2]");
+	check_utf8_parity("{\"key\" 1}");
+	check_utf8_parity("{1: 2}");
+	check_utf8_parity("{\"key\": 1\n\"other\": 2}");
+	check_utf8_parity("[\n\"unterminated]");
+	check_utf8_parity("[\"\\x\"]");
+	check_utf8_parity("[\"\\u12G4\"]");
+	check_utf8_parity("[\"\\ud83d\"]");
+	check_utf8_parity("[\"\\ude00\"]");
+	check_utf8_parity("[nope]");
+	check_utf8_parity("[1] [2]");
+	check_utf8_parity("[\n\n@]");
+
+	// A leading byte order mark is skipped.
+	PackedByteArray bom_json = String("[1]").to_utf8_buffer();
+	bom_json.insert(0, 0xbf);
+	bom_json.insert(0, 0xbb);
+	bom_json.insert(0, 0xef);
+	Ref<JSON> json;
+	json.instantiate();
+	CHECK(json->parse_utf8(bom_json) == OK);
+	CHECK(json->get_data() == Variant(Array({ 1.0 })));
+
+	// The original text is kept on request.
+	CHECK(json->parse_utf8(String::utf8("{\"é\": 1}").to_utf8_buffer(), true) == OK);
+	CHECK(json->get_parsed_text() == String::utf8("{\"é\": 1}"));
+}
+
+// Skipped by default, run with `--test --no-skip --tc="*[JSON][Benchmark]*"`.
+TEST_CASE("[JSON][Benchmark] Parse and stringify throughput" * doctest::skip()) {
+	Array records;
+	for (int i = 0; i < 20000; i++) {
+		Dictionary record;
+		record["id"] = i;
+		record["name"] = vformat("Item number %d", i);
+		record["position"] = Array({ i * 0.5, i * -1.25, 3.0 });
+		record["enabled"] = (i % 3) == 0;
+		record["tags"] = Array({ "alpha", "beta", "gamma" });
+		records.push_back(record);
+	}
+	const String text = JSON::stringify(records, "\t");
+	const PackedByteArray utf8 = text.to_utf8_buffer();
+	const double megabytes = utf8.size() / (1024.0 * 1024.0);
+
+	Ref<JSON> json;
+	json.instantiate();
+
+	// Best of a few runs, to keep the numbers comparable between runs.
+	uint64_t string_usec = UINT64_MAX;
+	uint64_t utf8_usec = UINT64_MAX;
+	uint64_t stringify_usec = UINT64_MAX;
+	for (int run = 0; run < 3; run++) {
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		// Includes decoding, as this is what loading a file with parse() requires.
+		REQUIRE(json->parse(String::utf8((const char *)utf8.ptr(), utf8.size())) == OK);
+		string_usec = MIN(string_usec, OS::get_singleton()->get_ticks_usec() - begin);
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		REQUIRE(json->parse_utf8(utf8) == OK);
+		utf8_usec = MIN(utf8_usec, OS::get_singleton()->get_ticks_usec() - begin);
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		const String result = JSON::stringify(json->get_data(), "\t");
+		stringify_usec = MIN(stringify_usec, OS::get_singleton()->get_ticks_usec() - begin);
+		CHECK(result.length() == text.length());
+	}
+
+	MESSAGE(vformat("parse (String): %.1f MB/s", megabytes / (MAX(string_usec, uint64_t(1)) / 1000000.0)));
+	MESSAGE(vformat("parse_utf8: %.1f MB/s", megabytes / (MAX(utf8_usec, uint64_t(1)) / 1000000.0)));
+	MESSAGE(vformat("stringify: %.1f MB/s", megabytes / (MAX(stringify_usec, uint64_t(1)) / 1000000.0)));
+}
+
 } // namespace TestJSON
@@ -0,0 +1,197 @@
+/**************************************************************************/
+/*  test_packed_data_table.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/io/packed_data_table.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestPackedDataTable {
+
+static Array make_items() {
+	Array items;
+	for (int i = 0; i < 100; i++) {
+		Dictionary item;
+		item["id"] = vformat("item_%d", i);
+		item["damage"] = i * 2;
+		item["weight"] = i * 0.5;
+		item["stackable"] = i % 2 == 0;
+		item["rarity"] = i % 10 == 0 ? "rare" : "common";
+		if (i % 3 == 0) {
+			item["price"] = i * 10;
+		}
+		item["drops"] = Array({ i, vformat("loot_%d", i) });
+		items.push_back(item);
+	}
+	return items;
+}
+
+static void check_items(const Ref<PackedDataTable> &p_table) {
+	REQUIRE(p_table->get_row_count() == 100);
+	CHECK(p_table->get_key_column() == StringName("id"));
+	CHECK(p_table->get_column_type(p_table->get_column_index("id")) == PackedDataTable::COLUMN_TYPE_STRING);
+	CHECK(p_table->get_column_type(p_table->get_column_index("damage")) == PackedDataTable::COLUMN_TYPE_INT);
+	CHECK(p_table->get_column_type(p_table->get_column_index("weight")) == PackedDataTable::COLUMN_TYPE_FLOAT);
+	CHECK(p_table->get_column_type(p_table->get_column_index("stackable")) == PackedDataTable::COLUMN_TYPE_BOOL);
+	CHECK(p_table->get_column_type(p_table->get_column_index("price")) == PackedDataTable::COLUMN_TYPE_INT);
+	CHECK(p_table->get_column_type(p_table->get_column_index("drops")) == PackedDataTable::COLUMN_TYPE_VARIANT);
+	CHECK(p_table->get_column_index("missing") == -1);
+
+	const int row = p_table->find_row("item_42");
+	REQUIRE(row == 42);
+	CHECK(int(p_table->get_value(row, "damage")) == 84);
+	CHECK(double(p_table->get_value(row, "weight")) == 21.0);
+	CHECK(bool(p_table->get_value(row, "stackable")));
+	CHECK(String(p_table->get_value(row, "rarity")) == "common");
+	CHECK(int(p_table->get_value(row, "price")) == 420);
+	CHECK(p_table->get_value(row + 1, "price").get_type() == Variant::NIL);
+	CHECK(Array(p_table->get_value(row, "drops")) == Array({ 42, "loot_42" }));
+	CHECK(int(p_table->lookup(StringName("item_7"), "damage")) == 14);
+
+	CHECK(p_table->find_row("item_100") == -1);
+	CHECK(p_table->find_row(42) == -1);
+	CHECK(p_table->lookup("item_100", "damage").get_type() == Variant::NIL);
+
+	const Dictionary full_row = p_table->get_row(3);
+	CHECK(full_row.size() == 7);
+	CHECK(int(full_row["price"]) == 30);
+	CHECK_FALSE(p_table->get_row(4).has("price"));
+
+	CHECK(p_table->find_rows("rarity", "rare") == PackedInt32Array({ 0, 10, 20, 30, 40, 50, 60, 70, 80, 90 }));
+	CHECK(p_table->find_rows("damage", 10) == PackedInt32Array({ 5 }));
+	CHECK(p_table->find_rows("stackable", false).size() == 50);
+	CHECK(p_table->find_rows("price", Variant()).size() == 66);
+	CHECK(p_table->find_rows("drops", Array({ 1, "loot_1" })) == PackedInt32Array({ 1 }));
+
+	bool valid = false;
+	const Dictionary by_key = p_table->getvar("item_9", &valid);
+	CHECK(valid);
+	CHECK(int(by_key["damage"]) == 18);
+}
+
+TEST_CASE("[PackedDataTable] Pack and query") {
+	Ref<PackedDataTable> table;
+	table.instantiate();
+	REQUIRE(table->pack(make_items(), "id") == OK);
+	check_items(table);
+
+	SUBCASE("Storage property") {
+		Ref<PackedDataTable> copy;
+		copy.instantiate();
+		copy->set("__data__", table->get("__data__"));
+		check_items(copy);
+	}
+
+	SUBCASE("Saved file") {
+		const String path = TestUtils::get_temp_path("packed_data_table.pdt");
+		REQUIRE(table->save_to_file(path) == OK);
+		Ref<PackedDataTable> opened = PackedDataTable::open(path);
+		REQUIRE(opened.is_valid());
+		check_items(opened);
+	}
+}
+
+TEST_CASE("[PackedDataTable] Dictionary of rows") {
+	Dictionary rows;
+	for (int i = 0; i < 20; i++) {
+		Dictionary row;
+		row["name"] = vformat("Monster %d", i);
+		row["health"] = 100.0 + i;
+		rows[i * 7] = row;
+	}
+
+	Ref<PackedDataTable> table;
+	table.instantiate();
+	ERR_PRINT_OFF;
+	CHECK(table->pack(rows) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+	REQUIRE(table->pack(rows, "monster_id") == OK);
+	CHECK(table->get_column_name(0) == StringName("monster_id"));
+	CHECK(table->get_column_type(0) == PackedDataTable::COLUMN_TYPE_INT);
+	CHECK(table->find_row(49) == 7);
+	CHECK(table->find_row(49.0) == 7);
+	CHECK(table->find_row(50) == -1);
+	CHECK(String(table->lookup(14, "name")) == "Monster 2");
+	CHECK(double(table->lookup(14, "health")) == 102.0);
+}
+
+TEST_CASE("[PackedDataTable] Large integers") {
+	const int64_t big = (int64_t(1) << 53) + 1;
+	Array rows;
+	for (int64_t value : { big - 1, big }) {
+		Dictionary row;
+		row["value"] = value;
+		rows.push_back(row);
+	}
+
+	Ref<PackedDataTable> table;
+	table.instantiate();
+	REQUIRE(table->pack(rows) == OK);
+	// Integers beyond 2^53 are compared exactly, not through a double.
+	CHECK(table->find_rows("value", big) == PackedInt32Array({ 1 }));
+	CHECK(table->find_rows("value", big - 1) == PackedInt32Array({ 0 }));
+}
+
+TEST_CASE("[PackedDataTable] Invalid data") {
+	Ref<PackedDataTable> table;
+	table.instantiate();
+
+	ERR_PRINT_OFF;
+	CHECK(table->pack(42) == ERR_INVALID_DATA);
+	CHECK(table->pack(Array({ 1, 2 })) == ERR_INVALID_DATA);
+
+	Dictionary first;
+	first["id"] = "same";
+	Dictionary second;
+	second["id"] = "same";
+	CHECK(table->pack(Array({ first, second }), "id") == ERR_INVALID_DATA);
+
+	second["id"] = 2;
+	CHECK(table->pack(Array({ first, second }), "id") == ERR_INVALID_DATA);
+	CHECK(table->pack(Array({ first, second }), "unknown") == ERR_INVALID_PARAMETER);
+
+	// Without a key column, only the [] operator is unavailable.
+	REQUIRE(table->pack(Array({ first, second })) == OK);
+	CHECK(table->get_row_count() == 2);
+	CHECK(table->find_row("same") == -1);
+
+	PackedByteArray corrupt = table->get("__data__");
+	corrupt.resize(corrupt.size() / 2);
+	table->set("__data__", corrupt);
+	CHECK(table->get_row_count() == 0);
+	ERR_PRINT_ON;
+}
+
+} // namespace TestPackedDataTable
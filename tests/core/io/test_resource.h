@@ -41,6 +41,7 @@
 #include "thirdparty/doctest/doctest.h"
 
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 #include <functional>
 
@@ -630,4 +631,85 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+static Ref<Resource> load_binary_with_many_sub_resources(const String &p_path, bool p_threaded) {
+	if (!p_threaded) {
+		return ResourceLoader::load(p_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	}
+	// Threaded loads with sub-threads decode sub-resources in parallel.
+	if (ResourceLoader::load_threaded_request(p_path, "", true) != OK) {
+		return Ref<Resource>();
+	}
+	return ResourceLoader::load_threaded_get(p_path);
+}
+
+TEST_CASE("[Resource] Loading binary resources with many sub-resources in parallel") {
+	const int external_count = 3;
+	const int sub_resource_count = 64;
+
+	LocalVector<Ref<Resource>> externals;
+	for (int i = 0; i < external_count; i++) {
+		Ref<Resource> external = memnew(Resource);
+		external->set_name(vformat("External %d", i));
+		const String external_path = TestUtils::get_temp_path(vformat("parallel_external_%d.res", i));
+		REQUIRE(ResourceSaver::save(external, external_path) == OK);
+		// Loaded back, so the sub-resources reference it by path.
+		externals.push_back(ResourceLoader::load(external_path));
+		REQUIRE(externals[i].is_valid());
+	}
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Main");
+	Array sub_resources;
+	Ref<Resource> previous;
+	for (int i = 0; i < sub_resource_count; i++) {
+		Ref<Resource> sub_resource = memnew(Resource);
+		sub_resource->set_name(vformat("Sub-resource %d", i));
+		sub_resource->set_meta("index", i);
+		sub_resource->set_meta("values", PackedInt32Array({ i, i * 2, i * 3 }));
+		sub_resource->set_meta("external", externals[i % external_count]);
+		if (previous.is_valid()) {
+			sub_resource->set_meta("previous", previous);
+		}
+		sub_resources.push_back(sub_resource);
+		previous = sub_resource;
+	}
+	resource->set_meta("sub_resources", sub_resources);
+
+	const String save_path = TestUtils::get_temp_path("parallel_main.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	const Ref<Resource> serial = load_binary_with_many_sub_resources(save_path, false);
+	const Ref<Resource> parallel = load_binary_with_many_sub_resources(save_path, true);
+	REQUIRE(serial.is_valid());
+	REQUIRE(parallel.is_valid());
+	CHECK(serial != parallel);
+	CHECK(parallel->get_name() == "Main");
+
+	const Array serial_subs = serial->get_meta("sub_resources");
+	const Array parallel_subs = parallel->get_meta("sub_resources");
+	REQUIRE(serial_subs.size() == sub_resource_count);
+	REQUIRE(parallel_subs.size() == sub_resource_count);
+
+	for (int i = 0; i < sub_resource_count; i++) {
+		const Ref<Resource> serial_sub = serial_subs[i];
+		const Ref<Resource> parallel_sub = parallel_subs[i];
+		REQUIRE(parallel_sub.is_valid());
+
+		CHECK(parallel_sub->get_name() == serial_sub->get_name());
+		CHECK(parallel_sub->get_meta("index") == serial_sub->get_meta("index"));
+		CHECK(parallel_sub->get_meta("values") == serial_sub->get_meta("values"));
+		// External dependencies are shared through the cache by both loads.
+		CHECK(parallel_sub->get_meta("external") == Variant(externals[i % external_count]));
+		CHECK(serial_sub->get_meta("external") == Variant(externals[i % external_count]));
+		// Internal references point to the sub-resources of the same load.
+		if (i > 0) {
+			CHECK(parallel_sub->get_meta("previous") == parallel_subs[i - 1]);
+			CHECK(serial_sub->get_meta("previous") == serial_subs[i - 1]);
+		}
+
+		// Sub-resources are only cached once complete, and by the load that reuses the cache.
+		CHECK(ResourceCache::get_ref(parallel_sub->get_path()) == parallel_sub);
+		CHECK(ResourceCache::get_ref(serial_sub->get_path()) != serial_sub);
+	}
+}
 } // namespace TestResource
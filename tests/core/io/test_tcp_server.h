@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include "core/io/net_socket_poller.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/io/tcp_server.h"
 #include "tests/test_macros.h"
@@ -251,4 +252,81 @@ TEST_CASE("[TCPServer] Should disconnect client") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[TCPServer] Poll many sockets at once") {
+	Ref<TCPServer> server = create_server(LOCALHOST, PORT);
+
+	Ref<NetSocketPoller> poller = NetSocketPoller::create();
+	REQUIRE(poller.is_valid());
+	REQUIRE_EQ(poller->add_socket(server->get_socket(), 0, NetSocketPoller::EVENT_IN), Error::OK);
+	CHECK_EQ(poller->get_socket_count(), 1);
+
+	LocalVector<NetSocketPoller::Event> events;
+	CHECK_EQ(poller->wait(0, events), Error::ERR_BUSY);
+	CHECK(events.is_empty());
+
+	Vector<Ref<StreamPeerTCP>> clients;
+	for (int i = 0; i < 3; i++) {
+		clients.push_back(create_client(LOCALHOST, PORT));
+	}
+
+	// The listening socket becomes readable once connections are pending.
+	CHECK_EQ(poller->wait(MAX_WAIT_USEC / 1000, events), Error::OK);
+	REQUIRE_EQ(events.size(), 1u);
+	CHECK_EQ(events[0].id, 0u);
+
+	Vector<Ref<StreamPeerTCP>> clients_from_server;
+	for (int i = 0; i < clients.size(); i++) {
+		Ref<StreamPeerTCP> peer = accept_connection(server);
+		clients_from_server.push_back(peer);
+		CHECK_EQ(poller->add_socket(peer->get_socket(), i + 1, NetSocketPoller::EVENT_IN), Error::OK);
+	}
+	CHECK_EQ(poller->get_socket_count(), 4);
+
+	wait_for_condition([&]() {
+		bool should_exit = true;
+		for (Ref<StreamPeerTCP> &c : clients) {
+			if (c->poll() != Error::OK) {
+				return true;
+			}
+			if (c->get_status() != StreamPeerTCP::STATUS_CONNECTED) {
+				should_exit = false;
+			}
+		}
+		return should_exit;
+	});
+
+	// Only the peer that received data is reported.
+	clients[1]->put_string("Hello");
+	wait_for_condition([&]() {
+		return poller->wait(0, events) == Error::OK;
+	});
+	REQUIRE_EQ(events.size(), 1u);
+	CHECK_EQ(events[0].id, 2u);
+	CHECK((events[0].events & NetSocketPoller::EVENT_IN) != 0);
+	CHECK_EQ(clients_from_server[1]->poll_events(events[0].events), Error::OK);
+	CHECK_EQ(clients_from_server[1]->get_string(), "Hello");
+
+	// A closed connection is reported as readable, and detected as such by the peer.
+	clients[2]->disconnect_from_host();
+	wait_for_condition([&]() {
+		return poller->wait(0, events) == Error::OK;
+	});
+	REQUIRE_EQ(events.size(), 1u);
+	CHECK_EQ(events[0].id, 3u);
+	clients_from_server[2]->poll_events(events[0].events);
+	CHECK_EQ(clients_from_server[2]->get_status(), StreamPeerTCP::STATUS_NONE);
+
+	poller->remove_socket(clients_from_server[2]->get_socket());
+	CHECK_EQ(poller->get_socket_count(), 3);
+	CHECK_EQ(poller->wait(0, events), Error::ERR_BUSY);
+
+	poller->clear();
+	CHECK_EQ(poller->get_socket_count(), 0);
+
+	for (Ref<StreamPeerTCP> &c : clients) {
+		c->disconnect_from_host();
+	}
+	server->stop();
+}
+
 } // namespace TestTCPServer
@@ -0,0 +1,186 @@
+/**************************************************************************/
+/*  test_variant_snapshot.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/io/marshalls.h"
+#include "core/io/variant_snapshot.h"
+#include "core/variant/typed_array.h"
+#include "core/variant/typed_dictionary.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestVariantSnapshot {
+
+TEST_CASE("[VariantSnapshot] Round trip") {
+	const String path = TestUtils::get_temp_path("variant_snapshot_round_trip.bin");
+
+	Dictionary nested;
+	nested["name"] = "nested";
+	nested[StringName("string_name_key")] = StringName("value");
+	nested[42] = Vector3(1, 2, 3);
+	nested[Vector2i(1, 2)] = Array();
+
+	TypedArray<int> typed_array;
+	typed_array.push_back(1);
+	typed_array.push_back(-2);
+
+	TypedDictionary<String, float> typed_dictionary;
+	typed_dictionary["a"] = 0.5;
+	typed_dictionary["b"] = 0.1;
+
+	Array values;
+	values.push_back(Variant());
+	values.push_back(true);
+	values.push_back(false);
+	values.push_back(0);
+	values.push_back(-1);
+	values.push_back(INT64_MAX);
+	values.push_back(INT64_MIN);
+	values.push_back(0.5);
+	values.push_back(0.1);
+	values.push_back("");
+	values.push_back(String::utf8("héllo 中文"));
+	values.push_back(String("long string ").repeat(20));
+	values.push_back(StringName("name"));
+	values.push_back(nested);
+	values.push_back(typed_array);
+	values.push_back(typed_dictionary);
+	values.push_back(PackedInt32Array({ 1, 2, 3 }));
+	values.push_back(Color(0.1, 0.2, 0.3));
+	values.push_back(Dictionary());
+
+	Ref<VariantSnapshotWriter> writer;
+	writer.instantiate();
+	REQUIRE(writer->open(path) == OK);
+	for (const Variant &value : values) {
+		CHECK(writer->write(value) == OK);
+	}
+	CHECK(writer->get_entry_count() == values.size());
+	REQUIRE(writer->close() == OK);
+
+	Ref<VariantSnapshotReader> reader;
+	reader.instantiate();
+	REQUIRE(reader->open(path) == OK);
+	REQUIRE(reader->get_entry_count() == values.size());
+
+	// Entries can be read in any order.
+	for (int i = values.size() - 1; i >= 0; i--) {
+		const Variant value = reader->get_entry(i);
+		CHECK_MESSAGE(value.get_type() == values[i].get_type(), vformat("Entry %d should keep its type.", i));
+		CHECK_MESSAGE(value == values[i], vformat("Entry %d should be decoded to the written value.", i));
+	}
+
+	const Dictionary read_nested = reader->get_entry(13);
+	CHECK(read_nested.get_key_at_index(1).get_type() == Variant::STRING_NAME);
+	const Array read_typed_array = reader->get_entry(14);
+	CHECK(read_typed_array.get_typed_builtin() == Variant::INT);
+	const Dictionary read_typed_dictionary = reader->get_entry(15);
+	CHECK(read_typed_dictionary.get_typed_key_builtin() == Variant::STRING);
+	CHECK(read_typed_dictionary.get_typed_value_builtin() == Variant::FLOAT);
+}
+
+TEST_CASE("[VariantSnapshot] Similar dictionaries share their schema") {
+	const String path = TestUtils::get_temp_path("variant_snapshot_schema.bin");
+
+	Ref<VariantSnapshotWriter> writer;
+	writer.instantiate();
+	REQUIRE(writer->open(path) == OK);
+
+	int encoded_size = 0;
+	for (int i = 0; i < 1000; i++) {
+		Dictionary entity;
+		entity["id"] = i;
+		entity["state"] = i % 2 ? "idle" : "walking";
+		entity["position"] = Vector2(i, -i);
+		entity["health"] = 100;
+		entity["inventory"] = Array({ "sword", "shield" });
+		CHECK(writer->write(entity) == OK);
+
+		int len = 0;
+		encode_variant(entity, nullptr, len);
+		encoded_size += len;
+	}
+	CHECK(writer->get_schema_count() == 1);
+	CHECK(writer->get_string_count() == 9);
+	REQUIRE(writer->close() == OK);
+
+	const uint64_t snapshot_size = FileAccess::get_file_as_bytes(path).size();
+	CHECK_MESSAGE(snapshot_size * 3 < uint64_t(encoded_size), vformat("Snapshot should be much smaller than the regular encoding (%d bytes against %d).", snapshot_size, encoded_size));
+
+	Ref<VariantSnapshotReader> reader;
+	reader.instantiate();
+	REQUIRE(reader->open(path) == OK);
+	REQUIRE(reader->get_entry_count() == 1000);
+	const Dictionary entity = reader->get_entry(501);
+	CHECK(int(entity["id"]) == 501);
+	CHECK(String(entity["state"]) == "idle");
+	CHECK(Vector2(entity["position"]) == Vector2(501, -501));
+	CHECK(entity.keys() == Array({ "id", "state", "position", "health", "inventory" }));
+}
+
+TEST_CASE("[VariantSnapshot] Invalid snapshots") {
+	const String path = TestUtils::get_temp_path("variant_snapshot_invalid.bin");
+
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		f->store_string("Not a snapshot file.");
+	}
+
+	Ref<VariantSnapshotReader> reader;
+	reader.instantiate();
+	ERR_PRINT_OFF;
+	CHECK(reader->open(path) == ERR_FILE_UNRECOGNIZED);
+	CHECK(reader->get_entry(0) == Variant());
+	ERR_PRINT_ON;
+
+	Ref<VariantSnapshotWriter> writer;
+	writer.instantiate();
+	REQUIRE(writer->open(path) == OK);
+	CHECK(writer->write(Array({ 1, 2, 3 })) == OK);
+	REQUIRE(writer->close() == OK);
+
+	// Truncating the tables is detected.
+	const PackedByteArray data = FileAccess::get_file_as_bytes(path);
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		f->store_buffer(data.ptr(), data.size() - 1);
+	}
+	ERR_PRINT_OFF;
+	CHECK(reader->open(path) == ERR_FILE_CORRUPT);
+	ERR_PRINT_ON;
+	CHECK(reader->get_entry_count() == 0);
+}
+
+} // namespace TestVariantSnapshot
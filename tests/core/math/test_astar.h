@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
 
 #include "tests/test_macros.h"
 
@@ -358,4 +359,45 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+TEST_CASE("[AStarGrid2D] Flow direction") {
+	Ref<AStarGrid2D> a;
+	a.instantiate();
+	a->set_region(Rect2i(0, 0, 8, 8));
+	a->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	a->update();
+
+	// Wall with a single gap at the bottom.
+	a->fill_solid_region(Rect2i(4, 0, 1, 7));
+
+	const Vector2i to(7, 0);
+
+	SUBCASE("Following the flow should give a shortest path") {
+		for (int y = 0; y < 8; y++) {
+			for (int x = 0; x < 4; x++) {
+				const Vector2i from(x, y);
+				int steps = 0;
+				Vector2i current = from;
+				while (current != to && steps <= 64) {
+					const Vector2i direction = a->get_flow_direction(current, to);
+					REQUIRE(direction.length_squared() == 1);
+					current += direction;
+					REQUIRE_FALSE(a->is_point_solid(current));
+					steps++;
+				}
+				CHECK(current == to);
+				CHECK(steps == a->get_id_path(from, to).size() - 1);
+			}
+		}
+		CHECK(a->get_flow_direction(to, to) == Vector2i());
+	}
+
+	SUBCASE("Changing the grid should invalidate the flow") {
+		CHECK(a->get_flow_direction(Vector2i(0, 0), to) != Vector2i());
+		a->set_point_solid(Vector2i(4, 7));
+		CHECK(a->get_flow_direction(Vector2i(0, 0), to) == Vector2i());
+		a->set_point_solid(Vector2i(4, 7), false);
+		CHECK(a->get_flow_direction(Vector2i(0, 0), to) != Vector2i());
+	}
+}
 } // namespace TestAStar
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Equal names share the same data") {
+	const StringName from_cstring = StringName("string_name_test");
+	const StringName from_string = StringName(String("string_name_test"));
+
+	CHECK(from_cstring == from_string);
+	CHECK(from_cstring.data_unique_pointer() == from_string.data_unique_pointer());
+	CHECK(from_cstring != StringName("string_name_test_other"));
+	CHECK(StringName("").is_empty());
+	CHECK(StringName(String()).is_empty());
+}
+
+TEST_CASE("[StringName] Names interned from C strings stay cached after release") {
+	const CharString name = String("string_name_test_released").utf8();
+	const void *first_data = nullptr;
+	{
+		StringName first = StringName(name.get_data());
+		first_data = first.data_unique_pointer();
+		CHECK(first_data != nullptr);
+	}
+
+	// The thread cache keeps its own reference, so the name must not have been freed and interned anew.
+	const StringName again = StringName(name.get_data());
+	const StringName again_from_string = StringName(String::utf8(name.get_data()));
+	CHECK(again.data_unique_pointer() == first_data);
+	CHECK(again_from_string.data_unique_pointer() == first_data);
+	CHECK(again == String("string_name_test_released"));
+}
+
+struct InternBenchmarkData {
+	const LocalVector<CharString> *names = nullptr;
+	LocalVector<const void *> results;
+	int rounds = 0;
+	bool from_string = false;
+};
+
+static void intern_names(void *p_userdata) {
+	InternBenchmarkData *data = static_cast<InternBenchmarkData *>(p_userdata);
+	const LocalVector<CharString> &names = *data->names;
+	data->results.resize(names.size());
+
+	for (int round = 0; round < data->rounds; round++) {
+		for (uint32_t i = 0; i < names.size(); i++) {
+			const StringName sname = data->from_string ? StringName(String(names[i].get_data())) : StringName(names[i].get_data());
+			data->results[i] = sname.data_unique_pointer();
+		}
+	}
+}
+
+// Measures interning throughput from several threads at once. Skipped by default, run with
+// `--test --no-skip --tc="*[StringName][Benchmark]*"` to get the numbers, comparing the
+// C string path (thread cache) and the String path (table only).
+TEST_CASE("[StringName][Benchmark] Interning from multiple threads" * doctest::skip()) {
+	const int thread_count = 8;
+	const int rounds = 200;
+
+	LocalVector<CharString> names;
+	for (int i = 0; i < 256; i++) {
+		names.push_back(vformat("benchmark_name_%d", i).utf8());
+	}
+
+	// Keep the names alive for the whole test, so every thread must get the same data.
+	LocalVector<StringName> reference;
+	for (const CharString &name : names) {
+		reference.push_back(StringName(name.get_data()));
+	}
+
+	for (int from_string = 0; from_string < 2; from_string++) {
+		LocalVector<InternBenchmarkData> data;
+		data.resize(thread_count);
+		LocalVector<Thread> threads;
+		threads.resize(thread_count);
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < thread_count; i++) {
+			data[i].names = &names;
+			data[i].rounds = rounds;
+			data[i].from_string = from_string;
+			threads[i].start(intern_names, &data[i]);
+		}
+		for (int i = 0; i < thread_count; i++) {
+			threads[i].wait_to_finish();
+		}
+		const uint64_t elapsed = MAX(OS::get_singleton()->get_ticks_usec() - begin, uint64_t(1));
+
+		bool all_unique = true;
+		for (int i = 0; i < thread_count; i++) {
+			for (uint32_t j = 0; j < names.size(); j++) {
+				all_unique &= data[i].results[j] == reference[j].data_unique_pointer();
+			}
+		}
+		CHECK_MESSAGE(all_unique, "Every thread should get the same data for the same name.");
+
+		const uint64_t lookups = (uint64_t)thread_count * rounds * names.size();
+		MESSAGE(vformat("StringName interning from %s: %d threads, %d lookups in %d usec (%.1f lookups/usec).", from_string ? "String" : "C string", thread_count, lookups, elapsed, double(lookups) / double(elapsed)));
+	}
+}
+
+} // namespace TestStringName
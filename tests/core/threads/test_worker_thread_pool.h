@@ -108,6 +108,32 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+#ifdef THREADS_ENABLED
+TEST_CASE("[WorkerThreadPool] Contention stats account for every task run by the pool") {
+	const int count = 256;
+	const int tasks = 16;
+
+	WorkerThreadPool::get_singleton()->reset_contention_stats();
+
+	counter.clear();
+	counter.resize(count);
+	// High priority native group tasks go through the local, lock-free queues.
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_test, (void *)1, count, tasks, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool all_run_once = true;
+	for (int i = 1; i < count; i++) {
+		all_run_once &= counter[i].get() == 1;
+	}
+	CHECK(all_run_once);
+
+	const WorkerThreadPool::ContentionStats stats = WorkerThreadPool::get_singleton()->get_contention_stats();
+	// Nothing else runs on the pool during the test, so each of the group's tasks is counted exactly once.
+	CHECK_MESSAGE(stats.local_pops + stats.steals + stats.shared_pops == (uint64_t)tasks, "Every task should have been taken from exactly one of the queues.");
+	CHECK_MESSAGE(stats.local_pops > 0, "Idle workers should have taken tasks from their own local queues.");
+}
+#endif // THREADS_ENABLED
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
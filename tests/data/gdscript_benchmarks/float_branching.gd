@@ -0,0 +1,23 @@
+extends RefCounted
+
+# Branching on typed float comparisons against constants.
+
+const ITERATIONS = 1000000
+const EXPECTED = 400000
+
+func run() -> int:
+	var hits: int = 0
+	var x: float = 0.0
+	var i: int = 0
+	while i < ITERATIONS:
+		if x < 0.25:
+			hits += 0
+		elif x < 0.65:
+			hits += 1
+		else:
+			hits += 0
+		x += 0.1
+		if x >= 1.0:
+			x -= 1.0
+		i += 1
+	return hits
@@ -0,0 +1,20 @@
+extends RefCounted
+
+# Typed member variables updated in place from a loop.
+
+const ITERATIONS = 1000000
+const EXPECTED = 1500000
+
+var position: int = 0
+var velocity: int = 0
+
+func run() -> int:
+	position = 0
+	velocity = 0
+	for i in ITERATIONS:
+		velocity += 1
+		velocity -= 1
+		position += 1
+		if position % 2 == 0:
+			velocity += 1
+	return position + velocity
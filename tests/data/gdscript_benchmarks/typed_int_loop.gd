@@ -0,0 +1,15 @@
+extends RefCounted
+
+# Counting loop over typed integers: a compare-and-jump and an
+# operate-and-assign on every iteration.
+
+const ITERATIONS = 1000000
+const EXPECTED = 499999500000
+
+func run() -> int:
+	var sum: int = 0
+	var i: int = 0
+	while i < ITERATIONS:
+		sum += i
+		i += 1
+	return sum
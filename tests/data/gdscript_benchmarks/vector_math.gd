@@ -0,0 +1,16 @@
+extends RefCounted
+
+# Typed Vector2 arithmetic, as found in movement code.
+
+const ITERATIONS = 500000
+const EXPECTED = 500000
+
+func run() -> int:
+	var position := Vector2.ZERO
+	var velocity := Vector2(1.0, 0.5)
+	var i: int = 0
+	while i < ITERATIONS:
+		position += velocity
+		velocity *= 1.0
+		i += 1
+	return int(position.x)
@@ -107,6 +107,46 @@ public:
 	}
 };
 
+class TestBatchNode : public Node {
+	GDCLASS(TestBatchNode, Node);
+
+	static void _process_batch(Node *const *p_nodes, uint32_t p_count, double p_delta) {
+		batch_sizes.push_back(p_count);
+		for (uint32_t i = 0; i < p_count; i++) {
+			TestBatchNode *node = static_cast<TestBatchNode *>(p_nodes[i]);
+			node->process_counter++;
+			events.push_back(node->tag * 10 + NOTIFICATION_PROCESS_EVENT);
+		}
+	}
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			notification_counter++;
+			events.push_back(tag * 10 + NOTIFICATION_PROCESS_EVENT);
+		} else if (p_what == NOTIFICATION_INTERNAL_PROCESS) {
+			events.push_back(tag * 10 + NOTIFICATION_INTERNAL_PROCESS_EVENT);
+		}
+	}
+
+	virtual SceneTree::ProcessBatchCallback _get_process_batch_callback(bool p_physics) const override {
+		return p_physics ? nullptr : &TestBatchNode::_process_batch;
+	}
+
+public:
+	enum {
+		NOTIFICATION_INTERNAL_PROCESS_EVENT = 1,
+		NOTIFICATION_PROCESS_EVENT = 2,
+	};
+
+	static inline LocalVector<uint32_t> batch_sizes;
+	static inline LocalVector<int> events; ///< `tag * 10` plus the event, in the order they happened.
+
+	int tag = 0;
+	int process_counter = 0;
+	int notification_counter = 0;
+};
+
 TEST_CASE("[SceneTree][Node] Testing node operations with a very simple scene tree") {
 	Node *node = memnew(Node);
 
@@ -930,4 +970,124 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Test batched processing") {
+	Window *root = SceneTree::get_singleton()->get_root();
+	TestBatchNode::batch_sizes.clear();
+
+	TestBatchNode *batched[4];
+	for (int i = 0; i < 4; i++) {
+		batched[i] = memnew(TestBatchNode);
+		batched[i]->set_process(true);
+		root->add_child(batched[i]);
+	}
+
+	SUBCASE("Adjacent nodes are processed in one batch") {
+		SceneTree::get_singleton()->process(0);
+
+		REQUIRE_EQ(1u, TestBatchNode::batch_sizes.size());
+		CHECK_EQ(4u, TestBatchNode::batch_sizes[0]);
+		for (int i = 0; i < 4; i++) {
+			CHECK_EQ(1, batched[i]->process_counter);
+			CHECK_EQ(0, batched[i]->notification_counter);
+		}
+	}
+
+	SUBCASE("Batches are split by other nodes in process order") {
+		TestNode *node = memnew(TestNode);
+		node->set_process(true);
+		node->set_process_priority(1);
+		root->add_child(node);
+		batched[2]->set_process_priority(2);
+		batched[3]->set_process_priority(2);
+
+		SceneTree::get_singleton()->process(0);
+
+		REQUIRE_EQ(2u, TestBatchNode::batch_sizes.size());
+		CHECK_EQ(2u, TestBatchNode::batch_sizes[0]);
+		CHECK_EQ(2u, TestBatchNode::batch_sizes[1]);
+		CHECK_EQ(1, node->process_counter);
+		memdelete(node);
+	}
+
+	SUBCASE("Removed and disabled nodes are not batched") {
+		memdelete(batched[0]);
+		batched[0] = nullptr;
+		batched[1]->set_process_mode(Node::PROCESS_MODE_DISABLED);
+
+		SceneTree::get_singleton()->process(0);
+
+		REQUIRE_EQ(1u, TestBatchNode::batch_sizes.size());
+		CHECK_EQ(2u, TestBatchNode::batch_sizes[0]);
+		CHECK_EQ(0, batched[1]->process_counter);
+		CHECK_EQ(1, batched[2]->process_counter);
+	}
+
+	SUBCASE("Nodes with internal processing keep the notification order") {
+		TestBatchNode::events.clear();
+		for (int i = 0; i < 4; i++) {
+			batched[i]->tag = i + 1;
+		}
+		batched[1]->set_process_internal(true);
+
+		SceneTree::get_singleton()->process(0);
+
+		// Internal processing is sent right before the node's own process callback, as without batching.
+		const int expected[] = { 12, 21, 22, 32, 42 };
+		REQUIRE_EQ(5u, TestBatchNode::events.size());
+		for (int i = 0; i < 5; i++) {
+			CHECK_EQ(expected[i], TestBatchNode::events[i]);
+		}
+		REQUIRE_EQ(2u, TestBatchNode::batch_sizes.size());
+		CHECK_EQ(1u, TestBatchNode::batch_sizes[0]);
+		CHECK_EQ(2u, TestBatchNode::batch_sizes[1]);
+		CHECK_EQ(1, batched[1]->notification_counter);
+	}
+
+	for (int i = 0; i < 4; i++) {
+		if (batched[i]) {
+			memdelete(batched[i]);
+		}
+	}
+}
+
+// Skipped by default, run with `--test --no-skip --tc="*[SceneTree][Node][Benchmark]*"`.
+TEST_CASE("[SceneTree][Node][Benchmark] Process 100k nodes" * doctest::skip()) {
+	const int count = 100000;
+	const int frames = 10;
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	Node *parent = memnew(Node);
+	root->add_child(parent);
+	for (int i = 0; i < count; i++) {
+		Node *node = memnew(TestNode);
+		node->set_process(true);
+		parent->add_child(node);
+	}
+	SceneTree::get_singleton()->process(0); // Sort.
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < frames; i++) {
+		SceneTree::get_singleton()->process(0);
+	}
+	const uint64_t notification_usec = (OS::get_singleton()->get_ticks_usec() - begin) / frames;
+	memdelete(parent);
+
+	parent = memnew(Node);
+	root->add_child(parent);
+	for (int i = 0; i < count; i++) {
+		Node *node = memnew(TestBatchNode);
+		node->set_process(true);
+		parent->add_child(node);
+	}
+	SceneTree::get_singleton()->process(0);
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < frames; i++) {
+		SceneTree::get_singleton()->process(0);
+	}
+	const uint64_t batch_usec = (OS::get_singleton()->get_ticks_usec() - begin) / frames;
+	memdelete(parent);
+
+	MESSAGE(vformat("Per-node notifications: %.2f ms per frame", notification_usec / 1000.0));
+	MESSAGE(vformat("Batch callback: %.2f ms per frame", batch_usec / 1000.0));
+}
+
 } // namespace TestNode
@@ -217,6 +217,51 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene In Parallel") {
+	// Create a sub-scene to be nested several times.
+	Node *sub_scene = memnew(Node);
+	sub_scene->set_name("SubScene");
+	Node *sub_child = memnew(Node);
+	sub_child->set_name("SubChild");
+	sub_scene->add_child(sub_child);
+	sub_child->set_owner(sub_scene);
+
+	Ref<PackedScene> sub_packed;
+	sub_packed.instantiate();
+	sub_packed->pack(sub_scene);
+	memdelete(sub_scene);
+
+	// Build a scene whose children are all instances of the sub-scene.
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	Ref<SceneState> state = packed_scene->get_state();
+	state->add_node(-1, -1, state->add_name("Node"), state->add_name("TestScene"), -1, -1);
+	const int sub_scene_value = state->add_value(sub_packed);
+	for (int i = 0; i < 4; i++) {
+		state->add_node(0, 0, SceneState::TYPE_INSTANTIATED, state->add_name(vformat("Instance%d", i)), sub_scene_value, -1);
+	}
+
+	Node *serial = packed_scene->instantiate();
+	Node *parallel = packed_scene->instantiate_parallel();
+	REQUIRE(serial != nullptr);
+	REQUIRE(parallel != nullptr);
+
+	CHECK(parallel->get_name() == "TestScene");
+	REQUIRE(parallel->get_child_count() == serial->get_child_count());
+	CHECK(parallel->get_child_count() == 4);
+	for (int i = 0; i < parallel->get_child_count(); i++) {
+		Node *instance = parallel->get_child(i);
+		CHECK(instance->get_name() == serial->get_child(i)->get_name());
+		CHECK(instance->get_owner() == parallel);
+		REQUIRE(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_name() == "SubChild");
+		CHECK(instance->get_child(0)->get_owner() == instance);
+	}
+
+	memdelete(serial);
+	memdelete(parallel);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -0,0 +1,251 @@
+/**************************************************************************/
+/*  test_scene_pool.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_pool.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestScenePool {
+
+static Ref<PackedScene> _make_pooled_scene() {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Bullet");
+	root->set_rotation(0.5);
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Sprite");
+	child->set_position(Vector2(4, 8));
+	root->add_child(child);
+	child->set_owner(root);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+	return packed_scene;
+}
+
+TEST_CASE("[ScenePool] Acquire and release outside of the tree") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_pooled_scene());
+
+	Node2D *node = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(node != nullptr);
+	CHECK(pool->is_active(node));
+	CHECK(pool->get_active_count() == 1);
+	CHECK(pool->get_available_count() == 0);
+
+	// Modify stored properties, including ones left at their default value in the scene.
+	node->set_rotation(2.0);
+	node->set_position(Vector2(100, 200));
+	Node2D *child = Object::cast_to<Node2D>(node->get_node(NodePath("Sprite")));
+	child->set_position(Vector2(-1, -1));
+
+	pool->release(node);
+	CHECK_FALSE(pool->is_active(node));
+	CHECK(pool->get_active_count() == 0);
+	CHECK(pool->get_available_count() == 1);
+
+	Node2D *reused = Object::cast_to<Node2D>(pool->acquire());
+	CHECK(reused == node);
+	CHECK(reused->get_rotation() == doctest::Approx(0.5));
+	CHECK(reused->get_position() == Vector2());
+	CHECK(child->get_position() == Vector2(4, 8));
+
+	ERR_PRINT_OFF;
+	pool->release(reused);
+	// Releasing twice is an error.
+	pool->release(reused);
+	ERR_PRINT_ON;
+	CHECK(pool->get_available_count() == 1);
+}
+
+TEST_CASE("[ScenePool] Release from the tree at the end of the frame") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_pooled_scene());
+
+	Window *root = SceneTree::get_singleton()->get_root();
+	Node *node = pool->acquire(root);
+	REQUIRE(node != nullptr);
+	CHECK(node->is_inside_tree());
+
+	pool->release(node);
+	CHECK(node->is_inside_tree());
+	CHECK(pool->get_available_count() == 0);
+
+	SceneTree::get_singleton()->process(0);
+	CHECK_FALSE(node->is_inside_tree());
+	CHECK(node->get_parent() == nullptr);
+	CHECK(pool->get_available_count() == 1);
+
+	CHECK(pool->acquire(root) == node);
+	CHECK(node->is_inside_tree());
+	pool->release(node);
+	SceneTree::get_singleton()->process(0);
+}
+
+TEST_CASE("[ScenePool] Pool size") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_pooled_scene());
+	pool->set_max_size(4);
+
+	pool->prewarm(10);
+	CHECK(pool->get_available_count() == 4);
+
+	Node *nodes[6];
+	for (int i = 0; i < 6; i++) {
+		nodes[i] = pool->acquire();
+	}
+	CHECK(pool->get_available_count() == 0);
+	CHECK(pool->get_active_count() == 6);
+
+	// Instances released while the pool is full are freed.
+	for (int i = 0; i < 6; i++) {
+		pool->release(nodes[i]);
+	}
+	CHECK(pool->get_available_count() == 4);
+
+	pool->set_max_size(1);
+	CHECK(pool->get_available_count() == 1);
+	pool->clear();
+	CHECK(pool->get_available_count() == 0);
+
+	// Nodes freed instead of released are no longer counted.
+	Node *node = pool->acquire();
+	memdelete(node);
+	CHECK(pool->get_active_count() == 0);
+}
+
+TEST_CASE("[ScenePool] Freed instances") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_pooled_scene());
+
+	// Freed through a pointer kept after releasing it.
+	Node *node = pool->acquire();
+	const ObjectID freed_id = node->get_instance_id();
+	pool->release(node);
+	CHECK(pool->get_available_count() == 1);
+	memdelete(node);
+	CHECK(pool->get_available_count() == 0);
+
+	pool->prewarm(1);
+	pool->release(pool->acquire());
+	Node *pooled = pool->acquire();
+	pool->release(pooled);
+	memdelete(pooled);
+	Node *fresh = pool->acquire();
+	REQUIRE(fresh != nullptr);
+	CHECK(fresh->get_instance_id() != freed_id);
+	CHECK(pool->is_active(fresh));
+	pool->release(fresh);
+	pool->set_max_size(0);
+	CHECK(pool->get_available_count() == 0);
+}
+
+TEST_CASE("[ScenePool] Changing the scene frees its instances") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_pooled_scene());
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	Node *orphan = pool->acquire();
+	Node *in_tree = pool->acquire(root);
+	Node *leaving = pool->acquire(root);
+	const ObjectID orphan_id = orphan->get_instance_id();
+	const ObjectID in_tree_id = in_tree->get_instance_id();
+	const ObjectID leaving_id = leaving->get_instance_id();
+	pool->release(leaving);
+
+	pool->set_scene(_make_pooled_scene());
+	CHECK(pool->get_active_count() == 0);
+	CHECK(ObjectDB::get_instance(orphan_id) == nullptr);
+	// Nodes inside the tree are only removed at the end of the frame.
+	REQUIRE(ObjectDB::get_instance(in_tree_id) != nullptr);
+	CHECK(in_tree->is_queued_for_deletion());
+
+	SceneTree::get_singleton()->process(0);
+	CHECK(ObjectDB::get_instance(in_tree_id) == nullptr);
+	// Released before the change, but it belongs to the previous scene so it isn't kept.
+	CHECK(ObjectDB::get_instance(leaving_id) == nullptr);
+	CHECK(pool->get_available_count() == 0);
+}
+
+// Skipped by default, run with `--test --no-skip --tc="*[ScenePool][Benchmark]*"`.
+TEST_CASE("[ScenePool][Benchmark] Spawn and despawn throughput" * doctest::skip()) {
+	const Ref<PackedScene> packed_scene = _make_pooled_scene();
+	Window *root = SceneTree::get_singleton()->get_root();
+	const int count = 2000;
+	LocalVector<Node *> nodes;
+	nodes.resize(count);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		nodes[i] = packed_scene->instantiate();
+		root->add_child(nodes[i]);
+	}
+	for (int i = 0; i < count; i++) {
+		nodes[i]->queue_free();
+	}
+	SceneTree::get_singleton()->process(0);
+	const uint64_t instantiate_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+	pool->set_max_size(count);
+	pool->prewarm(count);
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		nodes[i] = pool->acquire(root);
+	}
+	for (int i = 0; i < count; i++) {
+		pool->release(nodes[i]);
+	}
+	SceneTree::get_singleton()->process(0);
+	const uint64_t pool_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(pool->get_available_count() == count);
+
+	MESSAGE(vformat("instantiate/queue_free: %d spawns per second", int64_t(count / (MAX(instantiate_usec, uint64_t(1)) / 1000000.0))));
+	MESSAGE(vformat("ScenePool acquire/release: %d spawns per second", int64_t(count / (MAX(pool_usec, uint64_t(1)) / 1000000.0))));
+}
+
+} // namespace TestScenePool
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include "core/object/worker_thread_pool.h"
+#include "modules/navigation_3d/3d/godot_navigation_server_3d.h"
+#include "modules/navigation_3d/3d/nav_mesh_generator_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -52,6 +55,129 @@ public:
 	Variant function1_latest_arg0;
 };
 
+// Collects the safe velocities of many agents, by the index bound to the avoidance callback.
+class AvoidanceResults : public Object {
+	GDCLASS(AvoidanceResults, Object);
+
+public:
+	void store(Vector3 p_safe_velocity, int p_index) {
+		velocities[p_index] = p_safe_velocity;
+	}
+
+	LocalVector<Vector3> velocities;
+};
+
+// Creates a flat navigation mesh covering each rectangle (on the XZ plane) with polygons of 1x1 units.
+// Polygons of different rectangles don't share vertices.
+static Ref<NavigationMesh> _create_rects_navigation_mesh(const Vector<Rect2i> &p_rects) {
+	Ref<NavigationMesh> navigation_mesh;
+	navigation_mesh.instantiate();
+
+	Vector<Vector3> vertices;
+	for (const Rect2i &rect : p_rects) {
+		const int first_vertex = vertices.size();
+		const int row = rect.size.x + 1;
+		for (int z = 0; z <= rect.size.y; z++) {
+			for (int x = 0; x <= rect.size.x; x++) {
+				vertices.push_back(Vector3(rect.position.x + x, 0, rect.position.y + z));
+			}
+		}
+		for (int z = 0; z < rect.size.y; z++) {
+			for (int x = 0; x < rect.size.x; x++) {
+				const int corner = first_vertex + z * row + x;
+				Vector<int> polygon;
+				polygon.push_back(corner);
+				polygon.push_back(corner + 1);
+				polygon.push_back(corner + row + 1);
+				polygon.push_back(corner + row);
+				navigation_mesh->add_polygon(polygon);
+			}
+		}
+	}
+	navigation_mesh->set_vertices(vertices);
+	return navigation_mesh;
+}
+
+// Creates a flat square navigation mesh made of `p_quads` x `p_quads` polygons of 1x1 units.
+static Ref<NavigationMesh> _create_grid_navigation_mesh(int p_quads) {
+	Vector<Rect2i> rects;
+	rects.push_back(Rect2i(0, 0, p_quads, p_quads));
+	return _create_rects_navigation_mesh(rects);
+}
+
+// Creates path queries spread over a square of `p_extent` units starting at the origin.
+static TypedArray<NavigationPathQueryParameters3D> _create_path_queries(RID p_map, real_t p_extent, int p_query_count) {
+	TypedArray<NavigationPathQueryParameters3D> queries;
+	for (int i = 0; i < p_query_count; i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(p_map);
+		query_parameters->set_start_position(Vector3(0.5 + Math::fmod(i * 3.1, p_extent - 1.0), 0, 0.5 + Math::fmod(i * 7.3, p_extent - 1.0)));
+		query_parameters->set_target_position(Vector3(0.5 + Math::fmod(i * 11.9, p_extent - 1.0), 0, 0.5 + Math::fmod(i * 5.7, p_extent - 1.0)));
+		queries.push_back(query_parameters);
+	}
+	return queries;
+}
+
+// Lays out `p_regions_per_side` x `p_regions_per_side` grid regions of `p_region_quads` polygons per side on the map.
+static void _create_grid_regions(RID p_map, int p_region_quads, int p_regions_per_side, LocalVector<RID> &r_regions) {
+	NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+	const Ref<NavigationMesh> navigation_mesh = _create_grid_navigation_mesh(p_region_quads);
+	for (int z = 0; z < p_regions_per_side; z++) {
+		for (int x = 0; x < p_regions_per_side; x++) {
+			RID region = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(region, false);
+			navigation_server->region_set_map(region, p_map);
+			navigation_server->region_set_transform(region, Transform3D(Basis(), Vector3(x * p_region_quads, 0, z * p_region_quads)));
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			r_regions.push_back(region);
+		}
+	}
+}
+
+// Returns the length of the path between both points, or -1 if it doesn't reach `p_to`.
+static real_t _query_path_length(RID p_map, const Vector3 &p_from, const Vector3 &p_to, int p_max_polygons = 0) {
+	Ref<NavigationPathQueryParameters3D> query_parameters;
+	query_parameters.instantiate();
+	query_parameters->set_map(p_map);
+	query_parameters->set_start_position(p_from);
+	query_parameters->set_target_position(p_to);
+	query_parameters->set_path_search_max_polygons(p_max_polygons);
+	Ref<NavigationPathQueryResult3D> query_result;
+	query_result.instantiate();
+	NavigationServer3D::get_singleton()->query_path(query_parameters, query_result);
+	const Vector<Vector3> path = query_result->get_path();
+	if (path.size() < 2 || !path[path.size() - 1].is_equal_approx(p_to)) {
+		return -1.0;
+	}
+	return query_result->get_path_length();
+}
+
+// Creates a 128x128 units floor covered by 16x16 small walls, optionally without the wall in the middle.
+static Ref<NavigationMeshSourceGeometryData3D> _create_walls_source_geometry(bool p_remove_middle_wall) {
+	const real_t floor_size = 128.0;
+	const int walls_per_side = 16;
+
+	Array floor_arr;
+	floor_arr.resize(RS::ARRAY_MAX);
+	BoxMesh::create_mesh_array(floor_arr, Vector3(floor_size, 0.001, floor_size));
+	Array wall_arr;
+	wall_arr.resize(RS::ARRAY_MAX);
+	BoxMesh::create_mesh_array(wall_arr, Vector3(2.0, 2.0, 0.5));
+
+	Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+	source_geometry->add_mesh_array(floor_arr, Transform3D(Basis(), Vector3(floor_size * 0.5, 0, floor_size * 0.5)));
+	for (int z = 0; z < walls_per_side; z++) {
+		for (int x = 0; x < walls_per_side; x++) {
+			if (p_remove_middle_wall && x == walls_per_side / 2 && z == walls_per_side / 2) {
+				continue;
+			}
+			source_geometry->add_mesh_array(wall_arr, Transform3D(Basis(), Vector3((x + 0.5) * floor_size / walls_per_side, 1.0, (z + 0.5) * floor_size / walls_per_side)));
+		}
+	}
+	return source_geometry;
+}
+
 TEST_SUITE("[Navigation3D]") {
 	TEST_CASE("[NavigationServer3D] Server should be empty when initialized") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -149,6 +275,8 @@ TEST_SUITE("[Navigation3D]") {
 			navigation_server->map_set_up(map, Vector3(1, 0, 0));
 			bool initial_use_edge_connections = navigation_server->map_get_use_edge_connections(map);
 			navigation_server->map_set_use_edge_connections(map, !initial_use_edge_connections);
+			navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+			navigation_server->map_set_use_packed_avoidance(map, true);
 			navigation_server->physics_process(0.0); // Give server some cycles to commit.
 
 			CHECK_EQ(navigation_server->map_get_cell_size(map), doctest::Approx(0.55));
@@ -156,6 +284,8 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(navigation_server->map_get_link_connection_radius(map), doctest::Approx(0.77));
 			CHECK_EQ(navigation_server->map_get_up(map), Vector3(1, 0, 0));
 			CHECK_EQ(navigation_server->map_get_use_edge_connections(map), !initial_use_edge_connections);
+			CHECK(navigation_server->map_get_use_hierarchical_pathfinding(map));
+			CHECK(navigation_server->map_get_use_packed_avoidance(map));
 		}
 
 		SUBCASE("'ProcessInfo' should report map iff active") {
@@ -418,6 +548,47 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->free(map);
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should make agents avoid each other with packed avoidance") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		RID agent_1 = navigation_server->agent_create();
+		RID agent_2 = navigation_server->agent_create();
+
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_packed_avoidance(map, true);
+
+		navigation_server->agent_set_map(agent_1, map);
+		navigation_server->agent_set_avoidance_enabled(agent_1, true);
+		navigation_server->agent_set_position(agent_1, Vector3(0, 0, 0));
+		navigation_server->agent_set_radius(agent_1, 1);
+		navigation_server->agent_set_velocity(agent_1, Vector3(1, 0, 0));
+		CallableMock agent_1_avoidance_callback_mock;
+		navigation_server->agent_set_avoidance_callback(agent_1, callable_mp(&agent_1_avoidance_callback_mock, &CallableMock::function1));
+
+		navigation_server->agent_set_map(agent_2, map);
+		navigation_server->agent_set_avoidance_enabled(agent_2, true);
+		navigation_server->agent_set_position(agent_2, Vector3(2.5, 0, 0.5));
+		navigation_server->agent_set_radius(agent_2, 1);
+		navigation_server->agent_set_velocity(agent_2, Vector3(-1, 0, 0));
+		CallableMock agent_2_avoidance_callback_mock;
+		navigation_server->agent_set_avoidance_callback(agent_2, callable_mp(&agent_2_avoidance_callback_mock, &CallableMock::function1));
+
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(agent_1_avoidance_callback_mock.function1_calls, 1);
+		CHECK_EQ(agent_2_avoidance_callback_mock.function1_calls, 1);
+		Vector3 agent_1_safe_velocity = agent_1_avoidance_callback_mock.function1_latest_arg0;
+		Vector3 agent_2_safe_velocity = agent_2_avoidance_callback_mock.function1_latest_arg0;
+		CHECK_MESSAGE(agent_1_safe_velocity.x > 0, "agent 1 should move a bit along desired velocity (+X)");
+		CHECK_MESSAGE(agent_2_safe_velocity.x < 0, "agent 2 should move a bit along desired velocity (-X)");
+		CHECK_MESSAGE(agent_1_safe_velocity.z < 0, "agent 1 should move a bit to the side so that it avoids agent 2");
+		CHECK_MESSAGE(agent_2_safe_velocity.z > 0, "agent 2 should move a bit to the side so that it avoids agent 1");
+
+		navigation_server->free(agent_2);
+		navigation_server->free(agent_1);
+		navigation_server->free(map);
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should make agents avoid dynamic obstacles when avoidance enabled") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
 
@@ -805,6 +976,55 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should bake and stitch navigation mesh tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(4.0);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(20.0, 0.001, 20.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		CHECK_NE(navigation_mesh->get_vertices().size(), 0);
+
+		SUBCASE("Paths should cross the tile seams") {
+			RID map = navigation_server->map_create();
+			RID region = navigation_server->region_create();
+			navigation_server->map_set_active(map, true);
+			navigation_server->map_set_use_async_iterations(map, false);
+			navigation_server->region_set_use_async_iterations(region, false);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			const Vector3 from = navigation_server->map_get_closest_point(map, Vector3(-9, 0, -9));
+			const Vector3 to = navigation_server->map_get_closest_point(map, Vector3(9, 0, 9));
+			const real_t path_length = _query_path_length(map, from, to);
+			CHECK(path_length > 0.0);
+			CHECK(path_length < from.distance_to(to) * 1.1);
+
+			navigation_server->free(region);
+			navigation_server->free(map);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		}
+
+		SUBCASE("Rebaking changed source geometry should match a full bake") {
+			BoxMesh::create_mesh_array(arr, Vector3(1.0, 2.0, 1.0));
+			source_geometry->add_mesh_array(arr, Transform3D(Basis(), Vector3(2.0, 1.0, 2.0)));
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+
+			Ref<NavigationMesh> full_navigation_mesh = memnew(NavigationMesh);
+			full_navigation_mesh->set_tile_size(4.0);
+			navigation_server->bake_from_source_geometry_data(full_navigation_mesh, source_geometry, Callable());
+
+			CHECK(navigation_mesh->get_vertices() == full_navigation_mesh->get_vertices());
+			CHECK(navigation_mesh->get_polygons() == full_navigation_mesh->get_polygons());
+		}
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
@@ -826,6 +1046,544 @@ TEST_SUITE("[Navigation3D]") {
 	}
 	*/
 
+	TEST_CASE("[NavigationServer3D] Hierarchical pathfinding should restrict the search to the cluster corridor") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+
+		// The start region opens onto a large dead end toward the target, which is only reached by a long
+		// detour through three strips: full A* has to search the whole dead end first, the corridor skips it.
+		const Rect2i rects[] = {
+			Rect2i(0, 0, 2, 2), // Start.
+			Rect2i(2, 0, 20, 20), // Dead end.
+			Rect2i(0, -30, 2, 30), // Detour.
+			Rect2i(2, -30, 24, 2),
+			Rect2i(24, -28, 2, 28),
+			Rect2i(24, 0, 2, 2), // Target.
+		};
+		LocalVector<RID> regions;
+		for (const Rect2i &rect : rects) {
+			Vector<Rect2i> region_rects;
+			region_rects.push_back(rect);
+			RID region = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(region, false);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, _create_rects_navigation_mesh(region_rects));
+			regions.push_back(region);
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector3 from(0.5, 0, 1.0);
+		const Vector3 to(25.5, 0, 1.0);
+		// More than the 172 polygons of the corridor, fewer than the 400 of the dead end.
+		const int max_polygons = 300;
+		const real_t full_length = _query_path_length(map, from, to);
+		CHECK(full_length > 70.0);
+		CHECK(_query_path_length(map, from, to, max_polygons) < 0.0);
+
+		navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		const real_t corridor_length = _query_path_length(map, from, to, max_polygons);
+		CHECK(corridor_length == doctest::Approx(full_length));
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Hierarchical pathfinding should fall back to a full search") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+
+		// The target region is made of two islands. The abstract route enters it through the short strip
+		// leading to the wrong island, so the corridor can't reach the target and only the long loop can.
+		Vector<Vector<Rect2i>> region_rects;
+		region_rects.push_back({ Rect2i(0, 0, 2, 2) }); // Start.
+		region_rects.push_back({ Rect2i(2, 0, 8, 2) }); // Short strip.
+		region_rects.push_back({ Rect2i(10, 0, 2, 2), Rect2i(10, 4, 2, 2) }); // Target islands.
+		region_rects.push_back({ Rect2i(0, 2, 2, 18) }); // Long loop.
+		region_rects.push_back({ Rect2i(2, 18, 10, 2) });
+		region_rects.push_back({ Rect2i(10, 6, 2, 12) });
+		LocalVector<RID> regions;
+		for (const Vector<Rect2i> &rects : region_rects) {
+			RID region = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(region, false);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, _create_rects_navigation_mesh(rects));
+			regions.push_back(region);
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector3 from(1.0, 0, 1.0);
+		const Vector3 to(11.0, 0, 5.0);
+		const real_t full_length = _query_path_length(map, from, to);
+		CHECK(full_length > 30.0);
+
+		navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		// Without the fallback the path would stop on the island next to the short strip.
+		CHECK(_query_path_length(map, from, to) == doctest::Approx(full_length));
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	// Skipped by default, run with `--test --no-skip --tc="*Hierarchical pathfinding should find paths*"`.
+	TEST_CASE("[NavigationServer3D][Benchmark] Hierarchical pathfinding should find paths across many regions" * doctest::skip()) {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int region_quads = 16;
+		const int regions_per_side = 8;
+		const Ref<NavigationMesh> navigation_mesh = _create_grid_navigation_mesh(region_quads);
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+
+		LocalVector<RID> regions;
+		for (int z = 0; z < regions_per_side; z++) {
+			for (int x = 0; x < regions_per_side; x++) {
+				// Leave a wall of missing regions with a single gap at the far end so that paths need to detour.
+				if (x == regions_per_side / 2 && z < regions_per_side - 1) {
+					continue;
+				}
+				RID region = navigation_server->region_create();
+				navigation_server->region_set_use_async_iterations(region, false);
+				navigation_server->region_set_map(region, map);
+				navigation_server->region_set_transform(region, Transform3D(Basis(), Vector3(x * region_quads, 0, z * region_quads)));
+				navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+				regions.push_back(region);
+			}
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const real_t extent = region_quads * regions_per_side;
+		LocalVector<Pair<Vector3, Vector3>> queries;
+		for (int i = 0; i < 64; i++) {
+			const real_t from_z = 0.5 + Math::fmod(i * 7.3, extent - 1.0);
+			const real_t to_z = 0.5 + Math::fmod(i * 13.7, extent - 1.0);
+			queries.push_back(Pair<Vector3, Vector3>(Vector3(1.5, 0, from_z), Vector3(extent - 1.5, 0, to_z)));
+		}
+
+		LocalVector<real_t> reference_lengths;
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (const Pair<Vector3, Vector3> &query : queries) {
+			reference_lengths.push_back(_query_path_length(map, query.first, query.second));
+		}
+		const uint64_t full_search_usec = OS::get_singleton()->get_ticks_usec() - begin;
+		GodotNavigationServer3D *godot_navigation_server = static_cast<GodotNavigationServer3D *>(navigation_server);
+		const uint64_t full_search_memory = godot_navigation_server->map_get_pathfinding_memory_usage(map);
+
+		navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 0; i < queries.size(); i++) {
+			const real_t length = _query_path_length(map, queries[i].first, queries[i].second);
+			CHECK(reference_lengths[i] > 0.0);
+			CHECK(length > 0.0);
+			// The abstract path is approximate, but should stay close to the optimal one.
+			CHECK(length < reference_lengths[i] * 1.25 + 1.0);
+		}
+		const uint64_t hierarchical_usec = OS::get_singleton()->get_ticks_usec() - begin;
+		const uint64_t hierarchical_memory = godot_navigation_server->map_get_pathfinding_memory_usage(map);
+		CHECK(hierarchical_memory > 0);
+
+		MESSAGE(vformat("Full search: %d queries per second", int64_t(queries.size() / (MAX(full_search_usec, uint64_t(1)) / 1000000.0))));
+		MESSAGE(vformat("Hierarchical pathfinding: %d queries per second", int64_t(queries.size() / (MAX(hierarchical_usec, uint64_t(1)) / 1000000.0))));
+		MESSAGE(vformat("Pathfinding memory per map: %d KiB with full search, %d KiB with hierarchical pathfinding", int64_t(full_search_memory / 1024), int64_t(hierarchical_memory / 1024)));
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Batched path queries should match single queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int region_quads = 4;
+		const int regions_per_side = 2;
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		LocalVector<RID> regions;
+		_create_grid_regions(map, region_quads, regions_per_side, regions);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const int query_count = 64;
+		TypedArray<NavigationPathQueryParameters3D> queries = _create_path_queries(map, region_quads * regions_per_side, query_count);
+
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+		LocalVector<Vector<Vector3>> single_paths;
+		for (int i = 0; i < query_count; i++) {
+			navigation_server->query_path(queries[i], query_result);
+			single_paths.push_back(query_result->get_path());
+		}
+
+		// The call blocks, so the result is complete when it returns.
+		Ref<NavigationPathQueryBatchResult3D> batch_result;
+		batch_result.instantiate();
+		navigation_server->query_path_batch(queries, batch_result);
+
+		CHECK_EQ(batch_result->get_path_count(), query_count);
+		CHECK_EQ(batch_result->get_path_offsets().size(), query_count + 1);
+		CHECK_EQ(batch_result->get_path_offsets()[query_count], batch_result->get_path_points().size());
+		for (int i = 0; i < query_count; i++) {
+			CHECK(batch_result->get_path(i) == single_paths[i]);
+		}
+
+		SUBCASE("Queries on another map should fail the whole batch") {
+			RID other_map = navigation_server->map_create();
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(other_map);
+			queries.push_back(query_parameters);
+
+			ERR_PRINT_OFF;
+			navigation_server->query_path_batch(queries, batch_result);
+			ERR_PRINT_ON;
+			CHECK_EQ(batch_result->get_path_count(), 0);
+			navigation_server->free(other_map);
+		}
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	// Skipped by default, run with `--test --no-skip --tc="*Batched path queries should outpace single queries*"`.
+	TEST_CASE("[NavigationServer3D][Benchmark] Batched path queries should outpace single queries" * doctest::skip()) {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int region_quads = 16;
+		const int regions_per_side = 4;
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		LocalVector<RID> regions;
+		_create_grid_regions(map, region_quads, regions_per_side, regions);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const int query_count = 2000;
+		const TypedArray<NavigationPathQueryParameters3D> queries = _create_path_queries(map, region_quads * regions_per_side, query_count);
+
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < query_count; i++) {
+			navigation_server->query_path(queries[i], query_result);
+		}
+		const uint64_t single_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		Ref<NavigationPathQueryBatchResult3D> batch_result;
+		batch_result.instantiate();
+		begin = OS::get_singleton()->get_ticks_usec();
+		navigation_server->query_path_batch(queries, batch_result);
+		const uint64_t batch_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		CHECK_EQ(batch_result->get_path_count(), query_count);
+
+		MESSAGE(vformat("query_path: %d queries per second", int64_t(query_count / (MAX(single_usec, uint64_t(1)) / 1000000.0))));
+		MESSAGE(vformat("query_path_batch: %d queries per second", int64_t(query_count / (MAX(batch_usec, uint64_t(1)) / 1000000.0))));
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Flow directions should lead agents to a shared target") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int region_quads = 16;
+		const int regions_per_side = 4;
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		LocalVector<RID> regions;
+		_create_grid_regions(map, region_quads, regions_per_side, regions);
+		RID agent = navigation_server->agent_create();
+		navigation_server->agent_set_map(agent, map);
+		navigation_server->agent_set_position(agent, Vector3(0.5, 0, 0.5));
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const real_t extent = region_quads * regions_per_side;
+		const Vector3 target(extent - 0.5, 0, extent - 0.5);
+
+		SUBCASE("Following the flow should reach the target") {
+			const int agent_count = 32;
+			for (int i = 0; i < agent_count; i++) {
+				Vector3 position(0.5 + Math::fmod(i * 7.3, extent - 1.0), 0, 0.5 + Math::fmod(i * 3.1, extent - 1.0));
+				const int max_steps = int(position.distance_to(target) * 2.0 / 0.25) + 8;
+				int steps = 0;
+				while (position.distance_to(target) > 0.25 && steps < max_steps) {
+					const Vector3 direction = navigation_server->map_get_flow_direction(map, target, position);
+					REQUIRE(direction.is_normalized());
+					position += direction * 0.25;
+					steps++;
+				}
+				CHECK(position.distance_to(target) <= 0.25);
+			}
+		}
+
+		SUBCASE("Agents should sample the flow of their map") {
+			// Both neighbors of the corner polygon are equally close to the target.
+			const Vector3 direction = navigation_server->agent_get_flow_direction(agent, target);
+			CHECK((direction.is_equal_approx(Vector3(1, 0, 0)) || direction.is_equal_approx(Vector3(0, 0, 1))));
+			CHECK(navigation_server->agent_get_flow_direction(agent, target, 2) == Vector3());
+		}
+
+		SUBCASE("Agents sampled from several threads should agree with the map") {
+			struct Samples {
+				RID agent;
+				Vector3 target;
+				Vector3 directions[64];
+			} samples;
+			samples.agent = agent;
+			samples.target = target;
+
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(
+					[](void *p_userdata, uint32_t p_index) {
+						Samples *p_samples = static_cast<Samples *>(p_userdata);
+						p_samples->directions[p_index] = NavigationServer3D::get_singleton()->agent_get_flow_direction(p_samples->agent, p_samples->target);
+					},
+					&samples, 64);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+			const Vector3 direction = navigation_server->map_get_flow_direction(map, target, Vector3(0.5, 0, 0.5));
+			for (const Vector3 &sample : samples.directions) {
+				CHECK(sample == direction);
+			}
+		}
+
+		navigation_server->free(agent);
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	// Skipped by default, run with `--test --no-skip --tc="*Sampling a cached flow field*"`.
+	TEST_CASE("[NavigationServer3D][Benchmark] Sampling a cached flow field should be cheaper than path queries" * doctest::skip()) {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int region_quads = 16;
+		const int regions_per_side = 4;
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		LocalVector<RID> regions;
+		_create_grid_regions(map, region_quads, regions_per_side, regions);
+		RID agent = navigation_server->agent_create();
+		navigation_server->agent_set_map(agent, map);
+		navigation_server->agent_set_position(agent, Vector3(0.5, 0, 0.5));
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const real_t extent = region_quads * regions_per_side;
+		const Vector3 target(extent - 0.5, 0, extent - 0.5);
+
+		const int sample_count = 2000;
+		LocalVector<Vector3> positions;
+		for (int i = 0; i < sample_count; i++) {
+			positions.push_back(Vector3(0.5 + Math::fmod(i * 3.1, extent - 1.0), 0, 0.5 + Math::fmod(i * 7.3, extent - 1.0)));
+		}
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (const Vector3 &position : positions) {
+			_query_path_length(map, position, target);
+		}
+		const uint64_t path_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		Vector3 flow_sum;
+		for (const Vector3 &position : positions) {
+			flow_sum += navigation_server->map_get_flow_direction(map, target, position);
+		}
+		const uint64_t flow_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		Vector3 agent_sum;
+		for (int i = 0; i < sample_count; i++) {
+			agent_sum += navigation_server->agent_get_flow_direction(agent, target);
+		}
+		const uint64_t agent_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		// Every sample moves toward the target corner, so the directions can't cancel out.
+		CHECK_FALSE(flow_sum.is_zero_approx());
+		CHECK(agent_sum.is_equal_approx(navigation_server->agent_get_flow_direction(agent, target) * sample_count));
+
+		MESSAGE(vformat("query_path: %d queries per second", int64_t(sample_count / (MAX(path_usec, uint64_t(1)) / 1000000.0))));
+		MESSAGE(vformat("map_get_flow_direction: %d queries per second", int64_t(sample_count / (MAX(flow_usec, uint64_t(1)) / 1000000.0))));
+		MESSAGE(vformat("agent_get_flow_direction: %d queries per second", int64_t(sample_count / (MAX(agent_usec, uint64_t(1)) / 1000000.0))));
+
+		navigation_server->free(agent);
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Packed avoidance should match RVO avoidance for crowds") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		// Enough agents for several chunks of the packed solver.
+		const int agents_per_side = 20;
+		const real_t spacing = 1.5;
+		const real_t center = agents_per_side * spacing * 0.5;
+
+		RID maps[2] = { navigation_server->map_create(), navigation_server->map_create() };
+		navigation_server->map_set_use_packed_avoidance(maps[1], true);
+		AvoidanceResults results[2];
+
+		LocalVector<RID> agents;
+		for (int m = 0; m < 2; m++) {
+			navigation_server->map_set_active(maps[m], true);
+			results[m].velocities.resize(agents_per_side * agents_per_side);
+			for (int z = 0; z < agents_per_side; z++) {
+				for (int x = 0; x < agents_per_side; x++) {
+					const Vector3 position(x * spacing, 0, z * spacing);
+					RID agent = navigation_server->agent_create();
+					navigation_server->agent_set_map(agent, maps[m]);
+					navigation_server->agent_set_position(agent, position);
+					navigation_server->agent_set_radius(agent, 0.5);
+					// Every agent in range is a neighbor, so that both solvers see the same neighbors despite equal distances.
+					navigation_server->agent_set_neighbor_distance(agent, 3.0);
+					navigation_server->agent_set_max_neighbors(agent, 16);
+					navigation_server->agent_set_velocity(agent, (Vector3(center, 0, center) - position).limit_length(1.0));
+					navigation_server->agent_set_avoidance_enabled(agent, true);
+					navigation_server->agent_set_avoidance_callback(agent, callable_mp(&results[m], &AvoidanceResults::store).bind(z * agents_per_side + x));
+					agents.push_back(agent);
+				}
+			}
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		for (int i = 0; i < agents_per_side * agents_per_side; i++) {
+			CHECK(results[1].velocities[i].distance_to(results[0].velocities[i]) < 0.001);
+		}
+
+		for (const RID &agent : agents) {
+			navigation_server->free(agent);
+		}
+		navigation_server->free(maps[0]);
+		navigation_server->free(maps[1]);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	// Skipped by default, run with `--test --no-skip --tc="*Packed avoidance should keep up with large crowds*"`.
+	TEST_CASE("[NavigationServer3D][Benchmark] Packed avoidance should keep up with large crowds" * doctest::skip()) {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int agents_per_side = 100;
+		const real_t spacing = 1.5;
+		const int steps = 5;
+		const real_t center = agents_per_side * spacing * 0.5;
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+
+		LocalVector<RID> agents;
+		agents.reserve(agents_per_side * agents_per_side);
+		for (int z = 0; z < agents_per_side; z++) {
+			for (int x = 0; x < agents_per_side; x++) {
+				const Vector3 position(x * spacing, 0, z * spacing);
+				RID agent = navigation_server->agent_create();
+				navigation_server->agent_set_map(agent, map);
+				navigation_server->agent_set_position(agent, position);
+				navigation_server->agent_set_radius(agent, 0.5);
+				navigation_server->agent_set_neighbor_distance(agent, 5.0);
+				navigation_server->agent_set_max_neighbors(agent, 10);
+				navigation_server->agent_set_velocity(agent, (Vector3(center, 0, center) - position).limit_length(1.0));
+				navigation_server->agent_set_avoidance_enabled(agent, true);
+				agents.push_back(agent);
+			}
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < steps; i++) {
+			navigation_server->physics_process(1.0 / 60.0);
+		}
+		const uint64_t rvo_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		navigation_server->map_set_use_packed_avoidance(map, true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < steps; i++) {
+			navigation_server->physics_process(1.0 / 60.0);
+		}
+		const uint64_t packed_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		MESSAGE(vformat("RVO avoidance: %d agents, %d usec per step", agents.size(), int64_t(rvo_usec / steps)));
+		MESSAGE(vformat("Packed avoidance: %d agents, %d usec per step", agents.size(), int64_t(packed_usec / steps)));
+
+		for (const RID &agent : agents) {
+			navigation_server->free(agent);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Tiled baking should only rebake changed tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const Ref<NavigationMeshSourceGeometryData3D> source_geometry = _create_walls_source_geometry(false);
+
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(16.0);
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		// The 128 units floor touches the tiles of 16 units from 0 to 8 on both axes.
+		CHECK_EQ(NavMeshGenerator3D::get_last_baked_tile_count(navigation_mesh), 81);
+
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_EQ(NavMeshGenerator3D::get_last_baked_tile_count(navigation_mesh), 0);
+
+		// Destroy a single wall by replacing the source geometry with one wall missing.
+		const Ref<NavigationMeshSourceGeometryData3D> changed_source_geometry = _create_walls_source_geometry(true);
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, changed_source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		// The missing wall and the tile border around it both lie within a single tile.
+		CHECK_EQ(NavMeshGenerator3D::get_last_baked_tile_count(navigation_mesh), 1);
+
+		Ref<NavigationMesh> full_navigation_mesh = memnew(NavigationMesh);
+		full_navigation_mesh->set_tile_size(16.0);
+		navigation_server->bake_from_source_geometry_data(full_navigation_mesh, changed_source_geometry, Callable());
+		CHECK(navigation_mesh->get_polygons() == full_navigation_mesh->get_polygons());
+	}
+
+	// Skipped by default, run with `--test --no-skip --tc="*Tiled baking should be faster*"`.
+	TEST_CASE("[NavigationServer3D][Benchmark] Tiled baking should be faster after a small change" * doctest::skip()) {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const Ref<NavigationMeshSourceGeometryData3D> source_geometry = _create_walls_source_geometry(false);
+		const Ref<NavigationMeshSourceGeometryData3D> changed_source_geometry = _create_walls_source_geometry(true);
+
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(16.0);
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		const uint64_t full_bake_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, changed_source_geometry, Callable());
+		const uint64_t rebake_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		MESSAGE(vformat("Tiled bake: %d usec for all tiles, %d usec after changing one wall", int64_t(full_bake_usec), int64_t(rebake_usec)));
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should simplify path properly") {
 		real_t simplify_epsilon = 0.2;
 		Vector<Vector3> source_path;